@@ -28,6 +28,9 @@ JLCXX_MODULE define_julia_module(jlcxx::Module& jsbsim)
     .method("_LoadModel", static_cast<bool (FGFDMExec::*)(const std::string&, bool)>(&FGFDMExec::LoadModel))
     .method("RunIC", &FGFDMExec::RunIC)
     .method("Run", &FGFDMExec::Run)
+    .method("RunFrames", [](FGFDMExec& fdm, unsigned int n, const std::string& stop) {
+      return fdm.RunFrames(n, stop);
+    })
     .method("GetPropertyValue", &FGFDMExec::GetPropertyValue);
 
   // FGInitialCondition
@@ -18,3 +18,6 @@ JSBSim.SetRootDir(fdm, root_dir)
 while JSBSim.GetPropertyValue(fdm, "simulation/sim-time-sec") < 5.0
   JSBSim.Run(fdm)
 end
+
+@test JSBSim.RunFrames(fdm, 240, "simulation/sim-time-sec ge 6.0") < 240
+@test JSBSim.GetPropertyValue(fdm, "simulation/sim-time-sec") >= 6.0
@@ -74,6 +74,8 @@ public:
 
 	// Wrapper functions to the FGFDMExec class
 	bool RunFDMExec() {return fdmExec->Run();}
+	/// Runs up to n frames, stopping early if the simulation is terminated.
+	unsigned int RunFDMExecFrames(unsigned int n) {return fdmExec->RunFrames(n);}
 
 	// false - never hold the simulation time from advancing
 	// TODO: make setable
@@ -18,9 +18,12 @@ from ._jsbsim import (
     FGPropertyManager,
     FGPropertyNode,
     FGPropulsion,
+    FGTrajectoryLinearization,
+    FGTrimSweep,
     GeographicError,
     TrimFailureError,
     ePressure,
     eTemperature,
     get_default_root_dir,
+    load_ltv_model,
 )
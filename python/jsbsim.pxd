@@ -25,6 +25,7 @@
 
 from libcpp cimport bool
 from libcpp.string cimport string
+from libcpp.map cimport map
 from libcpp.memory cimport shared_ptr
 from libcpp.vector cimport vector
 from cpython.ref cimport PyObject
@@ -39,10 +40,14 @@ cdef extern from "initialization/FGInitialCondition.h" namespace "JSBSim":
     cdef cppclass c_FGInitialCondition "JSBSim::FGInitialCondition":
         c_FGInitialCondition(c_FGInitialCondition* ic)
         bool Load(const c_SGPath& rstfile, bool useAircraftPath)
+        void BeginUpdate()
+        void CommitUpdate()
 
 cdef extern from "initialization/FGLinearization.h" namespace "JSBSim":
     cdef cppclass c_FGLinearization "JSBSim::FGLinearization":
-        c_FGLinearization(c_FGFDMExec* fdme)
+        c_FGLinearization(c_FGFDMExec* fdme, unsigned int threads,
+                          bool central,
+                          bool aero_partials) except +convertJSBSimToPyExc
 
         void WriteScicoslab() const
         void WriteScicoslab(string& path) const
@@ -64,6 +69,42 @@ cdef extern from "initialization/FGLinearization.h" namespace "JSBSim":
         vector[string]& GetInputUnits() const
         vector[string]& GetOutputUnits() const
 
+cdef extern from "initialization/FGTrimSweep.h" namespace "JSBSim":
+    ctypedef int c_TrimMode "JSBSim::TrimMode"
+    cdef cppclass c_Point "JSBSim::FGTrimSweep::Point":
+        vector[double] axes
+        vector[double] outputs
+        bool converged
+        unsigned int iterations
+        int warm_start
+
+    cdef cppclass c_FGTrimSweep "JSBSim::FGTrimSweep":
+        c_FGTrimSweep(c_FGFDMExec* fdmex, c_TrimMode mode)
+        void AddAxis(const string& property,
+                     const vector[double]& values) except +convertJSBSimToPyExc
+        void AddOutput(const string& property) except +convertJSBSimToPyExc
+        void SetThreads(unsigned int threads)
+        void SetCacheDirectory(const c_SGPath& dir)
+        size_t Run() except +convertJSBSimToPyExc nogil
+        const vector[string]& GetAxisNames() const
+        const vector[string]& GetOutputNames() const
+        const vector[c_Point]& GetPoints() const
+        bool IsFromCache() const
+        c_SGPath GetCacheFile()
+        void Write(const c_SGPath& path) except +convertJSBSimToPyExc
+
+cdef extern from "initialization/FGTrajectoryLinearization.h" namespace "JSBSim":
+    cdef cppclass c_FGTrajectoryLinearization "JSBSim::FGTrajectoryLinearization":
+        c_FGTrajectoryLinearization(c_FGFDMExec* fdmex, double interval,
+                                    const c_SGPath& file, unsigned int threads,
+                                    bool central) except +convertJSBSimToPyExc
+        void Update() except +convertJSBSimToPyExc nogil
+        void Linearize() except +convertJSBSimToPyExc nogil
+        size_t Run() except +convertJSBSimToPyExc nogil
+        void Finish() except +convertJSBSimToPyExc nogil
+        size_t GetRequested() const
+        size_t GetWritten() const
+
 cdef extern from "simgear/structure/SGSharedPtr.hxx":
     cdef cppclass SGSharedPtr[T]:
         SGSharedPtr()
@@ -110,6 +151,12 @@ cdef extern from "models/FGAerodynamics.h" namespace "JSBSim":
         c_FGAerodynamics(c_FGFDMExec* fdmex) except +
         c_FGColumnVector3& GetMomentsMRC()
         c_FGColumnVector3& GetForces()
+        void GetPartials(const map[string, double]& seeds,
+                         c_FGColumnVector3& dForces,
+                         c_FGColumnVector3& dMoments) except +convertJSBSimToPyExc
+        bool Linearize()
+        void ClearLinearization()
+        bool IsLinearized() const
 
 cdef extern from "models/FGAircraft.h" namespace "JSBSim":
     cdef cppclass c_FGAircraft "JSBSim::FGAircraft":
@@ -203,6 +250,9 @@ cdef extern from "FGFDMExec.h" namespace "JSBSim":
         c_FGFDMExec(c_FGPropertyManager* root, unsigned int* fdmctr)
         void Unbind() except +convertJSBSimToPyExc
         bool Run() except +convertJSBSimToPyExc
+        unsigned int RunFrames(unsigned int n, const string& stop,
+                               const vector[string]& properties,
+                               double* buffer) except +convertJSBSimToPyExc nogil
         bool RunIC() except +convertJSBSimToPyExc
         bool LoadModel(string model,
                        bool add_model_to_path) except +convertJSBSimToPyExc
@@ -235,6 +285,7 @@ cdef extern from "FGFDMExec.h" namespace "JSBSim":
         bool SetOutputFileName(int n, string fname)
         string GetOutputFileName(int n)
         void DoTrim(int mode) except +convertJSBSimToPyExc
+        void EnableTrimCache(const c_SGPath& file) except +convertJSBSimToPyExc
         void DisableOutput()
         void EnableOutput()
         void Hold()
@@ -58,13 +58,17 @@ INCLUDES
 #include "models/FGAircraft.h"
 #include "models/FGAccelerations.h"
 #include "models/FGAuxiliary.h"
+#include "models/FGGroundReactions.h"
 #include "models/FGInput.h"
 #include "initialization/FGTrim.h"
+#include "initialization/FGTrimCache.h"
 #include "initialization/FGLinearization.h"
 #include "input_output/FGScript.h"
 #include "input_output/FGXMLFileRead.h"
+#include "input_output/FGModelLoader.h"
 #include "initialization/FGInitialCondition.h"
 #include "input_output/FGLog.h"
+#include "math/FGCondition.h"
 
 using namespace std;
 
@@ -77,7 +81,8 @@ CLASS IMPLEMENTATION
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // Constructor
 
-FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmctr)
+FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmctr,
+                     bool clone)
   : RandomSeed(0), RandomGenerator(make_shared<RandomNumberGenerator>(RandomSeed)),
     FDMctr(fdmctr)
 {
@@ -89,7 +94,9 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
 
   modelLoaded = false;
   IsChild = false;
+  IsClone = clone;
   holding = false;
+  intermediate_stage = false;
   Terminate = false;
   HoldDown = false;
 
@@ -99,15 +106,29 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
   sim_time = 0.0;
   dT = 1.0/120.0; // a default timestep size. This is needed for when JSBSim is
                   // run in standalone mode with no initialization file.
+  adaptive_dT = false;
+  adaptive_running = false;
+  nominal_dT = dT;
+  substeps = 1;
+  dT_min = 1E-4;
+  dT_max = 1.0;
+  dT_tolerance = 1E-6;
+  event_location = false;
+  event_tolerance = 1E-4;
+  event_dT = 0.0;
+  event_remainder = 0.0;
+  event_count = 0;
 
   AircraftPath = "aircraft";
   EnginePath = "engine";
   SystemsPath = "systems";
 
-  if (const char* num = getenv("JSBSIM_DEBUG"); num != nullptr)
-    debug_lvl = strtol(num, nullptr, 0);
-  else
-    debug_lvl = 1;
+  if (!IsClone) {
+    if (const char* num = getenv("JSBSIM_DEBUG"); num != nullptr)
+      debug_lvl = strtol(num, nullptr, 0);
+    else
+      debug_lvl = 1;
+  }
 
   if (!FDMctr) {
     FDMctr = std::make_shared<unsigned int>(); // Create and initialize the child FDM counter
@@ -147,6 +168,8 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
   trim_status = false;
   ta_mode     = 99;
   trim_completed = 0;
+  trim_solver = tAxisByAxis;
+  trim_aero_partials = false;
 
   Constructing = true;
   instance->Tie<FGFDMExec, int>("simulation/do_simple_trim", this, nullptr, &FGFDMExec::DoTrim);
@@ -158,9 +181,20 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
   instance->Tie("simulation/pause", &holding);
   instance->Tie("simulation/sim-time-sec", this, &FGFDMExec::GetSimTime);
   instance->Tie("simulation/dt", this, &FGFDMExec::GetDeltaT);
+  instance->Tie("simulation/integrator/substeps", this, &FGFDMExec::GetSubSteps,
+                &FGFDMExec::SetSubSteps);
+  instance->Tie("simulation/adaptive-dt/enabled", &adaptive_dT);
+  instance->Tie("simulation/adaptive-dt/min-sec", &dT_min);
+  instance->Tie("simulation/adaptive-dt/max-sec", &dT_max);
+  instance->Tie("simulation/adaptive-dt/tolerance", &dT_tolerance);
+  instance->Tie("simulation/event-location/enabled", &event_location);
+  instance->Tie("simulation/event-location/tolerance-sec", &event_tolerance);
+  instance->Tie("simulation/event-location/count", this, &FGFDMExec::GetEventCount);
   instance->Tie("simulation/jsbsim-debug", this, &FGFDMExec::GetDebugLevel, &FGFDMExec::SetDebugLevel);
   instance->Tie("simulation/frame", reinterpret_cast<int*>(&Frame));
   instance->Tie("simulation/trim-completed", &trim_completed);
+  instance->Tie("simulation/trim-solver", &trim_solver);
+  instance->Tie("simulation/trim-aero-partials", &trim_aero_partials);
   instance->Tie("forces/hold-down", this, &FGFDMExec::GetHoldDown, &FGFDMExec::SetHoldDown);
 
   Constructing = false;
@@ -258,6 +292,7 @@ bool FGFDMExec::Allocate(void)
 
   // Initialize models
   InitializeModels();
+  RescheduleModels();
 
   IC = std::make_shared<FGInitialCondition>(this);
   IC->bind(instance.get());
@@ -398,6 +433,8 @@ bool FGFDMExec::DeAllocate(void)
 {
 
   Models.clear();
+  ScheduledModels.clear();
+  PrefetchedFiles.clear();
   modelLoaded = false;
   return modelLoaded;
 }
@@ -415,14 +452,47 @@ bool FGFDMExec::Run(void)
     ChildFDM->Run();
   }
 
-  IncrTime();
+  // The step set before the time step has been made adaptive is restored when
+  // the adaptive mode is disabled.
+  if (adaptive_dT != adaptive_running) {
+    double& step = IntegrationSuspended() ? saved_dT : dT;
+    if (adaptive_dT)
+      nominal_dT = step;
+    else
+      step = nominal_dT;
+    adaptive_running = adaptive_dT;
+  }
+
+  double frame_time = IncrTime();
 
   // returns true if success, false if complete
   if (Script && !IntegrationSuspended()) success = Script->RunScript();
 
-  for (unsigned int i = 0; i < Models.size(); i++) {
+  if (ScheduledModels.empty()) ScheduleModels();
+
+  for (unsigned int i: ScheduledModels) {
     LoadInputs(i);
-    Models[i]->Run(holding);
+    if (i == ePropagate)
+      RunPropagate(frame_time);
+    else
+      Models[i]->Run(holding);
+  }
+
+  // The step for the next frame is the one proposed by the error control of
+  // FGPropagate.
+  if (adaptive_dT && !holding && !IntegrationSuspended())
+    dT = Constrain(dT_min, Propagate->GetProposedStep(), dT_max);
+  else if (!holding && !IntegrationSuspended()) {
+    // The remainder of a time step that has been shortened to locate an event
+    // is taken at the next frame. The nominal step is restored afterwards.
+    if (event_remainder > 0.0) {
+      dT = event_remainder;
+      event_remainder = 0.0;
+    }
+    else if (event_dT > 0.0) {
+      dT = event_dT;
+      event_dT = 0.0;
+    }
   }
 
   if (Terminate) success = false;
@@ -432,6 +502,317 @@ bool FGFDMExec::Run(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+unsigned int FGFDMExec::RunFrames(unsigned int n, const FGCondition* stop,
+                                  const vector<SGPropertyNode*>& properties,
+                                  double* buffer)
+{
+  unsigned int frames = 0;
+
+  while (frames < n) {
+    bool running = Run();
+    frames++;
+
+    if (buffer) {
+      for (auto node: properties)
+        *buffer++ = node->getDoubleValue();
+    }
+
+    if (!running || (stop && stop->Evaluate())) break;
+  }
+
+  return frames;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGFDMExec::RunFrames(unsigned int n, const string& stop,
+                                  const vector<string>& properties,
+                                  double* buffer)
+{
+  unique_ptr<FGCondition> condition;
+  if (!stop.empty())
+    condition = make_unique<FGCondition>(stop, instance, nullptr);
+
+  vector<SGPropertyNode*> nodes;
+  for (const auto& name: properties) {
+    SGPropertyNode* node = instance->GetNode(name);
+    if (!node)
+      throw BaseException("RunFrames: the property " + name
+                          + " does not exist.");
+    nodes.push_back(node);
+  }
+
+  return RunFrames(n, condition.get(), nodes, buffer);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::RunPropagate(double frame_time)
+{
+  if (event_location && Propagate->GetRate() == 1 && !holding
+      && !IntegrationSuspended() && sim_time == frame_time)
+    LocateEvents(frame_time);
+  else
+    IntegrateFrame(frame_time);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::IntegrateFrame(double frame_time)
+{
+  if (adaptive_dT) {
+    Propagate->Run(holding);
+    CorrectTimeStep(frame_time);
+  }
+  else if (substeps > 1 && !holding && !IntegrationSuspended())
+    RunSubSteps();
+  else
+    Propagate->Run(holding);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Integrates the equations of motion over the frame in several sub-steps. The
+// aerodynamic, propulsive, external and buoyant forces are held over the frame
+// while the ground reactions, the total forces and the accelerations are
+// evaluated again at each sub-step. The models that are run at a lower rate
+// keep their outputs. During the sub-steps, the delta T is the sub-step so
+// that the gear and the friction forces are computed with the actual time
+// step.
+
+void FGFDMExec::RunSubSteps(void)
+{
+  const double frame_dT = dT;
+  dT = frame_dT / substeps;
+  // The inputs of FGPropagate have been loaded with the step of the frame.
+  Propagate->in.DeltaT = dT;
+
+  for (int s=0; s<substeps; ++s) {
+    if (s > 0) {
+      intermediate_stage = true;
+      for (unsigned int i: {eGroundReactions, eAircraft, eAccelerations}) {
+        if (Models[i]->GetRate() != 1) continue;
+        LoadInputs(i);
+        Models[i]->Run(holding);
+      }
+      intermediate_stage = false;
+      LoadInputs(ePropagate);
+    }
+    Propagate->Run(holding);
+  }
+
+  dT = frame_dT;
+  Propagate->in.DeltaT = dT;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// When the time step is adaptive, FGPropagate may have integrated over a
+// shorter step than the one the simulation time has been incremented with.
+// The simulation time and the delta T are then corrected so that the models
+// that are run after FGPropagate use the step that has actually been taken.
+// The time is left untouched if it has been reset since the beginning of the
+// frame (by the script for instance).
+
+void FGFDMExec::CorrectTimeStep(double frame_time)
+{
+  if (holding || IntegrationSuspended() || sim_time != frame_time) return;
+
+  double dt = Propagate->GetStepTaken();
+  if (dt == dT) return;
+
+  sim_time += dt - dT;
+  dT = dt;
+  Inertial->SetTime(sim_time);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Locates the first event that occurs during the frame. The events are the
+// touch down or the lift off of a gear, and the toggle of the condition of a
+// script event flagged with locate="true". Each event is described by a
+// function that is negative when the gear is compressed or the condition is
+// true. When one of them changes sign over the frame, the time at which it
+// changes sign is found by regula falsi: the frame is integrated again from
+// its initial state over a shorter step until the time is known within the
+// tolerance. The frame is then ended right after that time so that the next
+// frame starts with the gear in contact or the condition toggled. The
+// conditions only take the values -1 and +1 so they are located by bisection.
+
+void FGFDMExec::LocateEvents(double frame_time)
+{
+  vector<const FGCondition*> conditions;
+  if (Script) Script->GetLocatedConditions(conditions);
+
+  const double frame_dT = dT;
+  const double t0 = frame_time - frame_dT;
+  const FGPropagate::Snapshot snapshot = Propagate->GetSnapshot();
+  vector<double> gl, gr, g;
+
+  // The other models have been run at the initial state of the frame but the
+  // time has already been incremented.
+  sim_time = t0;
+  EvaluateEvents(conditions, false, gl);
+  sim_time = frame_time;
+  IntegrateFrame(frame_time);
+  const double h = sim_time - t0;
+  EvaluateEvents(conditions, true, gr);
+
+  auto toggled = [](const vector<double>& g1, const vector<double>& g2) {
+    for (unsigned int i=0; i<g1.size(); ++i)
+      if ((g1[i] < 0.0) != (g2[i] < 0.0)) return true;
+    return false;
+  };
+
+  if (h <= 0.0 || !toggled(gl, gr)) return;
+
+  // The first event lies in [tl, tr].
+  double tl = 0.0, tr = h, t = h;
+  int side = 0;
+  bool bisect = false;
+
+  for (unsigned int iter=0; iter<64 && tr - tl > event_tolerance; ++iter) {
+    if (bisect)
+      t = 0.5*(tl + tr);
+    else {
+      // Earliest of the estimates of the functions that change sign.
+      t = tr;
+      for (unsigned int i=0; i<gl.size(); ++i) {
+        if ((gl[i] < 0.0) == (gr[i] < 0.0)) continue;
+        t = min(t, tl + (tr - tl)*gl[i]/(gl[i] - gr[i]));
+      }
+    }
+    t = Constrain(tl + 0.5*event_tolerance, t, tr - 0.5*event_tolerance);
+    t = IntegrateFrom(snapshot, t0, t);
+    EvaluateEvents(conditions, true, g);
+
+    // Regula falsi converges from one side only: the bisection is used
+    // when the same bound has been moved twice in a row.
+    if (toggled(gl, g)) {
+      tr = t;
+      gr = g;
+      bisect = side == 1;
+      side = 1;
+    }
+    else {
+      tl = t;
+      gl = g;
+      bisect = side == -1;
+      side = -1;
+    }
+  }
+
+  // An event that is located at the end of the frame does not need the frame
+  // to be shortened.
+  if (h - tr < 0.5*event_tolerance) tr = h;
+  if (t != tr) tr = IntegrateFrom(snapshot, t0, tr);
+
+  sim_time = t0 + tr;
+  dT = tr;
+  Inertial->SetTime(sim_time);
+
+  if (tr < h) {
+    event_count++;
+    if (!adaptive_dT) {
+      if (event_dT == 0.0) event_dT = frame_dT;
+      event_remainder = h - tr;
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Integrates the frame again from the state saved in snapshot over a step t.
+// Returns the step that has actually been taken, which can be shorter than t
+// when the time step is adaptive.
+
+double FGFDMExec::IntegrateFrom(const FGPropagate::Snapshot& snapshot,
+                                double t0, double t)
+{
+  Propagate->RestoreSnapshot(snapshot);
+  Propagate->in.DeltaT = t;
+  dT = t;
+  sim_time = t0 + t;
+  Inertial->SetTime(sim_time);
+
+  IntegrateFrame(sim_time);
+
+  return sim_time - t0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Computes the event functions at the current state of FGPropagate: the
+// height of the contact point of each gear above the ground followed by the
+// conditions (-1 when true, +1 otherwise). The properties the conditions
+// depend on are updated by an intermediate stage when run_models is true.
+
+void FGFDMExec::EvaluateEvents(const vector<const FGCondition*>& conditions,
+                               bool run_models, vector<double>& g)
+{
+  g.clear();
+
+  for (int i=0; i<GroundReactions->GetNumGearUnits(); ++i) {
+    auto gear = GroundReactions->GetGearUnit(i);
+    if (gear->GetGearUnitDown())
+      g.push_back(gear->GetContactHeight(Propagate->GetLocation(),
+                                         Propagate->GetTb2l()));
+    else
+      g.push_back(1.0);
+  }
+
+  if (conditions.empty()) return;
+
+  if (run_models) RunIntermediateStage();
+
+  for (auto condition: conditions)
+    g.push_back(condition->Evaluate() ? -1.0 : 1.0);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::RunIntermediateStage(void)
+{
+  intermediate_stage = true;
+
+  for (unsigned int i: ScheduledModels) {
+    switch(i) {
+    case eInertial:
+    case eAtmosphere:
+    case eAuxiliary:
+    case eAerodynamics:
+    case eGroundReactions:
+    case eExternalReactions:
+    case eAircraft:
+    case eAccelerations:
+      // Models that are run at a lower rate keep their outputs as they would
+      // otherwise count the intermediate stages as frames.
+      if (Models[i]->GetRate() != 1) break;
+      LoadInputs(i);
+      Models[i]->Run(holding);
+      break;
+    default:
+      break;
+    }
+  }
+
+  LoadInputs(ePropagate);
+  intermediate_stage = false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Builds the list of the models that are run at each frame. The models that
+// have nothing to compute (no gas cell, no external force, no input or no
+// output) are skipped so that they do not cost a virtual call and an input
+// update per frame.
+
+void FGFDMExec::ScheduleModels(void)
+{
+  ScheduledModels.clear();
+
+  for (unsigned int i = 0; i < Models.size(); i++) {
+    if (!Models[i]->IsIdle())
+      ScheduledModels.push_back(i);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFDMExec::LoadInputs(unsigned int idx)
 {
   switch(idx) {
@@ -439,6 +820,8 @@ void FGFDMExec::LoadInputs(unsigned int idx)
     Propagate->in.vPQRidot     = Accelerations->GetPQRidot();
     Propagate->in.vUVWidot     = Accelerations->GetUVWidot();
     Propagate->in.DeltaT       = dT;
+    Propagate->in.DeltaTMin    = dT_min;
+    Propagate->in.Tolerance    = adaptive_dT ? dT_tolerance : 0.0;
     break;
   case eInput:
     break;
@@ -636,6 +1019,7 @@ void FGFDMExec::LoadModelConstants(void)
 
 bool FGFDMExec::RunIC(void)
 {
+  IC->CommitUpdate();
   SuspendIntegration(); // saves the integration rate, dt, then sets it to 0.0.
   Initialize(IC.get());
 
@@ -673,6 +1057,128 @@ bool FGFDMExec::RunIC(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+unique_ptr<FGFDMExec> FGFDMExec::Clone(void) const
+{
+  if (!modelLoaded) return nullptr;
+
+  // The clone is built silently. The debug level is shared by all the
+  // instances so it is only modified by the calling thread.
+  int saved_debug_lvl = debug_lvl;
+  debug_lvl = 0;
+
+  unique_ptr<FGFDMExec> clone(new FGFDMExec(nullptr, nullptr, true));
+  auto logger = clone->Log;
+  auto quiet = make_shared<FGLogConsole>();
+  quiet->SetMinLevel(LogLevel::ERROR);
+  clone->Log = quiet;
+  clone->RootDir = RootDir;
+  clone->AircraftPath = FullAircraftPath;
+  clone->EnginePath = EnginePath;
+  clone->SystemsPath = SystemsPath;
+
+  bool loaded = false;
+  try {
+    loaded = clone->LoadModel(modelName, false);
+    if (loaded) clone->CopyState(*this);
+  } catch (...) {
+    debug_lvl = saved_debug_lvl;
+    throw;
+  }
+  debug_lvl = saved_debug_lvl;
+
+  if (!loaded) return nullptr;
+  clone->Log = logger;
+  return clone;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Copies the values of the writable leaves of a property tree to the nodes that
+// have the same path in another tree.
+
+static void CopyPropertyValues(const SGPropertyNode* from, SGPropertyNode* to)
+{
+  for (int i=0; i < from->nChildren(); ++i) {
+    const SGPropertyNode* child = from->getChild(i);
+    SGPropertyNode* target = to->getChild(child->getNameString(),
+                                          child->getIndex());
+    if (!target) continue;
+
+    if (child->nChildren() > 0) {
+      CopyPropertyValues(child, target);
+      continue;
+    }
+
+    if (!child->getAttribute(SGPropertyNode::READ)
+        || !child->getAttribute(SGPropertyNode::WRITE)
+        || !target->getAttribute(SGPropertyNode::WRITE))
+      continue;
+
+    switch (child->getType()) {
+    case simgear::props::NONE:
+    case simgear::props::ALIAS:
+      break;
+    case simgear::props::BOOL:
+      target->setBoolValue(child->getBoolValue());
+      break;
+    case simgear::props::STRING:
+    case simgear::props::UNSPECIFIED:
+      target->setStringValue(child->getStringValue());
+      break;
+    default:
+      target->setDoubleValue(child->getDoubleValue());
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::CopyState(const FGFDMExec& fdm)
+{
+  IC->CopyFrom(*fdm.IC);
+  dT = fdm.dT;
+  saved_dT = fdm.saved_dT;
+  sim_time = fdm.sim_time;
+
+  // CopyState() may be called by a worker thread so the reports of RunIC()
+  // are silenced by the logger of this instance rather than by the debug
+  // level which is shared by all the instances.
+  // Several properties are different views of the same quantity (such as the
+  // dew point and the relative humidity) so the warnings issued when they
+  // are set are not relevant either.
+  auto logger = Log;
+  auto quiet = make_shared<FGLogConsole>();
+  quiet->SetMinLevel(LogLevel::ERROR);
+  Log = quiet;
+
+  RunIC();
+
+  // The branches simulation/ and ic/ are skipped: the former holds the
+  // commands of the executive (trim, reset, ...) and the latter has already
+  // been copied.
+  const SGPropertyNode* from = fdm.instance->GetNode();
+  SGPropertyNode* to = instance->GetNode();
+  for (int i=0; i < from->nChildren(); ++i) {
+    const SGPropertyNode* child = from->getChild(i);
+    const string& name = child->getNameString();
+    if (name == "simulation" || name == "ic") continue;
+
+    SGPropertyNode* target = to->getChild(name, child->getIndex());
+    if (target) CopyPropertyValues(child, target);
+  }
+
+  Log = logger;
+
+  // Some properties such as position/h-sl-ft have modified the state vector
+  // which is therefore copied last. The models are then run once without
+  // integrating to update the quantities that derive from the state.
+  Propagate->RestoreSnapshot(fdm.Propagate->GetSnapshot());
+  SuspendIntegration();
+  Run();
+  ResumeIntegration();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFDMExec::Initialize(const FGInitialCondition* FGIC)
 {
   Propagate->SetInitialState(FGIC);
@@ -693,6 +1199,11 @@ void FGFDMExec::ResetToInitialConditions(int mode)
 
   InitializeModels();
 
+  // Restore the nominal time step if a frame has been shortened to locate an
+  // event.
+  if (event_dT > 0.0) dT = event_dT;
+  event_dT = event_remainder = 0.0;
+
   if (Script)
     Script->ResetEvents();
   else
@@ -733,6 +1244,7 @@ vector <string> FGFDMExec::EnumerateFDMs(void)
 bool FGFDMExec::LoadScript(const SGPath& script, double deltaT,
                            const SGPath& initfile)
 {
+  FGLoadProfile::Scope profile(&LoadProfile, "LoadScript ", script.utf8Str());
   Script = std::make_shared<FGScript>(this);
   return Script->LoadScript(GetFullPath(script), deltaT, initfile);
 }
@@ -816,6 +1328,70 @@ bool FGFDMExec::LoadPlanet(Element* element)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFDMExec::PrefetchModelFiles(Element* document)
+{
+  // The path names are resolved serially, exactly as FGModelLoader::Open()
+  // will resolve them: the search paths of the models are not meant to be
+  // accessed concurrently.
+  vector<SGPath> paths;
+  auto resolve = [&paths](Element* el, auto find) {
+    string fname = el->GetAttributeValue("file");
+    if (fname.empty()) return;
+
+    SGPath path(SGPath::fromUtf8(fname.c_str()));
+    paths.push_back(path.isRelative() ? find(path) : path);
+  };
+
+  const vector<pair<string, const FGModel*>> sections {
+    {"metrics", Aircraft}, {"mass_balance", MassBalance},
+    {"ground_reactions", GroundReactions},
+    {"external_reactions", ExternalReactions},
+    {"buoyant_forces", BuoyantForces}, {"propulsion", Propulsion},
+    {"system", FCS}, {"autopilot", FCS}, {"flight_control", FCS},
+    {"aerodynamics", Aerodynamics}
+  };
+
+  for (auto& [name, model]: sections) {
+    auto find = [model=model](const SGPath& path) {
+      return model->FindFullPathName(path);
+    };
+    for (Element* el = document->FindElement(name); el;
+         el = document->FindNextElement(name))
+      resolve(el, find);
+  }
+
+  // Engine and thruster files are referenced from the propulsion section and
+  // are searched in the engine folders.
+  auto find_engine = [this](const SGPath& path) {
+    return Propulsion->FindEngineFullPathName(path);
+  };
+  Element* propulsion = document->FindElement("propulsion");
+  if (propulsion) {
+    for (Element* engine = propulsion->FindElement("engine"); engine;
+         engine = propulsion->FindNextElement("engine")) {
+      resolve(engine, find_engine);
+      Element* thruster = engine->FindElement("thruster");
+      if (thruster) resolve(thruster, find_engine);
+    }
+  }
+
+  PrefetchedFiles = PrefetchFiles(paths);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element_ptr FGFDMExec::TakePrefetchedFile(const string& fullpath)
+{
+  auto it = PrefetchedFiles.find(fullpath);
+  if (it == PrefetchedFiles.end()) return nullptr;
+
+  Element_ptr document = it->second;
+  PrefetchedFiles.erase(it);
+  return document;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGFDMExec::LoadModel(const SGPath& AircraftPath, const SGPath& EnginePath,
                           const SGPath& SystemsPath, const string& model,
                           bool addModelToPath)
@@ -851,10 +1427,16 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     DeAllocate();
     Allocate();
   }
+  ModelFiles.clear();
 
+  FGLoadProfile::Scope profile(&LoadProfile, "LoadModel ", model);
   int saved_debug_lvl = debug_lvl;
   FGXMLFileRead XMLFileRead;
-  Element *document = XMLFileRead.LoadXMLDocument(aircraftCfgFileName); // "document" is a class member
+  Element *document = nullptr;
+  {
+    FGLoadProfile::Scope profile(&LoadProfile, "read ", aircraftCfgFileName.utf8Str());
+    document = XMLFileRead.LoadXMLDocument(aircraftCfgFileName); // "document" is a class member
+  }
 
   if (document) {
     if (IsChild) debug_lvl = 0;
@@ -879,6 +1461,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     // Process the planet element. This element is OPTIONAL.
     element = document->FindElement("planet");
     if (element) {
+      FGLoadProfile::Scope profile(&LoadProfile, "planet");
       result = LoadPlanet(element);
       if (!result) {
         FGXMLLogging log(Log, element, LogLevel::ERROR);
@@ -887,9 +1470,17 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
       }
     }
 
+    // Read and parse the files referenced by the aircraft definition
+    // concurrently. The models then pick them up in the usual order.
+    {
+      FGLoadProfile::Scope profile(&LoadProfile, "prefetch files");
+      PrefetchModelFiles(document);
+    }
+
     // Process the metrics element. This element is REQUIRED.
     element = document->FindElement("metrics");
     if (element) {
+      FGLoadProfile::Scope profile(&LoadProfile, "metrics");
       result = Models[eAircraft]->Load(element);
       if (!result) {
         FGXMLLogging log(Log, element, LogLevel::ERROR);
@@ -905,6 +1496,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     // Process the mass_balance element. This element is REQUIRED.
     element = document->FindElement("mass_balance");
     if (element) {
+      FGLoadProfile::Scope profile(&LoadProfile, "mass_balance");
       result = Models[eMassBalance]->Load(element);
       if (!result) {
         FGXMLLogging log(Log, element, LogLevel::ERROR);
@@ -920,6 +1512,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     // Process the ground_reactions element. This element is REQUIRED.
     element = document->FindElement("ground_reactions");
     if (element) {
+      FGLoadProfile::Scope profile(&LoadProfile, "ground_reactions");
       result = Models[eGroundReactions]->Load(element);
       if (!result) {
         FGXMLLogging log(Log, element, LogLevel::ERROR);
@@ -937,6 +1530,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     // Process the external_reactions element. This element is OPTIONAL.
     element = document->FindElement("external_reactions");
     if (element) {
+      FGLoadProfile::Scope profile(&LoadProfile, "external_reactions");
       result = Models[eExternalReactions]->Load(element);
       if (!result) {
         FGXMLLogging log(Log, element, LogLevel::ERROR);
@@ -948,6 +1542,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     // Process the buoyant_forces element. This element is OPTIONAL.
     element = document->FindElement("buoyant_forces");
     if (element) {
+      FGLoadProfile::Scope profile(&LoadProfile, "buoyant_forces");
       result = Models[eBuoyantForces]->Load(element);
       if (!result) {
         FGXMLLogging log(Log, element, LogLevel::ERROR);
@@ -959,6 +1554,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     // Process the propulsion element. This element is OPTIONAL.
     element = document->FindElement("propulsion");
     if (element) {
+      FGLoadProfile::Scope profile(&LoadProfile, "propulsion");
       result = Propulsion->Load(element);
       if (!result) {
         FGXMLLogging log(Log, element, LogLevel::ERROR);
@@ -972,6 +1568,9 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     // Process the system element[s]. This element is OPTIONAL, and there may be more than one.
     element = document->FindElement("system");
     while (element) {
+      string sysname = element->GetAttributeValue("name");
+      if (sysname.empty()) sysname = element->GetAttributeValue("file");
+      FGLoadProfile::Scope profile(&LoadProfile, "system ", sysname);
       result = Models[eSystems]->Load(element);
       if (!result) {
         FGXMLLogging log(Log, element, LogLevel::ERROR);
@@ -984,6 +1583,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     // Process the autopilot element. This element is OPTIONAL.
     element = document->FindElement("autopilot");
     if (element) {
+      FGLoadProfile::Scope profile(&LoadProfile, "autopilot");
       result = Models[eSystems]->Load(element);
       if (!result) {
         FGXMLLogging log(Log, element, LogLevel::ERROR);
@@ -995,6 +1595,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     // Process the flight_control element. This element is OPTIONAL.
     element = document->FindElement("flight_control");
     if (element) {
+      FGLoadProfile::Scope profile(&LoadProfile, "flight_control");
       result = Models[eSystems]->Load(element);
       if (!result) {
         FGXMLLogging log(Log, element, LogLevel::ERROR);
@@ -1006,6 +1607,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     // Process the aerodynamics element. This element is OPTIONAL, but almost always expected.
     element = document->FindElement("aerodynamics");
     if (element) {
+      FGLoadProfile::Scope profile(&LoadProfile, "aerodynamics");
       result = Models[eAerodynamics]->Load(element);
       if (!result) {
         FGXMLLogging log(Log, element, LogLevel::ERROR);
@@ -1018,8 +1620,10 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     }
 
     // Process the input element. This element is OPTIONAL, and there may be more than one.
-    element = document->FindElement("input");
+    // The clones do not open the sockets and the files of their original.
+    element = IsClone ? nullptr : document->FindElement("input");
     while (element) {
+      FGLoadProfile::Scope profile(&LoadProfile, "input");
       if (!Input->Load(element))
         return false;
 
@@ -1028,8 +1632,9 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
 
     // Process the output element[s]. This element is OPTIONAL, and there may be
     // more than one.
-    element = document->FindElement("output");
+    element = IsClone ? nullptr : document->FindElement("output");
     while (element) {
+      FGLoadProfile::Scope profile(&LoadProfile, "output");
       if (!Output->Load(element))
         return false;
 
@@ -1047,11 +1652,15 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
       }
     }
 
+    // Release the files that have not been claimed by any model.
+    PrefetchedFiles.clear();
+
     // Since all vehicle characteristics have been loaded, place the values in the Inputs
     // structure for the FGModel-derived classes.
     LoadModelConstants();
 
     modelLoaded = true;
+    RescheduleModels();
 
     if (IsChild) debug_lvl = saved_debug_lvl;
 
@@ -1065,6 +1674,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
   for (unsigned int i=0; i< Models.size(); i++) LoadInputs(i);
 
   if (result) {
+    FGLoadProfile::Scope profile(&LoadProfile, "property catalog");
     struct PropertyCatalogStructure masterPCS;
     masterPCS.base_string = "";
     masterPCS.node = Root;
@@ -1332,8 +1942,20 @@ void FGFDMExec::DoTrim(int mode)
   if (mode < 0 || mode > JSBSim::tNone)
     throw TrimFailureException("Illegal trimming mode!");
 
+  if (trim_solver < tAxisByAxis || trim_solver > tLevenbergMarquardt)
+    throw TrimFailureException("Illegal trim solver!");
+
+  // The trim starts from the pending updates of the initial conditions.
+  IC->CommitUpdate();
+
   FGTrim trim(this, (JSBSim::TrimMode)mode);
-  bool success = trim.DoTrim();
+  trim.SetSolver((JSBSim::TrimSolver)trim_solver);
+  trim.SetAeroPartials(trim_aero_partials);
+  bool success;
+  if (TrimCache)
+    success = TrimCache->Trim(this, trim, (JSBSim::TrimMode)mode);
+  else
+    success = trim.DoTrim();
 
   if (debug_lvl > 0)
     trim.Report();
@@ -1346,6 +1968,16 @@ void FGFDMExec::DoTrim(int mode)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFDMExec::EnableTrimCache(const SGPath& file)
+{
+  if (TrimCache) instance->Unbind(TrimCache);
+
+  TrimCache = std::make_shared<FGTrimCache>(file);
+  TrimCache->Bind(instance.get());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFDMExec::DoLinearization(int)
 {
   double dt0 = this->GetDeltaT();
@@ -46,6 +46,7 @@ INCLUDES
 #include "models/FGPropagate.h"
 #include "models/FGOutput.h"
 #include "math/FGTemplateFunc.h"
+#include "input_output/FGLoadProfile.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -55,6 +56,7 @@ namespace JSBSim {
 
 class FGScript;
 class FGTrim;
+class FGTrimCache;
 class FGAerodynamics;
 class FGAircraft;
 class FGAtmosphere;
@@ -70,6 +72,7 @@ class FGInput;
 class FGPropulsion;
 class FGMassBalance;
 class FGLogger;
+class FGCondition;
 
 class TrimFailureException : public BaseException {
   public:
@@ -172,6 +175,42 @@ CLASS DOCUMENTATION
                                 tCustom (4), tTurn (5). Setting this to a legal value
                                 (such as by a script) causes a trim to be performed. This
                                 property actually maps toa function call of DoTrim().
+    @property simulation/trim-solver Solver used by the trim: tAxisByAxis (0,
+                                the default) or tLevenbergMarquardt (1). See
+                                FGTrim.
+    @property simulation/trim-aero-partials When true, the tLevenbergMarquardt
+                                solver uses the analytic partials of the
+                                aerodynamics in its jacobian (false by
+                                default). See FGTrim::SetAeroPartials().
+    @property simulation/trim-cache/... Statistics of the cache of the trim
+                                solutions when it is enabled (see
+                                EnableTrimCache() and FGTrimCache).
+    @property simulation/integrator/substeps Number of sub-steps in which the
+                                equations of motion are integrated at each
+                                frame (see SetSubSteps()).
+    @property simulation/adaptive-dt/enabled When true, the time step is adapted
+                                at each frame to keep the local integration
+                                error of FGPropagate below a tolerance. The step
+                                set with Setdt() is used for the first frame
+                                and is restored when the property is reset.
+    @property simulation/adaptive-dt/min-sec Lower bound of the adaptive time
+                                step (default 1e-4 sec).
+    @property simulation/adaptive-dt/max-sec Upper bound of the adaptive time
+                                step (default 1 sec).
+    @property simulation/adaptive-dt/tolerance Relative tolerance on the local
+                                error of the position, velocity and attitude
+                                over a time step (default 1e-6).
+    @property simulation/event-location/enabled When true, the executive
+                                locates the time at which a gear touches or
+                                leaves the ground, or the condition of a script
+                                event flagged with locate="true" toggles,
+                                within each frame. The frame is shortened to
+                                end right after that time and the next frame
+                                completes the time step (see LocateEvents()).
+    @property simulation/event-location/tolerance-sec Accuracy of the located
+                                time (default 1e-4 sec).
+    @property simulation/event-location/count (read only) Number of frames that
+                                have been shortened to locate an event.
 
     @author Jon S. Berndt
     @version $Revision: 1.106 $
@@ -208,7 +247,8 @@ class JSBSIM_API FGFDMExec : public FGJSBBase
 public:
 
   /// Default constructor
-  FGFDMExec(FGPropertyManager* root = nullptr, std::shared_ptr<unsigned int> fdmctr = nullptr);
+  FGFDMExec(FGPropertyManager* root = nullptr, std::shared_ptr<unsigned int> fdmctr = nullptr)
+    : FGFDMExec(root, fdmctr, false) {}
 
   /// Default destructor
   ~FGFDMExec();
@@ -247,11 +287,68 @@ public:
       @return true if successful, false if sim should be ended  */
   bool Run(void);
 
+  /** Runs several frames in a row. The execution stops before n frames have
+      been run if Run() returns false (the simulation has been terminated or
+      the script has ended) or if the stop condition is true at the end of a
+      frame.
+      @param n          the maximum number of frames to run
+      @param stop       the stop condition (can be null)
+      @param properties the properties to record at the end of each frame
+      @param buffer     a buffer of at least n*properties.size() elements in
+                        which the values of the properties are stored frame
+                        after frame (can be null if there is no property)
+      @return the number of frames that have been run */
+  unsigned int RunFrames(unsigned int n, const FGCondition* stop=nullptr,
+                         const std::vector<SGPropertyNode*>& properties={},
+                         double* buffer=nullptr);
+
+  /** Runs several frames in a row. This is a convenience overload for the
+      language bindings: the stop condition and the properties are given by
+      their names.
+      @param n          the maximum number of frames to run
+      @param stop       the stop condition, such as "position/h-agl-ft lt 10".
+                        No condition is checked if the string is empty.
+      @param properties the names of the properties to record
+      @param buffer     a buffer of at least n*properties.size() elements
+      @return the number of frames that have been run
+      @throws BaseException if the condition is ill formed or if one of the
+              properties does not exist. */
+  unsigned int RunFrames(unsigned int n, const std::string& stop,
+                         const std::vector<std::string>& properties={},
+                         double* buffer=nullptr);
+
   /** Initializes the sim from the initial condition object and executes
-      each scheduled model without integrating i.e. dt=0.
+      each scheduled model without integrating i.e. dt=0. The updates of the
+      initial conditions that are still pending are committed first (see
+      FGInitialCondition::BeginUpdate()).
       @return true if successful */
   bool RunIC(void);
 
+  /** Creates a new executive that runs the same aircraft model. The clone has
+      its own property tree and is set in the state of this instance with
+      CopyState(). It does not load the input and output directives of the
+      aircraft file so that it does not compete with this instance for the
+      sockets and the files. The clone is built silently and logs its
+      messages to the console. Each clone can be run in a different thread.
+      @return the clone or null if the model could not be loaded. */
+  std::unique_ptr<FGFDMExec> Clone(void) const;
+
+  /** Enables the cache of the trim solutions. The trims requested with the
+      property simulation/do_simple_trim are then started from the nearest
+      solution of the cache (see FGTrimCache). A cache that was already
+      enabled is replaced.
+      @param file the file from which the cache is read and to which it is
+                  saved, empty to keep the solutions in memory only. */
+  void EnableTrimCache(const SGPath& file=SGPath());
+
+  /** Sets this executive in the state of another instance that runs the same
+      aircraft model. The initial conditions are copied and the models are
+      initialized with RunIC(), then the values of the writable properties
+      are copied except for those under simulation/ and ic/. The state vector
+      is copied last.
+      @param fdm the executive to copy */
+  void CopyState(const FGFDMExec& fdm);
+
   /** Loads the planet.
       Loads the definition of the planet on which the vehicle will evolve such as
       its radius, gravity or its atmosphere characteristics.
@@ -390,6 +487,8 @@ public:
   std::shared_ptr<FGInitialCondition>  GetIC(void) const {return IC;}
   /// Returns a pointer to the FGTrim object
   std::shared_ptr<FGTrim>              GetTrim(void);
+  /// Returns a pointer to the cache of the trim solutions (null if disabled)
+  std::shared_ptr<FGTrimCache>         GetTrimCache(void) const {return TrimCache;}
   ///@}
 
   /// Retrieves the engine path.
@@ -565,6 +664,49 @@ public:
       @return true if suspended, false if executing  */
   bool IntegrationSuspended(void) const {return dT == 0.0;}
 
+  /** Evaluates the forces and moments at an intermediate stage of a
+      multi-stage integration scheme. Only the models whose outputs depend
+      algebraically on the vehicle state are run. The flight control system,
+      the propulsion, the winds and the buoyant forces keep the outputs of the
+      last frame. The resulting accelerations are then loaded in the inputs of
+      FGPropagate. */
+  void RunIntermediateStage(void);
+
+  /** Returns true while the models are run at an intermediate stage of a
+      multi-stage integration scheme or at a sub-step of a frame. The models
+      must not update their bookkeeping (distances, reports, etc.) during those
+      runs. */
+  bool IntermediateStage(void) const {return intermediate_stage;}
+
+  /** Returns true if the time step is adapted to the integration error. In
+      that case, the delta T is the step proposed for the next frame; it is
+      reduced by FGPropagate if the error over the step is too large and the
+      simulation time is corrected accordingly before the other models are
+      run. */
+  bool AdaptiveTimeStep(void) const {return adaptive_dT;}
+
+  /** Returns true if the frames may not all have the same duration, either
+      because the time step is adaptive or because the frames are shortened to
+      locate events. The models then use the simulation time that has elapsed
+      since they were last run rather than a frame count. */
+  bool VariableTimeStep(void) const {return adaptive_dT || event_location;}
+
+  /** Returns the number of frames that have been shortened to locate an
+      event (see the property simulation/event-location/enabled). */
+  int GetEventCount(void) const {return event_count;}
+
+  /** Sets the number of sub-steps in which the equations of motion are
+      integrated at each frame. The aerodynamic, propulsive, external and
+      buoyant forces are evaluated once per frame and held over the sub-steps
+      while the ground reactions are evaluated at each sub-step. This allows
+      stiff gear to be integrated with a short time step without paying for
+      the evaluation of all the models. The sub-steps are ignored when the
+      time step is adaptive.
+      @param n the number of sub-steps per frame (1 disables sub-stepping) */
+  void SetSubSteps(int n) { substeps = n < 1 ? 1 : n; }
+  /// Returns the number of sub-steps per frame.
+  int GetSubSteps(void) const { return substeps; }
+
   /** Sets the current sim time.
       @param cur_time the current time
       @return the current simulation time.      */
@@ -627,6 +769,33 @@ public:
     TemplateFunctions[name] = std::make_shared<FGTemplateFunc>(this, el);
   }
 
+  /** Retrieves a model file that has been read and parsed ahead of time while
+      loading the aircraft. The file is removed from the prefetched files so
+      that each document is handed out only once.
+      @param fullpath the full path name of the file
+      @return the document or nullptr if the file has not been prefetched. */
+  Element_ptr TakePrefetchedFile(const std::string& fullpath);
+
+  /** Records a file that has been read while loading the model. These are the
+      files included by the aircraft file (engines, thrusters, systems, ...).
+      @param fullpath the full path name of the file */
+  void AddModelFile(const SGPath& fullpath) { ModelFiles.push_back(fullpath); }
+
+  /// Returns the files that have been included by the aircraft file.
+  const std::vector<SGPath>& GetModelFiles(void) const { return ModelFiles; }
+
+  /** Requests the list of the models that are run at each frame to be
+      rebuilt. Models that have nothing to compute (see FGModel::IsIdle) are
+      left out of that list, so this method must be called whenever a model
+      gets something to compute after the aircraft has been loaded. */
+  void RescheduleModels(void) { ScheduledModels.clear(); }
+
+  /** Retrieves the profile of the load phases. The profile records the
+      duration of the phases of LoadModel() and LoadScript() once it has been
+      enabled with FGLoadProfile::Enable().
+      @see FGLoadProfile */
+  FGLoadProfile* GetLoadProfile(void) { return &LoadProfile; }
+
   auto GetRandomGenerator(void) const { return RandomGenerator; }
 
   int  SRand(void) const { return RandomSeed; }
@@ -642,13 +811,27 @@ private:
   bool Terminate;
   double dT;
   double saved_dT;
+  bool adaptive_dT;
+  bool adaptive_running;
+  double nominal_dT;
+  double dT_min;
+  double dT_max;
+  double dT_tolerance;
+  int substeps;
+  bool event_location;
+  double event_tolerance;
+  double event_dT;
+  double event_remainder;
+  int event_count;
   double sim_time;
   bool holding;
+  bool intermediate_stage;
   bool IncrementThenHolding;
   int TimeStepsUntilHold;
   bool Constructing;
   bool modelLoaded;
   bool IsChild;
+  bool IsClone;
   std::string modelName;
   SGPath AircraftPath;
   SGPath FullAircraftPath;
@@ -681,10 +864,13 @@ private:
   bool trim_status;
   int ta_mode;
   int trim_completed;
+  int trim_solver;
+  bool trim_aero_partials;
 
   std::shared_ptr<FGInitialCondition> IC;
   std::shared_ptr<FGScript>           Script;
   std::shared_ptr<FGTrim>             Trim;
+  std::shared_ptr<FGTrimCache>        TrimCache;
 
   SGPropertyNode_ptr Root;
   std::shared_ptr<FGPropertyManager> instance;
@@ -701,8 +887,22 @@ private:
   std::vector <std::string> PropertyCatalog;
   std::vector <std::shared_ptr<childData>> ChildFDMList;
   std::vector <std::shared_ptr<FGModel>> Models;
+  std::vector <unsigned int> ScheduledModels;
   std::map<std::string, FGTemplateFunc_ptr> TemplateFunctions;
-
+  std::map<std::string, Element_ptr> PrefetchedFiles;
+  std::vector<SGPath> ModelFiles;
+  FGLoadProfile LoadProfile;
+
+  void ScheduleModels(void);
+  void RunPropagate(double frame_time);
+  void IntegrateFrame(double frame_time);
+  void RunSubSteps(void);
+  void CorrectTimeStep(double frame_time);
+  void LocateEvents(double frame_time);
+  double IntegrateFrom(const FGPropagate::Snapshot& snapshot, double t0,
+                       double t);
+  void EvaluateEvents(const std::vector<const FGCondition*>& conditions,
+                      bool run_models, std::vector<double>& g);
   bool ReadFileHeader(Element*);
   bool ReadChild(Element*);
   bool ReadPrologue(Element*);
@@ -710,6 +910,7 @@ private:
   void LoadInputs(unsigned int idx);
   void LoadPlanetConstants(void);
   bool LoadPlanet(Element* el);
+  void PrefetchModelFiles(Element* document);
   void LoadModelConstants(void);
   bool Allocate(void);
   bool DeAllocate(void);
@@ -722,6 +923,11 @@ private:
       return name;
   }
 
+  /** Constructor. A clone keeps the debug level of the calling thread
+      instead of reading it from the environment variable JSBSIM_DEBUG. */
+  FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmctr,
+            bool clone);
+
   void Debug(int from);
 };
 }
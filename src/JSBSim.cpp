@@ -44,6 +44,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "input_output/FGXMLFileRead.h"
 #include "input_output/string_utilities.h"
+#include "input_output/FGRealTimePacer.h"
 
 #if !defined(__GNUC__) && !defined(sgi) && !defined(_MSC_VER)
 #  include <time>
@@ -75,6 +76,7 @@ INCLUDES
 #endif
 
 #include <iostream>
+#include <fstream>
 #include <cstdlib>
 
 using namespace std;
@@ -90,6 +92,7 @@ SGPath ScriptName;
 string AircraftName;
 SGPath ResetName;
 SGPath PlanetName;
+SGPath LoadProfileName;
 vector <string> LogOutputName;
 vector <SGPath> LogDirectiveName;
 vector <string> CommandLineProperties;
@@ -107,6 +110,8 @@ double end_time = 1e99;
 double simulation_rate = 1./120.;
 bool override_sim_rate = false;
 double sleep_period=0.01;
+double time_acceleration = 1.0;
+double spin_threshold = -1.0;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -116,24 +121,6 @@ bool options(int, char**);
 int real_main(int argc, char* argv[]);
 void PrintHelp(void);
 
-#if defined(__BORLANDC__) || defined(_MSC_VER) || defined(__MINGW32__)
-  double getcurrentseconds(void)
-  {
-    struct timeb tm_ptr;
-    ftime(&tm_ptr);
-    return tm_ptr.time + tm_ptr.millitm*0.001;
-  }
-#else
-  double getcurrentseconds(void)
-  {
-    struct timeval tval;
-    struct timezone tz;
-
-    gettimeofday(&tval, &tz);
-    return (tval.tv_sec + tval.tv_usec*1e-6);
-  }
-#endif
-
 #if defined(__BORLANDC__) || defined(_MSC_VER) || defined(__MINGW32__)
   void sim_nsleep(long nanosec)
   {
@@ -184,42 +171,13 @@ public:
   }
 };
 
-/** The Timer class measures the elapsed real time and can be paused and resumed.
-    It inherits from SGPropertyChangeListener to restart the timer whenever a
-    property change is detected. */
-class Timer : public SGPropertyChangeListener {
+/** Restarts the pacing of the frames whenever the simulation is reset. */
+class ResetListener : public SGPropertyChangeListener {
 public:
-  Timer() : SGPropertyChangeListener(), isPaused(false) { start(); }
-  void start(void) { initial_seconds = getcurrentseconds(); }
-
-  /// Restart the timer when the listened property is modified.
-  void valueChanged(SGPropertyNode* prop) override {
-    start();
-    if (isPaused) pause_start_seconds = initial_seconds;
-  }
-  /// Get the elapsed real time in seconds since the timer was started.
-  double getElapsedTime(void) { return getcurrentseconds() - initial_seconds; }
-
-  /** Pause the timer if the `paused` parameter is true and resume it if the
-      `paused` parameter is false. */
-  void pause(bool paused) {
-    if (paused) {
-      if (!isPaused) {
-        isPaused = true;
-        pause_start_seconds = getcurrentseconds();
-      }
-    } else {
-      if (isPaused) {
-        isPaused = false;
-        double pause_duration = getcurrentseconds() - pause_start_seconds;
-        initial_seconds += pause_duration; // Shift the initial time to account for the pause duration.
-      }
-    }
-  }
+  explicit ResetListener(JSBSim::FGRealTimePacer* p) : pacer(p) {}
+  void valueChanged(SGPropertyNode* prop) override { pacer->Restart(); }
 private:
-  double initial_seconds = 0.0;
-  bool isPaused = false;
-  double pause_start_seconds = 0.0;
+  JSBSim::FGRealTimePacer* pacer;
 };
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -364,6 +322,7 @@ int real_main(int argc, char* argv[])
   AircraftName = "";
   ResetName = "";
   PlanetName = "";
+  LoadProfileName = "";
   LogOutputName.clear();
   LogDirectiveName.clear();
   bool result = false, success;
@@ -374,6 +333,7 @@ int real_main(int argc, char* argv[])
   double cycle_duration = 0.0;
   double override_sim_rate_value = 0.0;
   long sleep_nseconds = 0;
+  JSBSim::FGRealTimePacer pacer;
 
   realtime = false;
   play_nice = false;
@@ -398,9 +358,18 @@ int real_main(int argc, char* argv[])
   FDMExec->GetPropertyManager()->Tie("simulation/frame_start_time", &actual_elapsed_time);
   FDMExec->GetPropertyManager()->Tie("simulation/cycle_duration", &cycle_duration);
 
-  Timer timer;
+  // The deadlines are absolute so that the errors of the sleep function do not
+  // accumulate. When playing nice, the pacer only sleeps.
+  pacer.SetTimeAcceleration(time_acceleration);
+  if (spin_threshold >= 0.0)
+    pacer.SetSpinThreshold(spin_threshold);
+  else if (play_nice)
+    pacer.SetSpinThreshold(0.0);
+  pacer.Bind(FDMExec->GetPropertyManager().get());
+
+  ResetListener reset_listener(&pacer);
   SGPropertyNode_ptr reset_node = FDMExec->GetPropertyManager()->GetNode("simulation/reset");
-  reset_node->addChangeListener(&timer);
+  reset_node->addChangeListener(&reset_listener);
 
   // Check whether to disable console highlighting output on Windows.
   // Support was added to Windows for Virtual Terminal codes by a particular
@@ -433,6 +402,8 @@ int real_main(int argc, char* argv[])
     }
   }
 
+  if (!LoadProfileName.isNull()) FDMExec->GetLoadProfile()->Enable(true);
+
   if (!PlanetName.isNull()) {
     result = FDMExec->LoadPlanet(PlanetName, false);
 
@@ -487,6 +458,20 @@ int real_main(int argc, char* argv[])
     exit(-1);
   }
 
+  // Report the duration of the load phases, if requested
+  if (!LoadProfileName.isNull()) {
+    JSBSim::FGLoadProfile* profile = FDMExec->GetLoadProfile();
+    profile->PrintReport(cout);
+
+    ofstream trace(LoadProfileName.utf8Str());
+    if (trace.is_open())
+      profile->WriteChromeTrace(trace);
+    else
+      cerr << "Could not open the load profile file " << LoadProfileName << endl;
+
+    profile->Enable(false);
+  }
+
   // Load output directives file[s], if given
   for (unsigned int i=0; i<LogDirectiveName.size(); i++) {
     if (!LogDirectiveName[i].isNull()) {
@@ -577,7 +562,7 @@ int real_main(int argc, char* argv[])
   else          sleep_nseconds = (sleep_period )*1e9;           // 0.01 seconds
 
   tzset();
-  timer.start();
+  pacer.Start(FDMExec->GetSimTime());
 
   // *** CYCLIC EXECUTION LOOP, AND MESSAGE READING *** //
   while (result && FDMExec->GetSimTime() <= end_time) {
@@ -597,20 +582,15 @@ int real_main(int argc, char* argv[])
         if (play_nice) sim_nsleep(sleep_nseconds);
 
       } else {                    // ------------ RUNNING IN REALTIME MODE
-        timer.pause(false);
-        actual_elapsed_time = timer.getElapsedTime();
-
-        double sim_lag_time = actual_elapsed_time - FDMExec->GetSimTime(); // How far behind sim-time is from actual elapsed time.
-        double cycle_start = getcurrentseconds();
-
-        for (int i=0; i<(int)(sim_lag_time/frame_duration); i++) {  // catch up sim time to actual elapsed time.
-          result = FDMExec->Run();
-          cycle_duration = getcurrentseconds() - cycle_start;   // Calculate cycle duration
-          cycle_start = getcurrentseconds();                    // Get new current_seconds
-          if (FDMExec->Holding()) break;
-        }
+        // Each frame is run with the same time step. When the simulation lags
+        // behind the wall clock, the pacer does not wait until it has caught
+        // up.
+        pacer.Resume();
+        actual_elapsed_time = pacer.GetElapsedTime();
 
-        if (play_nice) sim_nsleep(sleep_nseconds);
+        result = FDMExec->Run();
+        pacer.Pace(FDMExec->GetSimTime());
+        cycle_duration = pacer.GetCycleDuration();
 
         if (FDMExec->GetSimTime() >= new_five_second_value) { // Print out elapsed time every five seconds.
           cout << "Simulation elapsed time: " << FDMExec->GetSimTime() << endl;
@@ -618,7 +598,7 @@ int real_main(int argc, char* argv[])
         }
       }
     } else { // Suspended
-      timer.pause(true);
+      pacer.Pause();
       sim_nsleep(sleep_nseconds);
       result = FDMExec->Run();
     }
@@ -635,6 +615,8 @@ int real_main(int argc, char* argv[])
   strftime(s, 99, "%A %B %d %Y %X", &local);
   cout << "End: " << s << " (HH:MM:SS)" << endl;
 
+  if (realtime) pacer.PrintReport(cout);
+
   // CLEAN UP
   delete FDMExec;
 
@@ -678,6 +660,26 @@ bool options(int count, char **arg)
       exit (0);
     } else if (keyword == "--realtime") {
       realtime = true;
+      if (n != string::npos) {
+        try {
+          time_acceleration = JSBSim::atof_locale_c( value.c_str() );
+        } catch (...) {
+          cerr << endl << "  Invalid time acceleration given!" << endl << endl;
+          result = false;
+        }
+      }
+    } else if (keyword == "--spin") {
+      if (n != string::npos) {
+        try {
+          spin_threshold = JSBSim::atof_locale_c( value.c_str() );
+        } catch (...) {
+          cerr << endl << "  Invalid spin threshold given!" << endl << endl;
+          result = false;
+        }
+      } else {
+        gripe;
+        exit(1);
+      }
     } else if (keyword == "--nice") {
       play_nice = true;
       if (n != string::npos) {
@@ -733,6 +735,13 @@ bool options(int count, char **arg)
         gripe;
         exit(1);
       }
+    } else if (keyword == "--load-profile") {
+      if (n != string::npos) {
+        LoadProfileName = SGPath::fromLocal8Bit(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
     } else if (keyword == "--planet") {
       if (n != string::npos) {
         PlanetName = SGPath::fromLocal8Bit(value.c_str());
@@ -848,12 +857,18 @@ void PrintHelp(void)
     cout << "    --root=<path>  specifies the JSBSim root directory (where aircraft/, engine/, etc. reside)" << endl;
     cout << "    --aircraft=<filename>  specifies the name of the aircraft to be modeled" << endl;
     cout << "    --script=<filename>  specifies a script to run" << endl;
-    cout << "    --realtime  specifies to run in actual real world time" << endl;
+    cout << "    --realtime[=<factor>]  specifies to run in actual real world time, optionally" << endl;
+    cout << "                           accelerated by a factor (0 runs as fast as possible)." << endl;
+    cout << "                           Frame timing statistics are printed at the end" << endl;
+    cout << "    --spin=<seconds>  specifies the duration of the busy wait before each real time" << endl;
+    cout << "                      frame deadline (default 0.001, 0 with --nice)" << endl;
     cout << "    --nice  specifies to run at lower CPU usage" << endl;
     cout << "    --nohighlight  specifies that console output should be pure text only (no color)" << endl;
     cout << "    --suspend  specifies to suspend the simulation after initialization" << endl;
     cout << "    --initfile=<filename>  specifies an initialization file" << endl;
     cout << "    --planet=<filename>  specifies a planet definition file" << endl;
+    cout << "    --load-profile=<filename>  prints the duration of the load phases and writes" << endl;
+    cout << "                               them to a Chrome trace event (JSON) file" << endl;
     cout << "    --catalog specifies that all properties for this aircraft model should be printed" << endl;
     cout << "              (catalog=aircraftname is an optional format)" << endl;
     cout << "    --property=<name=value> e.g. --property=simulation/integrator/rate/rotational=1" << endl;
@@ -149,12 +149,222 @@ void FGInitialCondition::InitializeIC(void)
   lastLatitudeSet = setgeoc;
   enginesRunning = 0;
   trimRequested = TrimMode::tNone;
+
+  updating = false;
+  updateSet.reset();
+  windUpdates.clear();
+}
+
+//******************************************************************************
+
+void FGInitialCondition::CopyFrom(const FGInitialCondition& ic)
+{
+  vUVW_NED = ic.vUVW_NED;
+  vPQR_body = ic.vPQR_body;
+  position = ic.position;
+  orientation = ic.orientation;
+  vt = ic.vt;
+  targetNlfIC = ic.targetNlfIC;
+  Tw2b = ic.Tw2b;
+  Tb2w = ic.Tb2w;
+  alpha = ic.alpha;
+  beta = ic.beta;
+  epa = ic.epa;
+  lastSpeedSet = ic.lastSpeedSet;
+  lastAltitudeSet = ic.lastAltitudeSet;
+  lastLatitudeSet = ic.lastLatitudeSet;
+  enginesRunning = ic.enginesRunning;
+  trimRequested = ic.trimRequested;
+  updating = ic.updating;
+  updateSet = ic.updateSet;
+  updateValues = ic.updateValues;
+  windUpdates = ic.windUpdates;
+}
+
+//******************************************************************************
+// Records a value while a batch of updates is pending. The values that specify
+// the same quantity replace each other.
+
+bool FGInitialCondition::Defer(eUpdate idx, double value)
+{
+  if (!updating) return false;
+
+  switch(idx) {
+  case uAltitudeAGL:
+  case uAltitudeASL:
+    updateSet.reset(uAltitudeAGL);
+    updateSet.reset(uAltitudeASL);
+    break;
+  case uLatitude:
+  case uGeodLatitude:
+    updateSet.reset(uLatitude);
+    updateSet.reset(uGeodLatitude);
+    break;
+  case uUBody:
+  case uVBody:
+  case uWBody:
+    for (int i=uVNorth; i <= uVDown; i++) updateSet.reset(i);
+    updateSet.reset(uVground);
+    break;
+  case uVNorth:
+  case uVEast:
+  case uVDown:
+    for (int i=uUBody; i <= uWBody; i++) updateSet.reset(i);
+    updateSet.reset(uVground);
+    break;
+  case uVground:
+    for (int i=uUBody; i <= uVDown; i++) updateSet.reset(i);
+    [[fallthrough]];
+  case uVcalibrated:
+  case uVequivalent:
+  case uVtrue:
+  case uMach:
+    for (int i=uVground; i <= uMach; i++) updateSet.reset(i);
+    break;
+  case uFlightPathAngle:
+  case uClimbRate:
+    updateSet.reset(uFlightPathAngle);
+    updateSet.reset(uClimbRate);
+    break;
+  case uWindNorth:
+    windUpdates.clear();
+    break;
+  case uWindMag:
+  case uWindDir:
+  case uHeadWind:
+  case uCrossWind:
+  case uWindDownKts:
+    // The wind values modify each other so their order is kept.
+    if (!windUpdates.empty() && windUpdates.back().first == idx)
+      windUpdates.back().second = value;
+    else
+      windUpdates.emplace_back(idx, value);
+    return true;
+  default:
+    break;
+  }
+
+  updateValues[idx] = value;
+  updateSet.set(idx);
+  return true;
+}
+
+//******************************************************************************
+
+void FGInitialCondition::CommitUpdate(void)
+{
+  if (!updating) return;
+
+  updating = false;
+
+  auto isSet = [this](eUpdate idx) { return updateSet.test(idx); };
+  auto anySet = [this](eUpdate first, eUpdate last) {
+    for (int i=first; i <= last; i++)
+      if (updateSet.test(i)) return true;
+    return false;
+  };
+  const auto& value = updateValues;
+
+  // The position is solved once for the final longitude, latitude, terrain
+  // elevation and altitude.
+  if (anySet(uLongitude, uAltitudeASL)) {
+    bool keepAirspeed = !anySet(uVground, uMach);
+    double speed = keepAirspeed ? GetHeldAirspeed() : 0.0;
+    altitudeset altitudeSet = lastAltitudeSet;
+    double altitude = altitudeSet == setagl ? GetAltitudeAGLFtIC()
+                                            : GetAltitudeASLFtIC();
+
+    if (isSet(uAltitudeAGL)) {
+      altitudeSet = setagl;
+      altitude = value[uAltitudeAGL];
+    }
+    else if (isSet(uAltitudeASL)) {
+      altitudeSet = setasl;
+      altitude = value[uAltitudeASL];
+    }
+
+    if (isSet(uLongitude)) position.SetLongitude(value[uLongitude]);
+    if (isSet(uLatitude)) {
+      position.SetLatitude(value[uLatitude]);
+      lastLatitudeSet = setgeoc;
+    }
+    else if (isSet(uGeodLatitude)) {
+      position.SetPositionGeodetic(position.GetLongitude(),
+                                   value[uGeodLatitude], 0.);
+      lastLatitudeSet = setgeod;
+    }
+    if (isSet(uTerrainElevation))
+      fdmex->GetInertial()->SetTerrainElevation(value[uTerrainElevation]);
+
+    if (altitudeSet == setagl) {
+      MoveToAltitudeAGL(altitude);
+      if (keepAirspeed) SetHeldAirspeed(speed, GetAltitudeASLFtIC());
+    }
+    else {
+      MoveToAltitudeASL(altitude);
+      if (keepAirspeed) SetHeldAirspeed(speed, position.GetGeodAltitude());
+    }
+    lastAltitudeSet = altitudeSet;
+  }
+
+  if (anySet(uPhi, uPsi)) {
+    FGColumnVector3 vOrient = orientation.GetEuler();
+    for (int i=ePhi; i <= ePsi; i++) {
+      eUpdate idx = static_cast<eUpdate>(uPhi+i-ePhi);
+      if (isSet(idx)) vOrient(i) = value[idx];
+    }
+    SetEulerAnglesRadIC(vOrient);
+  }
+
+  // The body and the NED velocities are mutually exclusive (see Defer()).
+  if (anySet(uUBody, uWBody)) {
+    FGColumnVector3 _vUVW_BODY = orientation.GetT() * vUVW_NED;
+    for (int i=eU; i <= eW; i++) {
+      eUpdate idx = static_cast<eUpdate>(uUBody+i-eU);
+      if (isSet(idx)) _vUVW_BODY(i) = value[idx];
+    }
+    SetBodyVelFpsIC(_vUVW_BODY);
+  }
+  else if (anySet(uVNorth, uVDown)) {
+    FGColumnVector3 _vUVW_NED = vUVW_NED;
+    for (int i=eU; i <= eW; i++) {
+      eUpdate idx = static_cast<eUpdate>(uVNorth+i-eU);
+      if (isSet(idx)) _vUVW_NED(i) = value[idx];
+    }
+    SetNEDVelFpsIC(_vUVW_NED);
+  }
+
+  if (isSet(uVground)) SetVgroundFpsIC(value[uVground]);
+  if (isSet(uVcalibrated)) SetVcalibratedKtsIC(value[uVcalibrated]);
+  if (isSet(uVequivalent)) SetVequivalentKtsIC(value[uVequivalent]);
+  if (isSet(uVtrue)) SetVtrueFpsIC(value[uVtrue]);
+  if (isSet(uMach)) SetMachIC(value[uMach]);
+  if (isSet(uFlightPathAngle))
+    SetFlightPathAngleRadIC(value[uFlightPathAngle]);
+  if (isSet(uClimbRate)) SetClimbRateFpsIC(value[uClimbRate]);
+  if (isSet(uAlpha)) SetAlphaRadIC(value[uAlpha]);
+  if (isSet(uBeta)) SetBetaRadIC(value[uBeta]);
+
+  // The wind is computed first and then applied once.
+  if (isSet(uWindNorth) || !windUpdates.empty()) {
+    FGColumnVector3 _vWIND_NED = GetWindNEDFpsIC();
+    if (isSet(uWindNorth))
+      _vWIND_NED = {value[uWindNorth], value[uWindEast], value[uWindDown]};
+    for (const auto& [idx, windValue]: windUpdates)
+      _vWIND_NED = ModifyWind(_vWIND_NED, idx, windValue);
+    SetWindNEDFpsIC(_vWIND_NED);
+  }
+
+  updateSet.reset();
+  windUpdates.clear();
 }
 
 //******************************************************************************
 
 void FGInitialCondition::SetVequivalentKtsIC(double ve)
 {
+  if (Defer(uVequivalent, ve)) return;
+
   const auto Atmosphere = fdmex->GetAtmosphere();
   double altitudeASL = GetAltitudeASLFtIC();
   double rho = Atmosphere->GetDensity(altitudeASL);
@@ -166,6 +376,8 @@ void FGInitialCondition::SetVequivalentKtsIC(double ve)
 
 void FGInitialCondition::SetMachIC(double mach)
 {
+  if (Defer(uMach, mach)) return;
+
   const auto Atmosphere = fdmex->GetAtmosphere();
   double altitudeASL = GetAltitudeASLFtIC();
   double soundSpeed = Atmosphere->GetSoundSpeed(altitudeASL);
@@ -177,6 +389,8 @@ void FGInitialCondition::SetMachIC(double mach)
 
 void FGInitialCondition::SetVcalibratedKtsIC(double vcas)
 {
+  if (Defer(uVcalibrated, vcas)) return;
+
   const auto Atmosphere = fdmex->GetAtmosphere();
   double altitudeASL = GetAltitudeASLFtIC();
   double pressure = Atmosphere->GetPressure(altitudeASL);
@@ -240,6 +454,8 @@ void FGInitialCondition::calcAeroAngles(const FGColumnVector3& _vt_NED)
 
 void FGInitialCondition::SetVgroundFpsIC(double vg)
 {
+  if (Defer(uVground, vg)) return;
+
   const FGMatrix33& Tb2l = orientation.GetTInv();
   FGColumnVector3 _vt_NED = Tb2l * Tw2b * FGColumnVector3(vt, 0., 0.);
   FGColumnVector3 _vWIND_NED = _vt_NED - vUVW_NED;
@@ -264,6 +480,8 @@ void FGInitialCondition::SetVgroundFpsIC(double vg)
 
 void FGInitialCondition::SetVtrueFpsIC(double vtrue)
 {
+  if (Defer(uVtrue, vtrue)) return;
+
   const FGMatrix33& Tb2l = orientation.GetTInv();
   FGColumnVector3 _vt_NED = Tb2l * Tw2b * FGColumnVector3(vt, 0., 0.);
   FGColumnVector3 _vWIND_NED = _vt_NED - vUVW_NED;
@@ -288,6 +506,8 @@ void FGInitialCondition::SetVtrueFpsIC(double vtrue)
 
 void FGInitialCondition::SetClimbRateFpsIC(double hdot)
 {
+  if (Defer(uClimbRate, hdot)) return;
+
   if (fabs(hdot) > vt) {
     FGLogging log(fdmex->GetLogger(), LogLevel::ERROR);
     log << "The climb rate cannot be higher than the true speed.\n";
@@ -311,6 +531,15 @@ void FGInitialCondition::SetClimbRateFpsIC(double hdot)
   calcThetaBeta(alpha, _vt_NED);
 }
 
+//******************************************************************************
+
+void FGInitialCondition::SetFlightPathAngleRadIC(double gamma)
+{
+  if (Defer(uFlightPathAngle, gamma)) return;
+
+  SetClimbRateFpsIC(vt*sin(gamma));
+}
+
 //******************************************************************************
 // When the AoA is modified, we need to update the angles theta and beta to
 // keep the true airspeed amplitude, the climb rate and the heading unchanged.
@@ -318,6 +547,8 @@ void FGInitialCondition::SetClimbRateFpsIC(double hdot)
 
 void FGInitialCondition::SetAlphaRadIC(double alfa)
 {
+  if (Defer(uAlpha, alfa)) return;
+
   const FGMatrix33& Tb2l = orientation.GetTInv();
   FGColumnVector3 _vt_NED = Tb2l * Tw2b * FGColumnVector3(vt, 0., 0.);
   calcThetaBeta(alfa, _vt_NED);
@@ -345,7 +576,7 @@ void FGInitialCondition::calcThetaBeta(double alfa, const FGColumnVector3& _vt_N
                     -salpha, 0., calpha);
 
   FGColumnVector3 v0 = Tpsi * _vt_NED;
-  FGColumnVector3 n = (Talpha * Tphi).Transposed() * FGColumnVector3(0., 0., 1.);
+  FGColumnVector3 n = (Talpha * Tphi).TransposedMultiply(FGColumnVector3(0., 0., 1.));
   FGColumnVector3 y = {0., 1., 0.};
   FGColumnVector3 u = y - DotProduct(y, n) * n;
   FGColumnVector3 p = y * n;
@@ -404,6 +635,8 @@ void FGInitialCondition::calcThetaBeta(double alfa, const FGColumnVector3& _vt_N
 
 void FGInitialCondition::SetBetaRadIC(double bta)
 {
+  if (Defer(uBeta, bta)) return;
+
   const FGMatrix33& Tb2l = orientation.GetTInv();
   FGColumnVector3 _vt_NED = Tb2l * Tw2b * FGColumnVector3(vt, 0., 0.);
   FGColumnVector3 vOrient = orientation.GetEuler();
@@ -451,15 +684,27 @@ void FGInitialCondition::SetBetaRadIC(double bta)
 // Modifies the body frame orientation.
 
 void FGInitialCondition::SetEulerAngleRadIC(int idx, double angle)
+{
+  if (Defer(static_cast<eUpdate>(uPhi+idx-ePhi), angle)) return;
+
+  FGColumnVector3 vOrient = orientation.GetEuler();
+
+  vOrient(idx) = angle;
+  SetEulerAnglesRadIC(vOrient);
+}
+
+//******************************************************************************
+// Modifies the body frame orientation. The velocity in the body frame is kept
+// unchanged unless the velocity has been set in the local NED frame.
+
+void FGInitialCondition::SetEulerAnglesRadIC(const FGColumnVector3& vOrient)
 {
   const FGMatrix33& Tb2l = orientation.GetTInv();
   const FGMatrix33& Tl2b = orientation.GetT();
   FGColumnVector3 _vt_NED = Tb2l * Tw2b * FGColumnVector3(vt, 0., 0.);
   FGColumnVector3 _vWIND_NED = _vt_NED - vUVW_NED;
   FGColumnVector3 _vUVW_BODY = Tl2b * vUVW_NED;
-  FGColumnVector3 vOrient = orientation.GetEuler();
 
-  vOrient(idx) = angle;
   orientation = FGQuaternion(vOrient);
 
   if ((lastSpeedSet != setned) && (lastSpeedSet != setvg)) {
@@ -479,15 +724,24 @@ void FGInitialCondition::SetEulerAngleRadIC(int idx, double angle)
 
 void FGInitialCondition::SetBodyVelFpsIC(int idx, double vel)
 {
-  const FGMatrix33& Tb2l = orientation.GetTInv();
-  const FGMatrix33& Tl2b = orientation.GetT();
-  FGColumnVector3 _vt_NED = Tb2l * Tw2b * FGColumnVector3(vt, 0., 0.);
-  FGColumnVector3 _vUVW_BODY = Tl2b * vUVW_NED;
-  FGColumnVector3 _vWIND_NED = _vt_NED - vUVW_NED;
+  if (Defer(static_cast<eUpdate>(uUBody+idx-eU), vel)) return;
+
+  FGColumnVector3 _vUVW_BODY = orientation.GetT() * vUVW_NED;
 
   _vUVW_BODY(idx) = vel;
+  SetBodyVelFpsIC(_vUVW_BODY);
+}
+
+//******************************************************************************
+// Modifies the aircraft velocity in the body frame. The wind is kept unchanged.
+
+void FGInitialCondition::SetBodyVelFpsIC(const FGColumnVector3& _vUVW_BODY)
+{
+  const FGMatrix33& Tb2l = orientation.GetTInv();
+  FGColumnVector3 _vWIND_NED = GetWindNEDFpsIC();
+
   vUVW_NED = Tb2l * _vUVW_BODY;
-  _vt_NED = vUVW_NED + _vWIND_NED;
+  FGColumnVector3 _vt_NED = vUVW_NED + _vWIND_NED;
   vt = _vt_NED.Magnitude();
 
   calcAeroAngles(_vt_NED);
@@ -502,12 +756,24 @@ void FGInitialCondition::SetBodyVelFpsIC(int idx, double vel)
 
 void FGInitialCondition::SetNEDVelFpsIC(int idx, double vel)
 {
-  const FGMatrix33& Tb2l = orientation.GetTInv();
-  FGColumnVector3 _vt_NED = Tb2l * Tw2b * FGColumnVector3(vt, 0., 0.);
-  FGColumnVector3 _vWIND_NED = _vt_NED - vUVW_NED;
+  if (Defer(static_cast<eUpdate>(uVNorth+idx-eU), vel)) return;
 
-  vUVW_NED(idx) = vel;
-  _vt_NED = vUVW_NED + _vWIND_NED;
+  FGColumnVector3 _vUVW_NED = vUVW_NED;
+
+  _vUVW_NED(idx) = vel;
+  SetNEDVelFpsIC(_vUVW_NED);
+}
+
+//******************************************************************************
+// Modifies the aircraft velocity in the local NED frame. The wind is kept
+// unchanged.
+
+void FGInitialCondition::SetNEDVelFpsIC(const FGColumnVector3& _vUVW_NED)
+{
+  FGColumnVector3 _vWIND_NED = GetWindNEDFpsIC();
+
+  vUVW_NED = _vUVW_NED;
+  FGColumnVector3 _vt_NED = vUVW_NED + _vWIND_NED;
   vt = _vt_NED.Magnitude();
 
   calcAeroAngles(_vt_NED);
@@ -521,7 +787,21 @@ void FGInitialCondition::SetNEDVelFpsIC(int idx, double vel)
 
 void FGInitialCondition::SetWindNEDFpsIC(double wN, double wE, double wD )
 {
-  FGColumnVector3 _vt_NED = vUVW_NED + FGColumnVector3(wN, wE, wD);
+  if (updating) {
+    Defer(uWindNorth, wN);
+    Defer(uWindEast, wE);
+    Defer(uWindDown, wD);
+    return;
+  }
+
+  SetWindNEDFpsIC(FGColumnVector3(wN, wE, wD));
+}
+
+//******************************************************************************
+
+void FGInitialCondition::SetWindNEDFpsIC(const FGColumnVector3& _vWIND_NED)
+{
+  FGColumnVector3 _vt_NED = vUVW_NED + _vWIND_NED;
   vt = _vt_NED.Magnitude();
 
   calcAeroAngles(_vt_NED);
@@ -534,20 +814,9 @@ void FGInitialCondition::SetWindNEDFpsIC(double wN, double wE, double wD )
 
 void FGInitialCondition::SetCrossWindKtsIC(double cross)
 {
-  const FGMatrix33& Tb2l = orientation.GetTInv();
-  FGColumnVector3 _vt_NED = Tb2l * Tw2b * FGColumnVector3(vt, 0., 0.);
-  FGColumnVector3 _vWIND_NED = _vt_NED - vUVW_NED;
-  FGColumnVector3 _vCROSS(-orientation.GetSinEuler(ePsi), orientation.GetCosEuler(ePsi), 0.);
+  if (Defer(uCrossWind, cross)) return;
 
-  // Gram-Schmidt process is used to remove the existing cross wind component
-  _vWIND_NED -= DotProduct(_vWIND_NED, _vCROSS) * _vCROSS;
-  // Which is now replaced by the new value. The input cross wind is expected
-  // in knots, so first convert to fps, which is the internal unit used.
-  _vWIND_NED += (cross * ktstofps) * _vCROSS;
-  _vt_NED = vUVW_NED + _vWIND_NED;
-  vt = _vt_NED.Magnitude();
-
-  calcAeroAngles(_vt_NED);
+  SetWindNEDFpsIC(ModifyWind(GetWindNEDFpsIC(), uCrossWind, cross));
 }
 
 //******************************************************************************
@@ -557,25 +826,9 @@ void FGInitialCondition::SetCrossWindKtsIC(double cross)
 
 void FGInitialCondition::SetHeadWindKtsIC(double head)
 {
-  const FGMatrix33& Tb2l = orientation.GetTInv();
-  FGColumnVector3 _vt_NED = Tb2l * Tw2b * FGColumnVector3(vt, 0., 0.);
-  FGColumnVector3 _vWIND_NED = _vt_NED - vUVW_NED;
-  // This is a head wind, so the direction vector for the wind
-  // needs to be set opposite to the heading the aircraft
-  // is taking. So, the cos and sin of the heading (psi)
-  // are negated in the line below.
-  FGColumnVector3 _vHEAD(-orientation.GetCosEuler(ePsi), -orientation.GetSinEuler(ePsi), 0.);
-
-  // Gram-Schmidt process is used to remove the existing head wind component
-  _vWIND_NED -= DotProduct(_vWIND_NED, _vHEAD) * _vHEAD;
-  // Which is now replaced by the new value. The input head wind is expected
-  // in knots, so first convert to fps, which is the internal unit used.
-  _vWIND_NED += (head * ktstofps) * _vHEAD;
-  _vt_NED = vUVW_NED + _vWIND_NED;
-
-  vt = _vt_NED.Magnitude();
+  if (Defer(uHeadWind, head)) return;
 
-  calcAeroAngles(_vt_NED);
+  SetWindNEDFpsIC(ModifyWind(GetWindNEDFpsIC(), uHeadWind, head));
 }
 
 //******************************************************************************
@@ -585,13 +838,9 @@ void FGInitialCondition::SetHeadWindKtsIC(double head)
 
 void FGInitialCondition::SetWindDownKtsIC(double wD)
 {
-  const FGMatrix33& Tb2l = orientation.GetTInv();
-  FGColumnVector3 _vt_NED = Tb2l * Tw2b * FGColumnVector3(vt, 0., 0.);
+  if (Defer(uWindDownKts, wD)) return;
 
-  _vt_NED(eW) = vUVW_NED(eW) + wD * ktstofps;
-  vt = _vt_NED.Magnitude();
-
-  calcAeroAngles(_vt_NED);
+  SetWindNEDFpsIC(ModifyWind(GetWindNEDFpsIC(), uWindDownKts, wD));
 }
 
 //******************************************************************************
@@ -601,23 +850,9 @@ void FGInitialCondition::SetWindDownKtsIC(double wD)
 
 void FGInitialCondition::SetWindMagKtsIC(double mag)
 {
-  const FGMatrix33& Tb2l = orientation.GetTInv();
-  FGColumnVector3 _vt_NED = Tb2l * Tw2b * FGColumnVector3(vt, 0., 0.);
-  FGColumnVector3 _vWIND_NED = _vt_NED - vUVW_NED;
-  FGColumnVector3 _vHEAD(_vWIND_NED(eU), _vWIND_NED(eV), 0.);
-  double windMag = _vHEAD.Magnitude();
-
-  if (windMag > 0.001)
-    _vHEAD *= (mag*ktstofps) / windMag;
-  else
-    _vHEAD = {mag*ktstofps, 0., 0.};
-
-  _vWIND_NED(eU) = _vHEAD(eU);
-  _vWIND_NED(eV) = _vHEAD(eV);
-  _vt_NED = vUVW_NED + _vWIND_NED;
-  vt = _vt_NED.Magnitude();
+  if (Defer(uWindMag, mag)) return;
 
-  calcAeroAngles(_vt_NED);
+  SetWindNEDFpsIC(ModifyWind(GetWindNEDFpsIC(), uWindMag, mag));
 }
 
 //******************************************************************************
@@ -627,24 +862,83 @@ void FGInitialCondition::SetWindMagKtsIC(double mag)
 
 void FGInitialCondition::SetWindDirDegIC(double dir)
 {
-  const FGMatrix33& Tb2l = orientation.GetTInv();
-  FGColumnVector3 _vt_NED = Tb2l * Tw2b * FGColumnVector3(vt, 0., 0.);
-  FGColumnVector3 _vWIND_NED = _vt_NED - vUVW_NED;
-  double mag = _vWIND_NED.Magnitude(eU, eV);
-  FGColumnVector3 _vHEAD(mag*cos(dir*degtorad), mag*sin(dir*degtorad), 0.);
+  if (Defer(uWindDir, dir)) return;
 
-  _vWIND_NED(eU) = _vHEAD(eU);
-  _vWIND_NED(eV) = _vHEAD(eV);
-  _vt_NED = vUVW_NED + _vWIND_NED;
-  vt = _vt_NED.Magnitude();
+  SetWindNEDFpsIC(ModifyWind(GetWindNEDFpsIC(), uWindDir, dir));
+}
 
-  calcAeroAngles(_vt_NED);
+//******************************************************************************
+// Returns the wind in the local NED frame once modified by one of the wind
+// setters. The heading of the aircraft is used for the head and cross winds.
+
+FGColumnVector3 FGInitialCondition::ModifyWind(FGColumnVector3 _vWIND_NED,
+                                               eUpdate idx, double value) const
+{
+  switch(idx) {
+  case uCrossWind:
+    {
+      FGColumnVector3 _vCROSS(-orientation.GetSinEuler(ePsi), orientation.GetCosEuler(ePsi), 0.);
+
+      // Gram-Schmidt process is used to remove the existing cross wind component
+      _vWIND_NED -= DotProduct(_vWIND_NED, _vCROSS) * _vCROSS;
+      // Which is now replaced by the new value. The input cross wind is expected
+      // in knots, so first convert to fps, which is the internal unit used.
+      _vWIND_NED += (value * ktstofps) * _vCROSS;
+    }
+    break;
+  case uHeadWind:
+    {
+      // This is a head wind, so the direction vector for the wind
+      // needs to be set opposite to the heading the aircraft
+      // is taking. So, the cos and sin of the heading (psi)
+      // are negated in the line below.
+      FGColumnVector3 _vHEAD(-orientation.GetCosEuler(ePsi), -orientation.GetSinEuler(ePsi), 0.);
+
+      // Gram-Schmidt process is used to remove the existing head wind component
+      _vWIND_NED -= DotProduct(_vWIND_NED, _vHEAD) * _vHEAD;
+      // Which is now replaced by the new value. The input head wind is expected
+      // in knots, so first convert to fps, which is the internal unit used.
+      _vWIND_NED += (value * ktstofps) * _vHEAD;
+    }
+    break;
+  case uWindDownKts:
+    _vWIND_NED(eW) = value * ktstofps;
+    break;
+  case uWindMag:
+    {
+      FGColumnVector3 _vHEAD(_vWIND_NED(eU), _vWIND_NED(eV), 0.);
+      double windMag = _vHEAD.Magnitude();
+
+      if (windMag > 0.001)
+        _vHEAD *= (value*ktstofps) / windMag;
+      else
+        _vHEAD = {value*ktstofps, 0., 0.};
+
+      _vWIND_NED(eU) = _vHEAD(eU);
+      _vWIND_NED(eV) = _vHEAD(eV);
+    }
+    break;
+  case uWindDir:
+    {
+      double mag = _vWIND_NED.Magnitude(eU, eV);
+
+      _vWIND_NED(eU) = mag*cos(value*degtorad);
+      _vWIND_NED(eV) = mag*sin(value*degtorad);
+    }
+    break;
+  default:
+    break;
+  }
+
+  return _vWIND_NED;
 }
 
 //******************************************************************************
 
 void FGInitialCondition::SetTerrainElevationFtIC(double elev)
 {
+  if (Defer(uTerrainElevation, elev)) return;
+
   double agl = GetAltitudeAGLFtIC();
   fdmex->GetInertial()->SetTerrainElevation(elev);
 
@@ -683,16 +977,20 @@ double FGInitialCondition::GetTerrainElevationFtIC(void) const
 
 void FGInitialCondition::SetAltitudeAGLFtIC(double agl)
 {
-  const auto Atmosphere = fdmex->GetAtmosphere();
-  double altitudeASL = GetAltitudeASLFtIC();
-  double pressure = Atmosphere->GetPressure(altitudeASL);
-  double soundSpeed = Atmosphere->GetSoundSpeed(altitudeASL);
-  double rho = Atmosphere->GetDensity(altitudeASL);
+  if (Defer(uAltitudeAGL, agl)) return;
 
-  double mach0 = vt / soundSpeed;
-  double vc0 = Auxiliary->VcalibratedFromMach(mach0, pressure);
-  double ve0 = vt * sqrt(rho/FGAtmosphere::StdDaySLdensity);
+  double speed = GetHeldAirspeed();
+  MoveToAltitudeAGL(agl);
+  SetHeldAirspeed(speed, GetAltitudeASLFtIC());
+  lastAltitudeSet = setagl;
+}
+
+//******************************************************************************
+// Moves the position vertically to the altitude AGL. The airspeed is left
+// unchanged.
 
+void FGInitialCondition::MoveToAltitudeAGL(double agl)
+{
   switch(lastLatitudeSet) {
   case setgeod:
     fdmex->GetInertial()->SetAltitudeAGL(position, agl);
@@ -725,27 +1023,6 @@ void FGInitialCondition::SetAltitudeAGLFtIC(double agl)
     break;
   }
 
-  altitudeASL = GetAltitudeASLFtIC();
-  soundSpeed = Atmosphere->GetSoundSpeed(altitudeASL);
-  rho = Atmosphere->GetDensity(altitudeASL);
-  pressure = Atmosphere->GetPressure(altitudeASL);
-
-  switch(lastSpeedSet) {
-    case setvc:
-      mach0 = Auxiliary->MachFromVcalibrated(vc0, pressure);
-      SetVtrueFpsIC(mach0 * soundSpeed);
-      break;
-    case setmach:
-      SetVtrueFpsIC(mach0 * soundSpeed);
-      break;
-    case setve:
-      SetVtrueFpsIC(ve0 * sqrt(FGAtmosphere::StdDaySLdensity/rho));
-      break;
-    default: // Make the compiler stop complaining about missing enums
-      break;
-  }
-
-  lastAltitudeSet = setagl;
 }
 
 //******************************************************************************
@@ -755,16 +1032,20 @@ void FGInitialCondition::SetAltitudeAGLFtIC(double agl)
 
 void FGInitialCondition::SetAltitudeASLFtIC(double alt)
 {
-  const auto Atmosphere = fdmex->GetAtmosphere();
-  double altitudeASL = GetAltitudeASLFtIC();
-  double pressure = Atmosphere->GetPressure(altitudeASL);
-  double soundSpeed = Atmosphere->GetSoundSpeed(altitudeASL);
-  double rho = Atmosphere->GetDensity(altitudeASL);
+  if (Defer(uAltitudeASL, alt)) return;
 
-  double mach0 = vt / soundSpeed;
-  double vc0 = Auxiliary->VcalibratedFromMach(mach0, pressure);
-  double ve0 = vt * sqrt(rho/FGAtmosphere::StdDaySLdensity);
+  double speed = GetHeldAirspeed();
+  MoveToAltitudeASL(alt);
+  SetHeldAirspeed(speed, position.GetGeodAltitude());
+  lastAltitudeSet = setasl;
+}
 
+//******************************************************************************
+// Moves the position vertically to the altitude ASL. The airspeed is left
+// unchanged.
+
+void FGInitialCondition::MoveToAltitudeASL(double alt)
+{
   switch(lastLatitudeSet) {
   case setgeod:
     {
@@ -829,33 +1110,66 @@ void FGInitialCondition::SetAltitudeASLFtIC(double alt)
     break;
   }
 
-  altitudeASL = position.GetGeodAltitude();
-  soundSpeed = Atmosphere->GetSoundSpeed(altitudeASL);
-  rho = Atmosphere->GetDensity(altitudeASL);
-  pressure = Atmosphere->GetPressure(altitudeASL);
+}
+
+//******************************************************************************
+// Returns the airspeed that an altitude change must keep: the calibrated or
+// the equivalent airspeed (in ft/s) or the Mach number, depending on the last
+// airspeed set.
+
+double FGInitialCondition::GetHeldAirspeed(void) const
+{
+  const auto Atmosphere = fdmex->GetAtmosphere();
+  double altitudeASL = GetAltitudeASLFtIC();
+  double mach0 = vt / Atmosphere->GetSoundSpeed(altitudeASL);
+
+  switch(lastSpeedSet) {
+  case setvc:
+    return Auxiliary->VcalibratedFromMach(mach0,
+                                          Atmosphere->GetPressure(altitudeASL));
+  case setve:
+    return vt * sqrt(Atmosphere->GetDensity(altitudeASL)/FGAtmosphere::StdDaySLdensity);
+  default:
+    return mach0;
+  }
+}
+
+//******************************************************************************
+// Modifies the true airspeed so that the airspeed returned by GetHeldAirspeed()
+// is kept at the altitude ASL.
+
+void FGInitialCondition::SetHeldAirspeed(double speed, double altitudeASL)
+{
+  const auto Atmosphere = fdmex->GetAtmosphere();
 
   switch(lastSpeedSet) {
     case setvc:
-      mach0 = Auxiliary->MachFromVcalibrated(vc0, pressure);
-      SetVtrueFpsIC(mach0 * soundSpeed);
+      {
+        double pressure = Atmosphere->GetPressure(altitudeASL);
+        double mach0 = Auxiliary->MachFromVcalibrated(speed, pressure);
+        SetVtrueFpsIC(mach0 * Atmosphere->GetSoundSpeed(altitudeASL));
+      }
       break;
     case setmach:
-      SetVtrueFpsIC(mach0 * soundSpeed);
+      SetVtrueFpsIC(speed * Atmosphere->GetSoundSpeed(altitudeASL));
       break;
     case setve:
-      SetVtrueFpsIC(ve0 * sqrt(FGAtmosphere::StdDaySLdensity/rho));
+      {
+        double rho = Atmosphere->GetDensity(altitudeASL);
+        SetVtrueFpsIC(speed * sqrt(FGAtmosphere::StdDaySLdensity/rho));
+      }
       break;
     default: // Make the compiler stop complaining about missing enums
       break;
   }
-
-  lastAltitudeSet = setasl;
 }
 
 //******************************************************************************
 
 void FGInitialCondition::SetGeodLatitudeRadIC(double geodLatitude)
 {
+  if (Defer(uGeodLatitude, geodLatitude)) return;
+
   double lon = position.GetLongitude();
   lastLatitudeSet = setgeod;
 
@@ -882,6 +1196,8 @@ void FGInitialCondition::SetGeodLatitudeRadIC(double geodLatitude)
 
 void FGInitialCondition::SetLatitudeRadIC(double lat)
 {
+  if (Defer(uLatitude, lat)) return;
+
   double altitude;
 
   lastLatitudeSet = setgeoc;
@@ -904,6 +1220,8 @@ void FGInitialCondition::SetLatitudeRadIC(double lat)
 
 void FGInitialCondition::SetLongitudeRadIC(double lon)
 {
+  if (Defer(uLongitude, lon)) return;
+
   double altitude;
 
   switch(lastAltitudeSet) {
@@ -1015,6 +1333,9 @@ bool FGInitialCondition::Load(const SGPath& rstfile, bool useAircraftPath)
     init_file_name = rstfile;
   }
 
+  // The pending updates are applied before the file overrides them.
+  CommitUpdate();
+
   FGXMLFileRead XMLFileRead;
   Element* document = XMLFileRead.LoadXMLDocument(init_file_name);
 
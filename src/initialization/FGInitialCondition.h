@@ -47,7 +47,11 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <array>
+#include <bitset>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "math/FGLocation.h"
 #include "math/FGQuaternion.h"
@@ -285,7 +289,7 @@ public:
   /** Sets the flight path angle initial condition in degrees.
       @param gamma Flight path angle in degrees  */
   void SetFlightPathAngleDegIC(double gamma)
-  { SetClimbRateFpsIC(vt*sin(gamma*degtorad)); }
+  { SetFlightPathAngleRadIC(gamma*degtorad); }
 
   /** Sets the altitude above sea level initial condition in feet.
       @param altitudeASL Altitude above sea level in feet */
@@ -573,8 +577,7 @@ public:
 
   /** Sets the initial flight path angle.
       @param gamma Initial flight path angle in radians */
-  void SetFlightPathAngleRadIC(double gamma)
-  { SetClimbRateFpsIC(vt*sin(gamma)); }
+  void SetFlightPathAngleRadIC(double gamma);
 
   /** Sets the initial angle of attack.
       @param alpha Initial angle of attack in radians */
@@ -687,6 +690,54 @@ public:
   /** Initialize the initial conditions to default values */
   void InitializeIC(void);
 
+  /** Starts a batch of updates. Until CommitUpdate() is called, the setters
+      only record their value and the getters keep returning the initial
+      conditions as they were before the batch started. This avoids the
+      recomputation of the dependent quantities (airspeeds, aerodynamic
+      angles, altitudes) each time a value is set. */
+  void BeginUpdate(void) { updating = true; }
+
+  /** Applies the values recorded since BeginUpdate() in a single pass. The
+      position (longitude, latitude, terrain elevation and altitude) is
+      solved once and the airspeed that the altitude change must keep is
+      restored once. The velocity components set in the body frame are
+      applied together, and so are those set in the local NED frame.
+      The values are then applied in the order used by the initialization
+      files (see Load()): position, orientation, velocities, airspeed, flight
+      path angle, alpha, beta and finally the wind.
+
+      When several values specify the same quantity only the last one set is
+      applied:
+      - the altitude AGL and ASL,
+      - the geocentric and geodetic latitudes,
+      - the flight path angle and the climb rate,
+      - the ground speed, the calibrated, equivalent and true airspeeds and
+        the Mach number,
+      - the velocity in the body frame, the velocity in the local NED frame
+        and the ground speed.
+
+      An airspeed (calibrated, equivalent, true or Mach) is always applied
+      after the velocity components whatever the order in which they are set:
+      the components give the direction of the airspeed and the airspeed its
+      magnitude.
+
+      The wind values modify each other so they are applied in the order in
+      which they are set, as the setters would have done. Setting the wind in
+      the local NED frame discards the wind values set before it. */
+  void CommitUpdate(void);
+
+  /** Checks if a batch of updates is pending.
+      @return true if BeginUpdate() has been called and CommitUpdate() has
+              not been called yet. */
+  bool IsUpdating(void) const { return updating; }
+
+  /** Copies the initial conditions of another instance. The executive to
+      which this instance belongs is left unchanged.
+      A batch of updates pending in \a ic is copied as well and is applied
+      by the next call to CommitUpdate().
+      @param ic the initial conditions to copy */
+  void CopyFrom(const FGInitialCondition& ic);
+
   void bind(FGPropertyManager* pm);
 
 private:
@@ -708,6 +759,20 @@ private:
   unsigned int enginesRunning;
   int trimRequested;
 
+  /// The values that can be recorded by a batch of updates, in the order in
+  /// which CommitUpdate() applies them.
+  enum eUpdate {uLongitude, uLatitude, uGeodLatitude, uTerrainElevation,
+                uAltitudeAGL, uAltitudeASL, uPhi, uTheta, uPsi, uUBody, uVBody,
+                uWBody, uVNorth, uVEast, uVDown, uVground, uVcalibrated,
+                uVequivalent, uVtrue, uMach, uFlightPathAngle, uClimbRate,
+                uAlpha, uBeta, uWindNorth, uWindEast, uWindDown, uWindMag,
+                uWindDir, uHeadWind, uCrossWind, uWindDownKts, uNumUpdates};
+  bool updating;
+  std::bitset<uNumUpdates> updateSet;
+  std::array<double, uNumUpdates> updateValues;
+  /// The wind values other than the NED wind, in the order they were set.
+  std::vector<std::pair<eUpdate, double>> windUpdates;
+
   FGFDMExec *fdmex;
   std::shared_ptr<FGAircraft> Aircraft;
   std::shared_ptr<FGAuxiliary> Auxiliary;
@@ -715,9 +780,20 @@ private:
   bool Load_v1(Element* document);
   bool Load_v2(Element* document);
 
+  bool Defer(eUpdate idx, double value);
   void SetEulerAngleRadIC(int idx, double angle);
+  void SetEulerAnglesRadIC(const FGColumnVector3& vOrient);
   void SetBodyVelFpsIC(int idx, double vel);
+  void SetBodyVelFpsIC(const FGColumnVector3& _vUVW_BODY);
   void SetNEDVelFpsIC(int idx, double vel);
+  void SetNEDVelFpsIC(const FGColumnVector3& _vUVW_NED);
+  void SetWindNEDFpsIC(const FGColumnVector3& _vWIND_NED);
+  FGColumnVector3 ModifyWind(FGColumnVector3 _vWIND_NED, eUpdate idx,
+                             double value) const;
+  void MoveToAltitudeAGL(double agl);
+  void MoveToAltitudeASL(double alt);
+  double GetHeldAirspeed(void) const;
+  void SetHeldAirspeed(double speed, double altitudeASL);
   double GetBodyWindFpsIC(int idx) const;
   double GetBodyVelFpsIC(int idx) const;
   void calcAeroAngles(const FGColumnVector3& _vt_BODY);
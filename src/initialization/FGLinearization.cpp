@@ -23,10 +23,14 @@
 
 namespace JSBSim {
 
-FGLinearization::FGLinearization(FGFDMExec * fdm)
+FGLinearization::FGLinearization(FGFDMExec * fdm, unsigned int threads, bool central,
+                                 bool aero_partials)
     : aircraft_name(fdm->GetAircraft()->GetAircraftName())
 {
     FGStateSpace ss(fdm);
+    ss.setThreads(threads);
+    ss.setAeroPartials(aero_partials);
+    if (central) ss.setDifference(FGStateSpace::eCentral);
     ss.x.add(new FGStateSpace::Vt);
     ss.x.add(new FGStateSpace::Alpha);
     ss.x.add(new FGStateSpace::Theta);
@@ -45,8 +45,16 @@ class JSBSIM_API FGLinearization
 public:
     /**
      * @param fdmPtr Already configured FGFDMExec instance used to create the new linear model.
+     * @param threads Number of threads that compute the matrices, 0 to use all the cores.
+     *                Each additional thread runs a clone of fdmPtr.
+     * @param central Use central differences instead of the five point stencil.
+     *                They are less accurate but run the model half as many times.
+     * @param aero_partials Replace the aerodynamics by their first order
+     *                expansion while the jacobians are computed (see
+     *                FGStateSpace::setAeroPartials).
      */
-    FGLinearization(FGFDMExec * fdmPtr);
+    FGLinearization(FGFDMExec * fdmPtr, unsigned int threads = 1, bool central = false,
+                    bool aero_partials = false);
 
     /**
      * Write Scicoslab source file with the state space model to a
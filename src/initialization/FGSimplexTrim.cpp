@@ -16,7 +16,12 @@
  * with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <ctime>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <thread>
 
 #include "FGTrim.h"
 #include "FGSimplexTrim.h"
@@ -26,7 +31,11 @@ namespace JSBSim {
 
 FGSimplexTrim::FGSimplexTrim(FGFDMExec * fdm, TrimMode mode)
 {
-    std::clock_t time_start=clock(), time_trimDone;
+    auto time_start = std::chrono::steady_clock::now();
+
+    // The constraints are read from the pending updates of the initial
+    // conditions.
+    fdm->GetIC()->CommitUpdate();
 
     // variables
     FGTrimmer::Constraints constraints;
@@ -38,15 +47,17 @@ FGSimplexTrim::FGSimplexTrim(FGFDMExec * fdm, TrimMode mode)
 
     // defaults
     std::string aircraftName = fdm->GetAircraft()->GetAircraftName();
-    FGPropertyNode* node = fdm->GetPropertyManager()->GetNode();
-    double rtol = node->GetDouble("trim/solver/rtol");
-    double abstol = node->GetDouble("trim/solver/abstol");
-    double speed = node->GetDouble("trim/solver/speed"); // must be > 1, 2 typical
-    double random = node->GetDouble("trim/solver/random");
-    int iterMax = node->GetInt("trim/solver/iterMax");
-    bool showConvergence = node->GetBool("trim/solver/showConvergence");
-    bool pause = node->GetBool("trim/solver/pause");
-    bool showSimplex = node->GetBool("trim/solver/showSimplex");
+    SGPropertyNode* node = fdm->GetPropertyManager()->GetNode();
+    double rtol = node->getDoubleValue("trim/solver/rtol");
+    double abstol = node->getDoubleValue("trim/solver/abstol");
+    double speed = node->getDoubleValue("trim/solver/speed"); // must be > 1, 2 typical
+    double random = node->getDoubleValue("trim/solver/random");
+    int iterMax = node->getIntValue("trim/solver/iterMax");
+    bool showConvergence = node->getBoolValue("trim/solver/showConvergence");
+    bool pause = node->getBoolValue("trim/solver/pause");
+    bool showSimplex = node->getBoolValue("trim/solver/showSimplex");
+    int threads = node->getIntValue("trim/solver/threads"); // 0 for all the cores
+    int starts = std::max(node->getIntValue("trim/solver/starts"), 1);
 
     // flight conditions
     double phi = fdm->GetIC()->GetPhiRadIC();
@@ -66,55 +77,146 @@ FGSimplexTrim::FGSimplexTrim(FGFDMExec * fdm, TrimMode mode)
     int n = 6;
     std::vector<double> initialGuess(n), lowerBound(n), upperBound(n), initialStepSize(n);
 
-    lowerBound[0] = node->GetDouble("trim/solver/throttleMin");
-    lowerBound[1] = node->GetDouble("trim/solver/elevatorMin");
-    lowerBound[2] = node->GetDouble("trim/solver/alphaMin");
-    lowerBound[3] = node->GetDouble("trim/solver/aileronMin");
-    lowerBound[4] = node->GetDouble("trim/solver/rudderMin");
-    lowerBound[5] = node->GetDouble("trim/solver/betaMin");
-
-    upperBound[0] = node->GetDouble("trim/solver/throttleMax");
-    upperBound[1] = node->GetDouble("trim/solver/elevatorMax");
-    upperBound[2] = node->GetDouble("trim/solver/alphaMax");
-    upperBound[3] = node->GetDouble("trim/solver/aileronMax");
-    upperBound[4] = node->GetDouble("trim/solver/rudderMax");
-    upperBound[5] = node->GetDouble("trim/solver/betaMax");
-
-    initialStepSize[0] = node->GetDouble("trim/solver/throttleStep");
-    initialStepSize[1] = node->GetDouble("trim/solver/elevatorStep");
-    initialStepSize[2] = node->GetDouble("trim/solver/alphaStep");
-    initialStepSize[3] = node->GetDouble("trim/solver/aileronStep");
-    initialStepSize[4] = node->GetDouble("trim/solver/rudderStep");
-    initialStepSize[5] = node->GetDouble("trim/solver/betaStep");
-
-    initialGuess[0] = node->GetDouble("trim/solver/throttleGuess");
-    initialGuess[1] = node->GetDouble("trim/solver/elevatorGuess");
-    initialGuess[2] = node->GetDouble("trim/solver/alphaGuess");
-    initialGuess[3] = node->GetDouble("trim/solver/aileronGuess");
-    initialGuess[4] = node->GetDouble("trim/solver/rudderGuess");
-    initialGuess[5] = node->GetDouble("trim/solver/betaGuess");
+    lowerBound[0] = node->getDoubleValue("trim/solver/throttleMin");
+    lowerBound[1] = node->getDoubleValue("trim/solver/elevatorMin");
+    lowerBound[2] = node->getDoubleValue("trim/solver/alphaMin");
+    lowerBound[3] = node->getDoubleValue("trim/solver/aileronMin");
+    lowerBound[4] = node->getDoubleValue("trim/solver/rudderMin");
+    lowerBound[5] = node->getDoubleValue("trim/solver/betaMin");
+
+    upperBound[0] = node->getDoubleValue("trim/solver/throttleMax");
+    upperBound[1] = node->getDoubleValue("trim/solver/elevatorMax");
+    upperBound[2] = node->getDoubleValue("trim/solver/alphaMax");
+    upperBound[3] = node->getDoubleValue("trim/solver/aileronMax");
+    upperBound[4] = node->getDoubleValue("trim/solver/rudderMax");
+    upperBound[5] = node->getDoubleValue("trim/solver/betaMax");
+
+    initialStepSize[0] = node->getDoubleValue("trim/solver/throttleStep");
+    initialStepSize[1] = node->getDoubleValue("trim/solver/elevatorStep");
+    initialStepSize[2] = node->getDoubleValue("trim/solver/alphaStep");
+    initialStepSize[3] = node->getDoubleValue("trim/solver/aileronStep");
+    initialStepSize[4] = node->getDoubleValue("trim/solver/rudderStep");
+    initialStepSize[5] = node->getDoubleValue("trim/solver/betaStep");
+
+    initialGuess[0] = node->getDoubleValue("trim/solver/throttleGuess");
+    initialGuess[1] = node->getDoubleValue("trim/solver/elevatorGuess");
+    initialGuess[2] = node->getDoubleValue("trim/solver/alphaGuess");
+    initialGuess[3] = node->getDoubleValue("trim/solver/aileronGuess");
+    initialGuess[4] = node->getDoubleValue("trim/solver/rudderGuess");
+    initialGuess[5] = node->getDoubleValue("trim/solver/betaGuess");
 
     // solve
-    FGTrimmer * trimmer = new FGTrimmer(fdm, &constraints);
-    Callback callback(aircraftName, trimmer);
-    FGNelderMead * solver = NULL;
+    FGTrimmer trimmer(fdm, &constraints);
+    Callback callback(aircraftName, &trimmer);
+
+    // The first start is run from the initial guess by the FDM itself. The
+    // other starts are run from random guesses within one step of the
+    // initial guess, each by a clone of the FDM, and the best solution is
+    // kept. The starts are run in parallel and the vertices of each simplex
+    // are evaluated in sequence. The random generator of each simplex is
+    // seeded with the index of its start so the results are reproducible.
+    std::vector< std::vector<double> > guesses(starts, initialGuess);
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> offset(-1.0, 1.0);
+    for (int k=1; k<starts; k++) {
+        for (int i=0; i<n; i++) {
+            guesses[k][i] += initialStepSize[i]*offset(generator);
+            FGTrimmer::limit(lowerBound[i], upperBound[i], guesses[k][i]);
+        }
+    }
 
-    solver = new FGNelderMead(trimmer,initialGuess,
-        lowerBound, upperBound, initialStepSize,iterMax,rtol,
-        abstol,speed,random,showConvergence,showSimplex,pause,&callback);
-    while(solver->status()==1) solver->update();
-    time_trimDone = std::clock();
+    struct Start {
+        std::unique_ptr<FGFDMExec> fdm;
+        std::unique_ptr<FGTrimmer> trimmer;
+        std::vector<double> solution;
+        double cost = 0.0;
+        int status = 1;
+        std::exception_ptr error;
+    };
+    std::vector<Start> results(starts);
+    for (int k=1; k<starts; k++) {
+        results[k].fdm = fdm->Clone();
+        if (!results[k].fdm) {
+            results.resize(k);
+            break;
+        }
+        results[k].fdm->GetIC()->CopyFrom(*fdm->GetIC());
+        results[k].trimmer = std::make_unique<FGTrimmer>(results[k].fdm.get(), &constraints);
+    }
+    trimmer.setThreads(results.size() > 1 ? 1 : std::max(threads, 0));
+
+    auto search = [&](size_t k) {
+        Start & result = results[k];
+        FGTrimmer * f = k == 0 ? &trimmer : result.trimmer.get();
+        FGNelderMead solver(f, guesses[k], lowerBound, upperBound,
+            initialStepSize, iterMax, rtol, abstol, speed, random,
+            showConvergence && k == 0, showSimplex && k == 0, pause && k == 0,
+            k == 0 ? &callback : nullptr, static_cast<unsigned int>(k));
+        try {
+            while(solver.status()==1) solver.update();
+        } catch (...) {
+            result.error = std::current_exception();
+        }
+        result.status = solver.status();
+        result.solution = solver.getSolution();
+        result.cost = solver.getSolutionCost();
+    };
+
+    unsigned int nThreads = threads > 0 ? threads : std::max(1U, std::thread::hardware_concurrency());
+    nThreads = std::min(nThreads, static_cast<unsigned int>(results.size()));
+    std::atomic<size_t> next{1};
+    auto work = [&]() {
+        for (size_t k = next++; k < results.size(); k = next++) search(k);
+    };
+    std::vector<std::thread> pool;
+    try {
+        for (unsigned int i=1; i<nThreads; i++) pool.emplace_back(work);
+    } catch (const std::system_error&) {
+        // Threads are not available on this platform (WebAssembly for
+        // instance): the remaining starts are run by the calling thread.
+    }
+    search(0);
+    work();
+    for (auto & t : pool) t.join();
+
+    // The best converged start is kept. When no start has converged, the
+    // error of the first start is reported as it would be without the
+    // other starts.
+    size_t best = 0;
+    for (size_t k=1; k<results.size(); k++) {
+        if (results[k].status != 0) continue;
+        if (results[best].status != 0 || results[k].cost < results[best].cost)
+            best = k;
+    }
+    if (results[best].error) std::rethrow_exception(results[best].error);
+
+    unsigned int evaluations = 0;
+    double evalTime = 0.0;
+    for (size_t k=0; k<results.size(); k++) {
+        FGTrimmer * f = k == 0 ? &trimmer : results[k].trimmer.get();
+        evaluations += f->getEvaluations();
+        evalTime += f->getEvalTime();
+    }
+
+    // leave the FDM in the trimmed state
+    if (results.size() > 1) trimmer.eval(results[best].solution);
+    double time_trimDone = std::chrono::duration<double>(std::chrono::steady_clock::now() - time_start).count();
+
+    // The time spent in the FDM is summed over the starts: with several
+    // threads, it can exceed the computation time.
+    node->setIntValue("trim/solver/evaluations", evaluations);
+    node->setDoubleValue("trim/solver/fdm-time-sec", evalTime);
+    node->setDoubleValue("trim/solver/total-time-sec", time_trimDone);
 
     // output
     if (fdm->GetDebugLevel() > 0) {
         FGLogging log(fdm->GetLogger(), LogLevel::DEBUG);
-        trimmer->printSolution(solver->getSolution());
-        log << "\nfinal cost: " << std::scientific << std::setw(10) << trimmer->eval(solver->getSolution()) << "\n";
-        log << "\ntrim computation time: " << (time_trimDone - time_start)/double(CLOCKS_PER_SEC) << "s \n\n";
+        trimmer.printSolution(results[best].solution);
+        log << "\nfinal cost: " << std::scientific << std::setw(10) << trimmer.eval(results[best].solution) << "\n";
+        log << "\nbest start: " << best << " of " << results.size() << "\n";
+        log << "\nevaluations: " << evaluations << ", time in the FDM: " << std::fixed << evalTime << "s \n";
+        log << "\ntrim computation time: " << time_trimDone << "s \n\n";
     }
-
-    delete solver;
-    delete trimmer;
 }
 
 } // JSBSim
@@ -34,6 +34,12 @@
 
 namespace JSBSim {
 
+// Trims the aircraft with the Nelder-Mead simplex method. The solver is set up
+// with the properties trim/solver/...; trim/solver/starts runs several
+// searches in parallel from random guesses around the initial one and keeps
+// the best solution. The number of evaluations and the time spent in the FDM
+// and in the whole trim are returned in trim/solver/evaluations,
+// trim/solver/fdm-time-sec and trim/solver/total-time-sec.
 class FGSimplexTrim
 {
 public:
@@ -64,9 +70,13 @@ private:
         virtual ~Callback() {
             _outputFile.close();
         }
+        void eval(const std::vector<double> &, double cost)
+        {
+            _outputFile << cost << "\n";
+        }
         void eval(const std::vector<double> &v)
         {
-            _outputFile << _trimmer->eval(v) << std::endl;
+            _outputFile << _trimmer->eval(v) << "\n";
             // FGLogging log(_trimmer->getFdm()->GetLogger(), LogLevel::INFO);
             //log << "v: ";
             //for (int i=0;i<v.size();i++) log << v[i] << " ";
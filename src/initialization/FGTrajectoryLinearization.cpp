@@ -0,0 +1,327 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGTrajectoryLinearization.cpp
+ Date started: 10/17/26
+ Purpose:      Linearize an aircraft at regular intervals along its trajectory
+ Called by:    User
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+This class copies the state of the FDM to clones at regular intervals and
+linearizes the clones in background threads. The models are written to a
+binary file in the order of their times.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/17/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <system_error>
+
+#include "FGTrajectoryLinearization.h"
+#include "FGInitialCondition.h"
+#include "FGLinearization.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+static const char magic[] = "JSBLTV01";
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGTrajectoryLinearization::FGTrajectoryLinearization(FGFDMExec* fdm,
+                                                     double dt,
+                                                     const SGPath& path,
+                                                     unsigned int threads,
+                                                     bool use_central)
+  : fdmex(fdm), interval(dt), start_time(fdm->GetSimTime()),
+    central(use_central), file(path)
+{
+  if (interval <= 0.0)
+    throw BaseException("FGTrajectoryLinearization: the interval must be "
+                        "positive.");
+
+  output.open(file, ios::out | ios::binary | ios::trunc);
+  if (!output.is_open())
+    throw BaseException("FGTrajectoryLinearization: could not open the file "
+                        + file.utf8Str());
+
+  if (threads == 0) threads = max(1U, thread::hardware_concurrency());
+
+  // The clones are created before the threads are started because
+  // FGFDMExec::Clone() modifies the debug level shared by all the instances.
+  // One more clone than threads so that the next state can be copied while
+  // all the threads are busy.
+  for (unsigned int i=0; i <= threads; i++) {
+    auto clone = fdmex->Clone();
+    if (!clone)
+      throw BaseException("FGTrajectoryLinearization: could not clone the "
+                          "FDM.");
+    idle.push_back(clone.get());
+    clones.push_back(move(clone));
+  }
+
+  try {
+    for (unsigned int i=0; i < threads; i++)
+      workers.emplace_back(&FGTrajectoryLinearization::Work, this);
+  } catch (const system_error&) {
+    // Threads are not available on this platform (WebAssembly for instance):
+    // the models are computed by the calling thread.
+  }
+
+  clones.resize(workers.size() + 1);
+  idle.resize(clones.size());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGTrajectoryLinearization::~FGTrajectoryLinearization()
+{
+  Stop();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrajectoryLinearization::Update(void)
+{
+  // Half a time step of tolerance so that the rounding errors of the
+  // simulation time do not delay the linearization by a frame.
+  double elapsed = fdmex->GetSimTime() - start_time + 0.5*fdmex->GetDeltaT();
+  if (elapsed < 0.0) return;
+
+  size_t step = static_cast<size_t>(floor(elapsed / interval));
+  if (requested > 0 && step < next_step) return;
+
+  next_step = step + 1;
+  Linearize();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrajectoryLinearization::Linearize(void)
+{
+  FGFDMExec* clone = nullptr;
+  {
+    unique_lock<mutex> lock(jobs_mutex);
+    changed.wait(lock, [this] { return error || !idle.empty(); });
+    if (error) rethrow_exception(error);
+
+    clone = idle.back();
+    idle.pop_back();
+  }
+
+  // The clone is idle: it is not used by the background threads.
+  clone->CopyState(*fdmex);
+
+  Job job {requested++, fdmex->GetSimTime(), clone};
+
+  if (workers.empty()) {
+    Process(job);
+    lock_guard<mutex> lock(jobs_mutex);
+    if (error) rethrow_exception(error);
+    return;
+  }
+
+  lock_guard<mutex> lock(jobs_mutex);
+  jobs.push_back(job);
+  changed.notify_all();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGTrajectoryLinearization::Run(void)
+{
+  Update();
+  while (fdmex->Run())
+    Update();
+  Finish();
+
+  return requested;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrajectoryLinearization::Finish(void)
+{
+  unique_lock<mutex> lock(jobs_mutex);
+  changed.wait(lock, [this] { return error || written == requested; });
+  if (error) rethrow_exception(error);
+  output.flush();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGTrajectoryLinearization::GetWritten(void) const
+{
+  lock_guard<mutex> lock(jobs_mutex);
+  return written;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrajectoryLinearization::Work(void)
+{
+  for (;;) {
+    Job job;
+    {
+      unique_lock<mutex> lock(jobs_mutex);
+      changed.wait(lock, [this] { return stopping || !jobs.empty(); });
+      if (jobs.empty()) return;
+      job = jobs.front();
+      jobs.pop_front();
+    }
+
+    Process(job);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Computes a model and makes its clone available again. An exception is kept
+// to be rethrown by the calling thread.
+
+void FGTrajectoryLinearization::Process(const Job& job)
+{
+  exception_ptr failure;
+  try {
+    Compute(job);
+  } catch (...) {
+    failure = current_exception();
+  }
+
+  lock_guard<mutex> lock(jobs_mutex);
+  if (failure && !error) error = failure;
+  idle.push_back(job.fdm);
+  changed.notify_all();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrajectoryLinearization::Compute(const Job& job)
+{
+  FGLinearization lin(job.fdm, 1, central);
+
+  vector<double> record {job.time};
+  auto append = [&record](const vector<double>& v) {
+    record.insert(record.end(), v.begin(), v.end());
+  };
+  auto append_matrix = [&append](const Vector2D<double>& M) {
+    for (auto& row: M) append(row);
+  };
+  append(lin.GetInitialState());
+  append(lin.GetInitialInput());
+  append(lin.GetInitialOutput());
+  append_matrix(lin.GetSystemMatrix());
+  append_matrix(lin.GetInputMatrix());
+  append_matrix(lin.GetOutputMatrix());
+  append_matrix(lin.GetFeedforwardMatrix());
+
+  lock_guard<mutex> lock(jobs_mutex);
+  if (!header_written) WriteHeader(lin);
+  if (record.size() != 1 + nx + nu + ny + (nx + ny)*(nx + nu))
+    throw BaseException("FGTrajectoryLinearization: the size of the model "
+                        "has changed.");
+
+  finished[job.index] = move(record);
+  WriteFinished();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrajectoryLinearization::WriteHeader(const FGLinearization& lin)
+{
+  nx = lin.GetStateNames().size();
+  nu = lin.GetInputNames().size();
+  ny = lin.GetOutputNames().size();
+
+  auto write_size = [this](size_t size) {
+    uint32_t n = static_cast<uint32_t>(size);
+    output.write(reinterpret_cast<const char*>(&n), sizeof(n));
+  };
+  auto write_strings = [&](const vector<string>& strings) {
+    for (auto& s: strings) {
+      write_size(s.size());
+      output.write(s.data(), s.size());
+    }
+  };
+
+  output.write(magic, sizeof(magic)-1);
+  write_size(nx);
+  write_size(nu);
+  write_size(ny);
+  write_strings(lin.GetStateNames());
+  write_strings(lin.GetStateUnits());
+  write_strings(lin.GetInputNames());
+  write_strings(lin.GetInputUnits());
+  write_strings(lin.GetOutputNames());
+  write_strings(lin.GetOutputUnits());
+  header_written = true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Writes the models that follow the last written one. The models computed
+// ahead of an unfinished one are kept until it is finished.
+
+void FGTrajectoryLinearization::WriteFinished(void)
+{
+  for (auto it = finished.find(written); it != finished.end();
+       it = finished.find(written)) {
+    const vector<double>& record = it->second;
+    output.write(reinterpret_cast<const char*>(record.data()),
+                 record.size()*sizeof(double));
+    finished.erase(it);
+    written++;
+  }
+
+  if (!output.good())
+    throw BaseException("FGTrajectoryLinearization: could not write the file "
+                        + file.utf8Str());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrajectoryLinearization::Stop(void)
+{
+  {
+    lock_guard<mutex> lock(jobs_mutex);
+    stopping = true;
+    changed.notify_all();
+  }
+
+  // The threads compute the pending models before they exit.
+  for (auto& worker: workers)
+    worker.join();
+  workers.clear();
+
+  output.close();
+}
+}
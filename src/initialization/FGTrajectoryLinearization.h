@@ -0,0 +1,182 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGTrajectoryLinearization.h
+ Date started: 10/17/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/17/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGTRAJECTORYLINEARIZATION_H
+#define FGTRAJECTORYLINEARIZATION_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "JSBSim_API.h"
+#include "simgear/io/iostreams/sgstream.hxx"
+#include "simgear/misc/sg_path.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGFDMExec;
+class FGLinearization;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Linearizes an aircraft at regular intervals along its trajectory.
+    The result is a linear time varying (LTV) model: the sequence of the state
+    space models computed by FGLinearization at each linearization time.
+
+    The FDM is linearized each time Update() is called and the simulation
+    time has reached the next multiple of the interval (counted from the
+    time at which this object has been created). The FDM itself is not
+    linearized: its state is copied to a clone (see FGFDMExec::Clone and
+    FGFDMExec::CopyState) which is linearized by a background thread while
+    the FDM goes on. The clones are created by the constructor and reused
+    from a linearization to the next. When all the clones are busy, Update()
+    waits for one of them.
+
+    The models are streamed to a binary file, in the order of the
+    linearization times whichever thread has computed them. The file starts
+    with the 8 characters "JSBLTV01", followed by the number of states,
+    inputs and outputs (nx, nu, ny) as 32 bits unsigned integers, then the
+    names and the units of the states, of the inputs and of the outputs
+    (each string is its length as a 32 bits unsigned integer followed by its
+    characters). Each model is then a record of 64 bits floats: the time, x0,
+    u0, y0 and the matrices A, B, C and D in row major order. The numbers are
+    written in the byte order of the machine. The file can be read in Python
+    with jsbsim.load_ltv_model().
+
+    @code
+    fdmex->LoadScript(SGPath("scripts/c1723.xml"));
+    fdmex->RunIC();
+    FGTrajectoryLinearization ltv(fdmex, 1.0, SGPath("c1723.ltv"), 0);
+    ltv.Run();
+    @endcode
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGTrajectoryLinearization
+{
+public:
+  /** Constructor.
+      @param fdmex    the FDM, initialized with RunIC().
+      @param interval the time between two linearizations (s).
+      @param file     the file to which the models are written.
+      @param threads  the number of background threads that compute the
+                      models, 0 to use all the cores. Each thread runs a
+                      clone of the FDM.
+      @param central  use central differences (see FGLinearization). */
+  FGTrajectoryLinearization(FGFDMExec* fdmex, double interval,
+                            const SGPath& file, unsigned int threads=1,
+                            bool central=false);
+
+  /// Destructor. The pending models are still written to the file.
+  ~FGTrajectoryLinearization();
+
+  /** Linearizes the FDM if the simulation time has reached the next
+      linearization time. This method is meant to be called after each
+      frame. */
+  void Update(void);
+
+  /// Linearizes the FDM at the current simulation time.
+  void Linearize(void);
+
+  /** Runs the script loaded in the FDM until its end, calling Update()
+      after each frame, then waits for all the models.
+      @return the number of models. */
+  size_t Run(void);
+
+  /** Waits until all the requested models have been written to the file.
+      An exception thrown by a background thread is rethrown here. */
+  void Finish(void);
+
+  /// Returns the number of linearizations requested so far.
+  size_t GetRequested(void) const { return requested; }
+  /// Returns the number of models written to the file so far.
+  size_t GetWritten(void) const;
+
+private:
+  struct Job {
+    size_t index;
+    double time;
+    FGFDMExec* fdm;
+  };
+
+  FGFDMExec* fdmex;
+  double interval;
+  double start_time;
+  bool central;
+  size_t requested = 0;
+  size_t next_step = 0;
+
+  sg_ofstream output;
+  SGPath file;
+  bool header_written = false;
+  size_t nx = 0, nu = 0, ny = 0;
+
+  // The members below are protected by the mutex.
+  mutable std::mutex jobs_mutex;
+  std::condition_variable changed;
+  std::vector<std::unique_ptr<FGFDMExec>> clones;
+  std::vector<FGFDMExec*> idle;
+  std::deque<Job> jobs;
+  std::map<size_t, std::vector<double>> finished;
+  size_t written = 0;
+  bool stopping = false;
+  std::exception_ptr error;
+  std::vector<std::thread> workers;
+
+  void Work(void);
+  void Process(const Job& job);
+  void Compute(const Job& job);
+  void WriteHeader(const FGLinearization& lin);
+  void WriteFinished(void);
+  void Stop(void);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
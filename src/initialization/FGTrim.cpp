@@ -47,6 +47,7 @@ INCLUDES
 #include "models/FGAccelerations.h"
 #include "models/FGMassBalance.h"
 #include "models/FGFCS.h"
+#include "models/FGAerodynamics.h"
 #include "input_output/FGLog.h"
 
 #if _MSC_VER
@@ -71,8 +72,14 @@ FGTrim::FGTrim(FGFDMExec *FDMExec,TrimMode tt)
 
   Debug=0;DebugLevel=0;
   fdmex=FDMExec;
+  // The setters called by the trim axes would otherwise be deferred by the
+  // batch of updates that the copy below inherits.
+  fdmex->GetIC()->CommitUpdate();
   fgic = *fdmex->GetIC();
   total_its=0;
+  runs=0;
+  solver=tAxisByAxis;
+  aero_partials=false;
   gamma_fallback=false;
   mode=tt;
   xlo=xhi=alo=ahi=0.0;
@@ -130,12 +137,31 @@ void FGTrim::Report(void) {
 void FGTrim::ClearStates(void) {
     mode=tCustom;
     TrimAxes.clear();
+    initial_controls.clear();
     //FGLogging log(fdmex->GetLogger(), LogLevel::INFO);
     //log << "TrimAxes.size(): " << TrimAxes.size() << "\n";
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+unsigned int FGTrim::runCount(void) {
+  unsigned int count = 0;
+  for (auto& axis: TrimAxes)
+    count += axis.GetRunCount();
+  return count;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<double> FGTrim::GetControls(void) {
+  vector<double> controls;
+  for (auto& axis: TrimAxes)
+    controls.push_back(axis.GetControl());
+  return controls;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGTrim::AddState( State state, Control control ) {
   mode = tCustom;
   vector <FGTrimAxis>::iterator iAxes = TrimAxes.begin();
@@ -195,7 +221,7 @@ bool FGTrim::EditState( State state, Control new_control ){
 bool FGTrim::DoTrim(void) {
   bool trim_failed=false;
   unsigned int N = 0;
-  unsigned int axis_count = 0;
+  unsigned int runs0 = runCount();
   auto FCS = fdmex->GetFCS();
   auto GroundReactions = fdmex->GetGroundReactions();
   vector<double> throttle0 = FCS->GetThrottleCmd();
@@ -227,6 +253,11 @@ bool FGTrim::DoTrim(void) {
     TrimAxes[2].SetControlLimits(phi - 30.0 * degtorad, phi + 30.0 * degtorad);
   }
 
+  // The initial controls are searched with findInterval() rather than over
+  // the whole range of the controls.
+  bool warm_start = !initial_controls.empty()
+                    && initial_controls.size() == TrimAxes.size();
+
   //clear the sub iterations counts & zero out the controls
   for(unsigned int current_axis=0;current_axis<TrimAxes.size();current_axis++) {
     //FGLogging log(fdmex->GetLogger(), LogLevel::INFO);
@@ -234,12 +265,15 @@ bool FGTrim::DoTrim(void) {
     //<< "  " << TrimAxes[current_axis]->GetControlName()<< "\n";
     xlo=TrimAxes[current_axis].GetControlMin();
     xhi=TrimAxes[current_axis].GetControlMax();
-    TrimAxes[current_axis].SetControl((xlo+xhi)/2);
+    if (warm_start)
+      TrimAxes[current_axis].SetControl(Constrain(xlo, initial_controls[current_axis], xhi));
+    else
+      TrimAxes[current_axis].SetControl((xlo+xhi)/2);
     TrimAxes[current_axis].Run();
     //TrimAxes[current_axis].AxisReport();
     sub_iterations[current_axis]=0;
     successful[current_axis]=0;
-    solution[current_axis]=false;
+    solution[current_axis]=warm_start;
   }
 
   if(mode == tPullup ) {
@@ -254,6 +288,66 @@ bool FGTrim::DoTrim(void) {
     //TrimAxes[0].SetStateTarget(targetNlf);
   }
 
+  if (solver == tLevenbergMarquardt)
+    trim_failed = !solveLM(N);
+  else
+    trim_failed = !solveAxes(N);
+
+  // The run counts restart from zero when an axis is replaced by the gamma
+  // fallback.
+  runs = runCount();
+  if (runs >= runs0) runs -= runs0;
+
+  if(!trim_failed) {
+    total_its=N;
+    if (debug_lvl > 0) {
+      FGLogging log(fdmex->GetLogger(), LogLevel::DEBUG);
+      log << "\n  Trim successful\n";
+    }
+  } else { // The trim has failed
+    total_its=N;
+
+    // Restore the aircraft parameters to their initial values
+    fdmex->GetIC()->CommitUpdate();
+    fgic = *fdmex->GetIC();
+    FCS->SetDeCmd(elevator0);
+    FCS->SetDaCmd(aileron0);
+    FCS->SetDrCmd(rudder0);
+    FCS->SetPitchTrimCmd(PitchTrim0);
+    for (unsigned int i=0; i < throttle0.size(); i++)
+      FCS->SetThrottleCmd(i, throttle0[i]);
+
+    fdmex->Initialize(&fgic);
+    fdmex->Run();
+
+    // If WOW is true we must make sure there are no gears into the ground.
+    if (GroundReactions->GetWOW())
+      trimOnGround();
+
+    if (debug_lvl > 0) {
+      FGLogging log(fdmex->GetLogger(), LogLevel::DEBUG);
+      log << "\n  Trim failed\n";
+    }
+  }
+
+  fdmex->GetPropagate()->InitializeDerivatives();
+  fdmex->ResumeIntegration();
+  fdmex->SetTrimStatus(false);
+
+  for(int i=0;i < GroundReactions->GetNumGearUnits();i++)
+    GroundReactions->GetGearUnit(i)->SetReport(true);
+
+  return !trim_failed;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Solves the axes one at a time, each of them being adjusted while the others
+// are frozen, until they are all in tolerance.
+
+bool FGTrim::solveAxes(unsigned int& N) {
+  bool trim_failed=false;
+  unsigned int axis_count = 0;
+
   do {
     axis_count=0;
     for(unsigned int current_axis=0;current_axis<TrimAxes.size();current_axis++) {
@@ -323,45 +417,166 @@ bool FGTrim::DoTrim(void) {
       trim_failed=true;
   } while((axis_count < TrimAxes.size()) && (!trim_failed));
 
-  if((!trim_failed) && (axis_count >= TrimAxes.size())) {
-    total_its=N;
-    if (debug_lvl > 0) {
-      FGLogging log(fdmex->GetLogger(), LogLevel::DEBUG);
-      log << "\n  Trim successful\n";
+  return !trim_failed;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Solves the linear system A.x = b by Gaussian elimination with partial
+// pivoting. A is a n x n row-major matrix and the solution is returned in b.
+
+static bool solveLinearSystem(vector<double>& A, vector<double>& b, size_t n)
+{
+  for (size_t k=0; k < n; k++) {
+    size_t pivot = k;
+    for (size_t i=k+1; i < n; i++)
+      if (fabs(A[i*n+k]) > fabs(A[pivot*n+k])) pivot = i;
+    if (A[pivot*n+k] == 0.0) return false;
+
+    if (pivot != k) {
+      for (size_t j=0; j < n; j++) swap(A[k*n+j], A[pivot*n+j]);
+      swap(b[k], b[pivot]);
     }
-  } else { // The trim has failed
-    total_its=N;
 
-    // Restore the aircraft parameters to their initial values
-    fgic = *fdmex->GetIC();
-    FCS->SetDeCmd(elevator0);
-    FCS->SetDaCmd(aileron0);
-    FCS->SetDrCmd(rudder0);
-    FCS->SetPitchTrimCmd(PitchTrim0);
-    for (unsigned int i=0; i < throttle0.size(); i++)
-      FCS->SetThrottleCmd(i, throttle0[i]);
+    for (size_t i=k+1; i < n; i++) {
+      double factor = A[i*n+k] / A[k*n+k];
+      for (size_t j=k; j < n; j++) A[i*n+j] -= factor*A[k*n+j];
+      b[i] -= factor*b[k];
+    }
+  }
 
-    fdmex->Initialize(&fgic);
-    fdmex->Run();
+  for (size_t k=n; k-- > 0;) {
+    for (size_t j=k+1; j < n; j++) b[k] -= A[k*n+j]*b[j];
+    b[k] /= A[k*n+k];
+  }
 
-    // If WOW is true we must make sure there are no gears into the ground.
-    if (GroundReactions->GetWOW())
-      trimOnGround();
+  return true;
+}
 
-    if (debug_lvl > 0) {
-      FGLogging log(fdmex->GetLogger(), LogLevel::DEBUG);
-      log << "\n  Trim failed\n";
-    }
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Solves all the axes simultaneously with the Levenberg-Marquardt algorithm.
+// The controls are normalized by their range and the states by their
+// tolerance so that the trim is achieved when all the residuals are within
+// [-1, 1]. The jacobian is computed by forward differences and each
+// iteration runs the model (number of axes + 1) times when the step is
+// accepted. When SetAeroPartials() is enabled, the aerodynamics are replaced
+// by their first order expansion while the jacobian is computed so that their
+// derivatives are the analytic ones (see FGAerodynamics::Linearize) unless a
+// function cannot be differentiated.
+
+bool FGTrim::solveLM(unsigned int& N) {
+  auto Aerodynamics = fdmex->GetAerodynamics();
+  const size_t n = TrimAxes.size();
+  const double h = 1E-2; // Step of the finite differences (normalized)
+  const double max_step = 0.2; // Largest change of a control (normalized)
+  vector<double> u(n), r(n), range(n), umin(n), umax(n);
+  vector<double> u_try(n), r_try(n), J(n*n), A(n*n), g(n), du(n);
+  double lambda = 1E-3;
+
+  for (size_t i=0; i < n; i++) {
+    range[i] = TrimAxes[i].GetControlMax() - TrimAxes[i].GetControlMin();
+    if (range[i] <= 0.0) range[i] = 1.0;
+    umin[i] = TrimAxes[i].GetControlMin() / range[i];
+    umax[i] = TrimAxes[i].GetControlMax() / range[i];
+    u[i] = TrimAxes[i].GetControl() / range[i];
   }
 
-  fdmex->GetPropagate()->InitializeDerivatives();
-  fdmex->ResumeIntegration();
-  fdmex->SetTrimStatus(false);
+  // Sets the controls, runs the model and returns the sum of the squared
+  // residuals.
+  auto evaluate = [&](const vector<double>& controls, vector<double>& residuals) {
+    for (size_t i=0; i < n; i++) {
+      TrimAxes[i].SetControl(controls[i]*range[i]);
+      if (i+1 < n) TrimAxes[i].ApplyControl();
+    }
+    updateRates();
+    TrimAxes[n-1].Run();
 
-  for(int i=0;i < GroundReactions->GetNumGearUnits();i++)
-    GroundReactions->GetGearUnit(i)->SetReport(true);
+    double cost = 0.0;
+    for (size_t i=0; i < n; i++) {
+      residuals[i] = TrimAxes[i].GetState() / TrimAxes[i].GetTolerance();
+      cost += residuals[i]*residuals[i];
+    }
+    return cost;
+  };
+
+  auto inTolerance = [&](const vector<double>& residuals) {
+    for (double ri: residuals)
+      if (fabs(ri) > 1.0) return false;
+    return true;
+  };
+
+  double cost = evaluate(u, r);
+
+  for (N=0; N < max_iterations; N++) {
+    if (inTolerance(r)) return true;
+
+    // The model has last been run with the controls u.
+    if (aero_partials) Aerodynamics->Linearize();
+    try {
+      for (size_t j=0; j < n; j++) {
+        u_try = u;
+        double step = u[j] + h <= umax[j] ? h : -h;
+        u_try[j] += step;
+        evaluate(u_try, r_try);
+        for (size_t i=0; i < n; i++)
+          J[i*n+j] = (r_try[i] - r[i]) / step;
+      }
+    } catch (...) {
+      Aerodynamics->ClearLinearization();
+      throw;
+    }
+    Aerodynamics->ClearLinearization();
 
-  return !trim_failed;
+    // Gradient and Gauss-Newton approximation of the hessian of the cost.
+    for (size_t i=0; i < n; i++) {
+      g[i] = 0.0;
+      for (size_t k=0; k < n; k++) g[i] += J[k*n+i]*r[k];
+    }
+
+    bool accepted = false;
+    while (!accepted) {
+      for (size_t i=0; i < n; i++) {
+        for (size_t j=0; j < n; j++) {
+          double Hij = 0.0;
+          for (size_t k=0; k < n; k++) Hij += J[k*n+i]*J[k*n+j];
+          A[i*n+j] = Hij;
+        }
+        A[i*n+i] += lambda*(A[i*n+i] + 1E-9);
+        du[i] = -g[i];
+      }
+
+      if (solveLinearSystem(A, du, n)) {
+        for (size_t i=0; i < n; i++)
+          u_try[i] = Constrain(umin[i], u[i] + Constrain(-max_step, du[i], max_step),
+                               umax[i]);
+
+        double cost_try = evaluate(u_try, r_try);
+        if (Debug > 1) {
+          FGLogging log(fdmex->GetLogger(), LogLevel::DEBUG);
+          log << "FGTrim::solveLM N,lambda,cost: " << N << ", " << lambda
+              << ", " << cost_try << "\n";
+        }
+
+        if (cost_try < cost) {
+          u = u_try;
+          r = r_try;
+          cost = cost_try;
+          lambda = max(lambda / 10.0, 1E-9);
+          accepted = true;
+          continue;
+        }
+      }
+
+      lambda *= 10.0;
+      if (lambda > 1E10) {
+        // The cost can no longer be decreased: the controls are restored to
+        // the best solution found so far.
+        evaluate(u, r);
+        return false;
+      }
+    }
+  }
+
+  return inTolerance(r);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -67,6 +67,8 @@ class FGFDMExec;
 typedef enum { tLongitudinal=0, tFull, tGround, tPullup,
                tCustom, tTurn, tNone } TrimMode;
 
+typedef enum { tAxisByAxis=0, tLevenbergMarquardt } TrimSolver;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -94,6 +96,17 @@ CLASS DOCUMENTATION
     The remaining modes include <b>tCustom</b>, which is completely user defined and
     <b>tNone</b>.
 
+    Two solvers are available for all the modes:
+    - tAxisByAxis (the default) adjusts one control at a time while the others
+      are frozen, and cycles through the axes until they are all in tolerance.
+    - tLevenbergMarquardt adjusts all the controls simultaneously with a damped
+      Newton method. The jacobian of the states with respect to the controls
+      is computed by finite differences. It usually needs fewer runs of the
+      model and handles the coupling between the axes better, but it does not
+      implement the gamma fallback. With SetAeroPartials(), the aerodynamics
+      are replaced by their first order expansion (see
+      FGAerodynamics::Linearize) while the jacobian is computed.
+
     Note that trims can (and do) fail for reasons that are completely outside
     the control of the trimming routine itself. The most common problem is the
     initial conditions: is the model capable of steady state flight
@@ -131,9 +144,13 @@ class JSBSIM_API FGTrim : public FGJSBBase
   double Tolerance, A_Tolerance;
   std::vector<double> sub_iterations, successful;
   std::vector<bool> solution;
+  std::vector<double> initial_controls;
   unsigned int max_sub_iterations;
   unsigned int max_iterations;
   unsigned int total_its;
+  unsigned int runs;
+  TrimSolver solver;
+  bool aero_partials;
   bool gamma_fallback;
   int solutionDomain;
   double xlo,xhi,alo,ahi;
@@ -146,6 +163,9 @@ class JSBSIM_API FGTrim : public FGJSBBase
   FGInitialCondition fgic;
 
   bool solve(FGTrimAxis& axis);
+  bool solveAxes(unsigned int& N);
+  bool solveLM(unsigned int& N);
+  unsigned int runCount(void);
 
   /** @return false if there is no change in the current axis accel
       between accel(control_min) and accel(control_max). If there is a
@@ -288,6 +308,43 @@ public:
   inline void SetTargetNlf(double nlf) { targetNlf=nlf; }
   inline double GetTargetNlf(void) { return targetNlf; }
 
+  /** Set the values from which the controls start. By default, each control
+      starts from the middle of its range and its solution is first searched
+      over the whole range. When the initial values are given, the solution is
+      searched in an interval growing around them which is faster when they
+      are close to the solution (such as the controls of a neighboring flight
+      condition).
+      @param controls values of the controls, in the order of the trim axes.
+                      An empty vector restores the default. The values are
+                      ignored if the trim axes are modified.
+  */
+  inline void SetInitialControls(const std::vector<double>& controls) {
+    initial_controls = controls;
+  }
+
+  /** Get the values of the controls, in the order of the trim axes. */
+  std::vector<double> GetControls(void);
+
+  /** Get the number of iterations of the last trim. */
+  inline unsigned int GetIterations(void) const { return total_its; }
+
+  /** Get the number of runs of the model needed by the last trim. */
+  inline unsigned int GetRuns(void) const { return runs; }
+
+  /** Select the solver.
+      @param s tAxisByAxis or tLevenbergMarquardt */
+  inline void SetSolver(TrimSolver s) { solver = s; }
+  inline TrimSolver GetSolver(void) const { return solver; }
+
+  /** Replace the aerodynamics by their first order expansion while the
+      tLevenbergMarquardt solver computes its jacobian. This removes the noise
+      of the finite differences of the aerodynamics but it does not save any
+      run of the model, and the expansion is itself computed at each
+      iteration. Disabled by default.
+      @param enable true to use the analytic partials of the aerodynamics */
+  inline void SetAeroPartials(bool enable) { aero_partials = enable; }
+  inline bool GetAeroPartials(void) const { return aero_partials; }
+
 };
 }
 
@@ -105,6 +105,8 @@ public:
   double GetState(void) { getState(); return state_value; }
   //Accels are not settable
   inline void SetControl(double value ) { control_value=value; }
+  /// Applies the control value to the model without running it.
+  inline void ApplyControl(void) { setControl(); }
   inline double GetControl(void) { return control_value; }
 
   inline State GetStateType(void) { return state; }
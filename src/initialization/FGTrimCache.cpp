@@ -0,0 +1,296 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGTrimCache.cpp
+ Date started: 10/17/26
+ Purpose:      Cache the trim solutions to warm start the next trims
+ Called by:    FGFDMExec
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+This class stores the controls of the successful trims, keyed by the flight
+condition, and starts the next trims from the nearest solution.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/17/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#include "FGTrimCache.h"
+#include "FGFDMExec.h"
+#include "initialization/FGInitialCondition.h"
+#include "models/FGFCS.h"
+#include "models/FGMassBalance.h"
+#include "input_output/FGLog.h"
+#include "input_output/FGPropertyManager.h"
+#include "simgear/io/iostreams/sgstream.hxx"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Quantization steps of the altitude (ft), the calibrated airspeed (kts), the
+// flight path angle (deg), the weight (lbs), the location of the CG (inches)
+// and the commands of the flaps and of the gear.
+static const double quantum[] = {100.0, 1.0, 0.1, 10.0, 0.1, 0.01, 0.01};
+static const size_t key_size = sizeof(quantum) / sizeof(quantum[0]);
+
+static const char* header = "aircraft,mode,h-sl-ft,vc-kts,gamma-deg,weight-lbs,"
+                            "cg-x-in,flaps-cmd,gear-cmd,iterations,runs,controls";
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGTrimCache::FGTrimCache(const SGPath& path)
+  : file(path)
+{
+  if (!file.isNull()) Load();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimCache::Bind(FGPropertyManager* pm, const string& path)
+{
+  pm->Tie(path + "/entries", this, &FGTrimCache::GetEntryCount);
+  pm->Tie(path + "/lookups", this, &FGTrimCache::GetLookups);
+  pm->Tie(path + "/hits", this, &FGTrimCache::GetHits);
+  pm->Tie(path + "/hit-rate", this, &FGTrimCache::GetHitRate);
+  pm->Tie(path + "/warm-starts", this, &FGTrimCache::GetWarmStarts);
+  pm->Tie(path + "/saved-iterations", this, &FGTrimCache::GetSavedIterations);
+  pm->Tie(path + "/saved-runs", this, &FGTrimCache::GetSavedRuns);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<long long> FGTrimCache::GetKey(FGFDMExec* fdmex)
+{
+  auto IC = fdmex->GetIC();
+  auto MassBalance = fdmex->GetMassBalance();
+  auto FCS = fdmex->GetFCS();
+  const double condition[] = { IC->GetAltitudeASLFtIC(),
+                               IC->GetVcalibratedKtsIC(),
+                               IC->GetFlightPathAngleDegIC(),
+                               MassBalance->GetWeight(),
+                               MassBalance->GetXYZcg(FGJSBBase::eX),
+                               FCS->GetDfCmd(),
+                               FCS->GetGearCmd() };
+
+  vector<long long> key(key_size);
+  for (size_t i=0; i < key_size; i++)
+    key[i] = llround(condition[i] / quantum[i]);
+
+  return key;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the index of the nearest solution for the same aircraft, the same
+// mode and the same number of controls, or -1 if there is none.
+
+int FGTrimCache::Find(const string& aircraft, int mode,
+                      const vector<long long>& key, size_t controls,
+                      long long& distance) const
+{
+  int nearest = -1;
+  distance = numeric_limits<long long>::max();
+
+  for (size_t i=0; i < entries.size(); i++) {
+    const Entry& entry = entries[i];
+    if (entry.mode != mode || entry.controls.size() != controls
+        || entry.aircraft != aircraft)
+      continue;
+
+    long long d = 0;
+    for (size_t j=0; j < key_size; j++) {
+      long long delta = entry.key[j] - key[j];
+      d += delta*delta;
+    }
+    if (d < distance) {
+      distance = d;
+      nearest = static_cast<int>(i);
+    }
+  }
+
+  return nearest;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTrimCache::Trim(FGFDMExec* fdmex, FGTrim& trim, TrimMode mode)
+{
+  Entry solution;
+  solution.aircraft = fdmex->GetModelName();
+  solution.mode = mode;
+  solution.key = GetKey(fdmex);
+
+  long long distance;
+  int nearest = Find(solution.aircraft, mode, solution.key,
+                     trim.GetControls().size(), distance);
+  lookups++;
+
+  bool success = false;
+  unsigned int iterations = 0, runs = 0;
+
+  if (nearest >= 0) {
+    // The entry is copied as the cache is modified below.
+    Entry start = entries[nearest];
+    if (distance == 0) hits++;
+    warm_starts++;
+
+    trim.SetInitialControls(start.controls);
+    success = trim.DoTrim();
+    iterations = trim.GetIterations();
+    runs = trim.GetRuns();
+
+    if (success) {
+      saved_iterations += static_cast<int>(start.iterations) - static_cast<int>(iterations);
+      saved_runs += static_cast<int>(start.runs) - static_cast<int>(runs);
+      solution.iterations = start.iterations;
+      solution.runs = start.runs;
+    }
+    else {
+      // The trim is run again from the default controls. The cost of the
+      // failed attempt is accounted as negative savings.
+      saved_iterations -= static_cast<int>(iterations);
+      saved_runs -= static_cast<int>(runs);
+      trim.SetInitialControls(vector<double>());
+    }
+  }
+
+  if (!success) {
+    success = trim.DoTrim();
+    solution.iterations = trim.GetIterations();
+    solution.runs = trim.GetRuns();
+  }
+
+  if (success) {
+    solution.controls = trim.GetControls();
+    if (!Store(solution)) {
+      FGLogging log(fdmex->GetLogger(), LogLevel::WARN);
+      log << "Could not write the trim cache file " << file.utf8Str() << "\n";
+    }
+  }
+
+  return success;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTrimCache::Store(const Entry& entry)
+{
+  long long distance;
+  int i = Find(entry.aircraft, entry.mode, entry.key, entry.controls.size(),
+               distance);
+
+  if (i >= 0 && distance == 0)
+    entries[i] = entry;
+  else
+    entries.push_back(entry);
+
+  return file.isNull() || Save();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimCache::Clear(void)
+{
+  entries.clear();
+  lookups = hits = warm_starts = 0;
+  saved_iterations = saved_runs = 0;
+
+  if (!file.isNull()) Save();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// A cache file that cannot be read is ignored: it is overwritten when the next
+// solution is stored.
+
+void FGTrimCache::Load(void)
+{
+  sg_ifstream input(file);
+  if (!input.is_open()) return;
+
+  string line;
+  if (!getline(input, line) || line != header) return;
+
+  vector<Entry> cached;
+  while (getline(input, line)) {
+    if (line.empty()) continue;
+
+    istringstream row(line);
+    Entry entry;
+    string field;
+    vector<double> values;
+
+    if (!getline(row, entry.aircraft, ',')) return;
+    while (getline(row, field, ',')) {
+      try {
+        values.push_back(stod(field));
+      } catch (const logic_error&) {
+        return;
+      }
+    }
+    if (values.size() < key_size + 3) return;
+
+    entry.mode = static_cast<int>(values[0]);
+    for (size_t i=0; i < key_size; i++)
+      entry.key.push_back(llround(values[i+1] / quantum[i]));
+    entry.iterations = static_cast<unsigned int>(values[key_size+1]);
+    entry.runs = static_cast<unsigned int>(values[key_size+2]);
+    entry.controls.assign(values.begin() + key_size + 3, values.end());
+    cached.push_back(entry);
+  }
+
+  entries = cached;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTrimCache::Save(void) const
+{
+  sg_ofstream output(file, ios::out | ios::trunc);
+  if (!output.is_open()) return false;
+
+  output << header << "\n";
+  for (auto& entry: entries) {
+    output << entry.aircraft << "," << entry.mode << setprecision(12);
+    for (size_t i=0; i < key_size; i++)
+      output << "," << entry.key[i] * quantum[i];
+    output << "," << entry.iterations << "," << entry.runs
+           << setprecision(numeric_limits<double>::max_digits10);
+    for (double control: entry.controls)
+      output << "," << control;
+    output << "\n";
+  }
+
+  return output.good();
+}
+}
@@ -0,0 +1,174 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGTrimCache.h
+ Date started: 10/17/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/17/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGTRIMCACHE_H
+#define FGTRIMCACHE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <string>
+#include <vector>
+
+#include "FGTrim.h"
+#include "simgear/misc/sg_path.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGFDMExec;
+class FGPropertyManager;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Caches the solutions of the trims to warm start the next ones.
+    The solutions are keyed by the name of the aircraft model, the trim mode
+    and the flight condition: the altitude, the calibrated airspeed, the flight
+    path angle, the weight, the longitudinal location of the CG and the
+    commands of the flaps and of the gear. The flight condition is quantized
+    (100 ft, 1 kt, 0.1 deg, 10 lbs, 0.1 inch and 0.01 for the commands) so
+    that the conditions which only differ by rounding errors share the same
+    key.
+
+    A trim starts from the controls of the nearest solution of the cache, the
+    distance being measured in quantization steps. It is a hit when the
+    solution has the same key. When the trim fails from the cached controls,
+    it is run again from the default controls so the cache cannot make a trim
+    fail. The solution of a successful trim is then stored in the cache,
+    replacing the solution with the same key if any.
+
+    The cost of a trim from the default controls (iterations and runs of the
+    model) is stored with each solution. The difference with the cost of the
+    trims that are started from the cache is reported as the iterations and
+    the runs that have been saved.
+
+    When a file is given, the cache is read from it and saved to it after each
+    new solution so that the solutions are kept from a session to the next.
+    The key does not account for the modifications of the aircraft files: the
+    cache file must be deleted when they are modified.
+
+    The cache is enabled with FGFDMExec::EnableTrimCache() and is then used by
+    the trims started with the property simulation/do_simple_trim.
+
+    <h3>Properties</h3>
+    @property simulation/trim-cache/entries (read only) Number of solutions
+    @property simulation/trim-cache/lookups (read only) Number of trims
+    @property simulation/trim-cache/hits (read only) Number of trims that have
+              found a solution with the same key
+    @property simulation/trim-cache/hit-rate (read only) Ratio of the hits to
+              the lookups
+    @property simulation/trim-cache/warm-starts (read only) Number of trims
+              started from a solution of the cache
+    @property simulation/trim-cache/saved-iterations (read only) Iterations
+              saved by the warm starts
+    @property simulation/trim-cache/saved-runs (read only) Runs of the model
+              saved by the warm starts
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGTrimCache
+{
+public:
+  /// A solution of the cache.
+  struct Entry {
+    std::string aircraft;
+    int mode = 0;
+    /// Quantized flight condition.
+    std::vector<long long> key;
+    std::vector<double> controls;
+    /// Cost of the trim from the default controls.
+    unsigned int iterations = 0;
+    unsigned int runs = 0;
+  };
+
+  /** Constructor.
+      @param file the file where the cache is saved, empty to keep the
+                  solutions in memory only. */
+  explicit FGTrimCache(const SGPath& file=SGPath());
+
+  /// Binds the statistics to the properties.
+  void Bind(FGPropertyManager* pm, const std::string& path="simulation/trim-cache");
+
+  /** Runs a trim from the nearest solution of the cache and stores its
+      solution.
+      @param fdmex the FDM to trim
+      @param trim  the trim, set up in the mode
+      @param mode  the trim mode
+      @return true if the trim is successful */
+  bool Trim(FGFDMExec* fdmex, FGTrim& trim, TrimMode mode);
+
+  /// Returns the quantized flight condition of an FDM.
+  static std::vector<long long> GetKey(FGFDMExec* fdmex);
+
+  /// Removes all the solutions and resets the statistics.
+  void Clear(void);
+
+  const std::vector<Entry>& GetEntries(void) const { return entries; }
+  const SGPath& GetFile(void) const { return file; }
+
+  int GetEntryCount(void) const { return static_cast<int>(entries.size()); }
+  int GetLookups(void) const { return lookups; }
+  int GetHits(void) const { return hits; }
+  double GetHitRate(void) const
+  { return lookups > 0 ? static_cast<double>(hits) / lookups : 0.0; }
+  int GetWarmStarts(void) const { return warm_starts; }
+  int GetSavedIterations(void) const { return saved_iterations; }
+  int GetSavedRuns(void) const { return saved_runs; }
+
+private:
+  SGPath file;
+  std::vector<Entry> entries;
+  int lookups = 0;
+  int hits = 0;
+  int warm_starts = 0;
+  int saved_iterations = 0;
+  int saved_runs = 0;
+
+  int Find(const std::string& aircraft, int mode,
+           const std::vector<long long>& key, size_t controls,
+           long long& distance) const;
+  bool Store(const Entry& entry);
+  void Load(void);
+  bool Save(void) const;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -0,0 +1,468 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGTrimSweep.cpp
+ Date started: 10/17/26
+ Purpose:      Trim an aircraft over a grid of flight conditions
+ Called by:    The applications that build the flight envelope of an aircraft
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+This class trims an aircraft for each point of a grid of flight conditions with
+clones of the FDM. Each trim starts from the controls of a neighboring point
+which has already been trimmed.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/17/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <system_error>
+#include <thread>
+
+#include "FGTrimSweep.h"
+#include "FGFDMExec.h"
+#include "models/FGPropulsion.h"
+#include "input_output/FGLog.h"
+#include "simgear/io/iostreams/sgstream.hxx"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGTrimSweep::FGTrimSweep(FGFDMExec* fdm, TrimMode tm)
+  : fdmex(fdm), mode(tm)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimSweep::CheckProperty(const string& property) const
+{
+  if (!fdmex->GetPropertyManager()->HasNode(property))
+    throw BaseException("FGTrimSweep: the property " + property
+                        + " does not exist.");
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimSweep::AddAxis(const string& property, const vector<double>& values)
+{
+  CheckProperty(property);
+  if (values.empty())
+    throw BaseException("FGTrimSweep: the axis " + property + " has no value.");
+
+  axis_names.push_back(property);
+  axis_values.push_back(values);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimSweep::AddOutput(const string& property)
+{
+  CheckProperty(property);
+  output_names.push_back(property);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the index of each axis of a point. The last axis varies the fastest.
+
+vector<size_t> FGTrimSweep::GetIndices(size_t point) const
+{
+  vector<size_t> indices(axis_values.size());
+
+  for (size_t i=axis_values.size(); i-- > 0;) {
+    indices[i] = point % axis_values[i].size();
+    point /= axis_values[i].size();
+  }
+
+  return indices;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGTrimSweep::GetHeader(void) const
+{
+  ostringstream header;
+
+  for (auto& name: axis_names) header << name << ",";
+  for (auto& name: output_names) header << name << ",";
+  header << "converged,iterations,warm-start";
+
+  return header.str();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// 64 bits FNV-1a hash.
+
+static void Hash(uint64_t& hash, const string& data)
+{
+  for (unsigned char c: data) {
+    hash ^= c;
+    hash *= 0x100000001b3ULL;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+static void HashFile(uint64_t& hash, const SGPath& path)
+{
+  sg_ifstream file(path);
+  if (file.is_open()) {
+    ostringstream content;
+    content << file.rdbuf();
+    Hash(hash, content.str());
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Appends the values of the leaves that FGFDMExec::CopyState() copies to the
+// clones: the readable and writable leaves of the property tree.
+
+static void AppendProperties(ostream& key, const SGPropertyNode* node)
+{
+  for (int i=0; i < node->nChildren(); i++) {
+    const SGPropertyNode* child = node->getChild(i);
+
+    if (child->nChildren() > 0) {
+      AppendProperties(key, child);
+      continue;
+    }
+
+    if (!child->getAttribute(SGPropertyNode::READ)
+        || !child->getAttribute(SGPropertyNode::WRITE))
+      continue;
+
+    switch (child->getType()) {
+    case simgear::props::NONE:
+    case simgear::props::ALIAS:
+      break;
+    case simgear::props::BOOL:
+    case simgear::props::STRING:
+    case simgear::props::UNSPECIFIED:
+      key << child->getPath() << " " << child->getStringValue() << "\n";
+      break;
+    default:
+      key << child->getPath() << " " << child->getDoubleValue() << "\n";
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+SGPath FGTrimSweep::GetCacheFile(void)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  const string& model = fdmex->GetModelName();
+
+  HashFile(hash, fdmex->GetFullAircraftPath()/(model + ".xml"));
+  for (auto& path: fdmex->GetModelFiles())
+    HashFile(hash, path);
+
+  ostringstream key;
+  key << setprecision(numeric_limits<double>::max_digits10) << mode << "\n";
+  for (size_t i=0; i < axis_names.size(); i++) {
+    key << axis_names[i];
+    for (double value: axis_values[i]) key << " " << value;
+    key << "\n";
+  }
+  key << GetHeader() << "\n";
+
+  SGPropertyNode* root = fdmex->GetPropertyManager()->GetNode();
+  SGPropertyNode* ic = root->getNode("ic");
+  for (int i=0; ic && i < ic->nChildren(); i++) {
+    SGPropertyNode* node = ic->getChild(i);
+    if (node->nChildren() == 0 && node->getAttribute(SGPropertyNode::READ))
+      key << node->getNameString() << "[" << node->getIndex() << "] "
+          << node->getDoubleValue() << "\n";
+  }
+
+  // The other properties copied to the clones (point masses, fuel,
+  // atmosphere, flight controls, ...). The branch simulation/ is not copied.
+  for (int i=0; i < root->nChildren(); i++) {
+    SGPropertyNode* node = root->getChild(i);
+    const string& name = node->getNameString();
+    if (name != "simulation" && name != "ic")
+      AppendProperties(key, node);
+  }
+  Hash(hash, key.str());
+
+  ostringstream name;
+  name << model << "-" << hex << setw(16) << setfill('0') << hash << ".csv";
+  return cache_dir/name.str();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTrimSweep::ReadCache(const SGPath& path)
+{
+  sg_ifstream input(path);
+  if (!input.is_open()) return false;
+
+  string line;
+  if (!getline(input, line) || line != GetHeader()) return false;
+
+  size_t nAxes = axis_names.size();
+  size_t nOutputs = output_names.size();
+  vector<Point> cached(points.size());
+
+  for (size_t i=0; i < cached.size(); i++) {
+    if (!getline(input, line)) return false;
+
+    istringstream row(line);
+    vector<double> values;
+    string field;
+    while (getline(row, field, ',')) {
+      try {
+        values.push_back(stod(field));
+      } catch (const logic_error&) {
+        return false;
+      }
+    }
+    if (values.size() != nAxes + nOutputs + 3) return false;
+
+    Point& p = cached[i];
+    p.axes.assign(values.begin(), values.begin() + nAxes);
+    if (p.axes != points[i].axes) return false;
+    p.outputs.assign(values.begin() + nAxes, values.begin() + nAxes + nOutputs);
+    p.converged = values[nAxes + nOutputs] != 0.0;
+    p.iterations = static_cast<unsigned int>(values[nAxes + nOutputs + 1]);
+    p.warm_start = static_cast<int>(values[nAxes + nOutputs + 2]);
+  }
+
+  points = cached;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimSweep::Trim(FGFDMExec* fdm, size_t point, mutex& fdm_mutex)
+{
+  {
+    // Some getters of the FDM update a cache: the clones read its state one
+    // at a time.
+    lock_guard<mutex> lock(fdm_mutex);
+    fdm->CopyState(*fdmex);
+  }
+
+  auto PropertyManager = fdm->GetPropertyManager();
+  Point& p = points[point];
+
+  for (size_t i=0; i < axis_names.size(); i++)
+    PropertyManager->GetNode(axis_names[i])->setDoubleValue(p.axes[i]);
+  fdm->RunIC();
+
+  // The neighbor is the point whose last non zero index is decremented.
+  vector<size_t> indices = GetIndices(point);
+  size_t stride = 1;
+  p.warm_start = -1;
+  for (size_t i=indices.size(); i-- > 0;) {
+    if (indices[i] > 0) {
+      const Point& neighbor = points[point - stride];
+      if (neighbor.converged) p.warm_start = static_cast<int>(point - stride);
+      break;
+    }
+    stride *= axis_values[i].size();
+  }
+
+  FGTrim trim(fdm, mode);
+  if (p.warm_start >= 0) trim.SetInitialControls(points[p.warm_start].controls);
+  p.converged = trim.DoTrim();
+  p.iterations = trim.GetIterations();
+  p.controls = trim.GetControls();
+
+  p.outputs.clear();
+  for (auto& name: output_names)
+    p.outputs.push_back(PropertyManager->GetNode(name)->getDoubleValue());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGTrimSweep::Run(void)
+{
+  if (axis_names.empty())
+    throw BaseException("FGTrimSweep: the grid has no axis.");
+
+  if (output_names.empty()) {
+    auto PropertyManager = fdmex->GetPropertyManager();
+    size_t nEngines = fdmex->GetPropulsion()->GetNumEngines();
+    for (size_t i=0; i < nEngines; i++)
+      output_names.push_back(CreateIndexedPropertyName("fcs/throttle-cmd-norm", i));
+    for (const string name: {"fcs/elevator-cmd-norm", "fcs/pitch-trim-cmd-norm",
+                             "fcs/aileron-cmd-norm", "fcs/rudder-cmd-norm",
+                             "aero/alpha-deg", "aero/beta-deg",
+                             "attitude/theta-deg", "attitude/phi-deg"}) {
+      if (PropertyManager->HasNode(name)) output_names.push_back(name);
+    }
+  }
+
+  // Build the grid and sort its points by their distance (in number of
+  // points) to the first one. The neighbor from which a point is trimmed is
+  // one point closer so it has been trimmed by the previous batch.
+  size_t nPoints = 1;
+  size_t nBatches = 1;
+  for (auto& values: axis_values) {
+    nPoints *= values.size();
+    nBatches += values.size() - 1;
+  }
+
+  points.assign(nPoints, Point());
+  vector<vector<size_t>> batches(nBatches);
+  size_t widest = 0;
+  for (size_t i=0; i < nPoints; i++) {
+    vector<size_t> indices = GetIndices(i);
+    size_t distance = 0;
+    for (size_t j=0; j < indices.size(); j++) {
+      points[i].axes.push_back(axis_values[j][indices[j]]);
+      distance += indices[j];
+    }
+    batches[distance].push_back(i);
+    widest = max(widest, batches[distance].size());
+  }
+
+  from_cache = false;
+  SGPath cache_file;
+  if (!cache_dir.isNull()) {
+    cache_file = GetCacheFile();
+    from_cache = ReadCache(cache_file);
+  }
+
+  if (!from_cache) {
+    unsigned int nThreads = max_threads;
+    if (nThreads == 0) nThreads = max(1U, thread::hardware_concurrency());
+    nThreads = min(nThreads, static_cast<unsigned int>(widest));
+
+    // The clones are built by the calling thread which also lowers the debug
+    // level shared by all the instances while they are trimmed.
+    int saved_debug_lvl = fdmex->GetDebugLevel();
+    fdmex->SetDebugLevel(0);
+
+    vector<unique_ptr<FGFDMExec>> clones;
+    try {
+      for (unsigned int i=0; i < nThreads; i++) {
+        clones.push_back(fdmex->Clone());
+        if (!clones.back())
+          throw BaseException("FGTrimSweep: the FDM has no model loaded.");
+      }
+    } catch (...) {
+      fdmex->SetDebugLevel(saved_debug_lvl);
+      throw;
+    }
+
+    mutex fdm_mutex, error_mutex;
+    exception_ptr error;
+
+    for (auto& batch: batches) {
+      atomic<size_t> next{0};
+
+      auto worker = [&](FGFDMExec* fdm) {
+        try {
+          for (size_t i = next++; i < batch.size(); i = next++)
+            Trim(fdm, batch[i], fdm_mutex);
+        } catch (...) {
+          lock_guard<mutex> lock(error_mutex);
+          if (!error) error = current_exception();
+          next = batch.size();
+        }
+      };
+
+      unsigned int nWorkers = min(nThreads, static_cast<unsigned int>(batch.size()));
+      vector<thread> pool;
+      try {
+        for (unsigned int i=1; i < nWorkers; i++)
+          pool.emplace_back(worker, clones[i].get());
+      } catch (const system_error&) {
+        // Threads are not available on this platform (WebAssembly for
+        // instance): the remaining points are trimmed by the calling thread.
+      }
+      worker(clones[0].get());
+      for (auto& t: pool)
+        t.join();
+
+      if (error) break;
+    }
+
+    fdmex->SetDebugLevel(saved_debug_lvl);
+    if (error) rethrow_exception(error);
+
+    if (!cache_file.isNull()) {
+      sg_ofstream output(cache_file, ios::out | ios::trunc);
+      if (output.is_open())
+        Write(output);
+      else {
+        FGLogging log(fdmex->GetLogger(), LogLevel::WARN);
+        log << "Could not write the trim sweep cache file " << cache_file.utf8Str()
+            << "\n";
+      }
+    }
+  }
+
+  size_t nConverged = 0;
+  for (auto& p: points)
+    if (p.converged) nConverged++;
+
+  return nConverged;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimSweep::Write(ostream& out) const
+{
+  ios::fmtflags flags = out.flags();
+  streamsize precision = out.precision();
+
+  out << GetHeader() << "\n"
+      << setprecision(numeric_limits<double>::max_digits10);
+  for (auto& p: points) {
+    for (double value: p.axes) out << value << ",";
+    for (double value: p.outputs) out << value << ",";
+    out << p.converged << "," << p.iterations << "," << p.warm_start << "\n";
+  }
+
+  out.flags(flags);
+  out.precision(precision);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimSweep::Write(const SGPath& path) const
+{
+  sg_ofstream output(path, ios::out | ios::trunc);
+
+  if (!output.is_open())
+    throw BaseException("Could not open the file " + path.utf8Str());
+
+  Write(output);
+}
+}
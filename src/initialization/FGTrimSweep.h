@@ -0,0 +1,188 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGTrimSweep.h
+ Date started: 10/17/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/17/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGTRIMSWEEP_H
+#define FGTRIMSWEEP_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "FGTrim.h"
+#include "simgear/misc/sg_path.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGFDMExec;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Trims an aircraft over a grid of flight conditions.
+    The grid is defined by axes, each of which is a property and the list of
+    its values. The axes are usually initial conditions (such as ic/h-sl-ft
+    or ic/vc-kts) but any writable property can be used; the weight and the
+    CG can for instance be swept with the properties of a point mass
+    (inertia/pointmass-weight-lbs and inertia/pointmass-location-X-inches).
+
+    Each point of the grid is trimmed by FGTrim from the state of the FDM
+    given to the constructor, after the values of the axes have been set and
+    the initial conditions have been applied. The trims are run by clones of
+    the FDM (see FGFDMExec::Clone) so the FDM is left unchanged and several
+    points can be trimmed in parallel.
+
+    Except for the first point of the grid, each trim starts from the controls
+    of a neighbor: the point whose last non zero index is decremented by one.
+    This neighbor is always trimmed before the point so the results do not
+    depend on the number of threads. When the neighbor has failed, the trim
+    starts from the default controls.
+
+    The results are a table with a row for each point (the last axis varying
+    the fastest) and a column for each axis, each output property and the
+    convergence data: the success of the trim, the number of iterations and
+    the index of the point the trim started from (-1 for none). By default,
+    the outputs are the commands of the throttles and of the control surfaces
+    and the aerodynamic angles and the attitude.
+
+    The table can be cached in a directory. Its file is named after the model
+    and a hash of the aircraft file and of the files it includes (engines,
+    systems, ...), of the trim mode, of the grid, of the outputs and of the
+    properties that are copied to the clones (initial conditions, point
+    masses, fuel, flight controls, ...). A sweep that has already been run
+    is therefore read from the cache. The hash does not account for the
+    planet file nor for the source code: the cache directory must be cleared
+    when they are modified.
+
+    @code
+    FGTrimSweep sweep(fdmex, tLongitudinal);
+    sweep.AddAxis("ic/h-sl-ft", {5000., 10000., 20000.});
+    sweep.AddAxis("ic/vc-kts", {200., 250., 300.});
+    sweep.SetThreads(0);
+    sweep.SetCacheDirectory(SGPath("trim_cache"));
+    sweep.Run();
+    sweep.Write(SGPath("envelope.csv"));
+    @endcode
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGTrimSweep : public FGJSBBase
+{
+public:
+  /// The result of the trim of a point of the grid.
+  struct Point {
+    /// Values of the axes.
+    std::vector<double> axes;
+    /// Values of the output properties after the trim.
+    std::vector<double> outputs;
+    /// Values of the trim controls (not stored in the table).
+    std::vector<double> controls;
+    bool converged = false;
+    unsigned int iterations = 0;
+    /// Index of the point the trim started from, -1 for none.
+    int warm_start = -1;
+  };
+
+  /** Constructor.
+      @param fdmex the FDM, initialized in the state from which each point is
+                   trimmed (engines running, configuration, ...).
+      @param mode  the trim mode. */
+  FGTrimSweep(FGFDMExec* fdmex, TrimMode mode=tLongitudinal);
+
+  /** Adds an axis to the grid.
+      @param property the name of the property
+      @param values   its values */
+  void AddAxis(const std::string& property, const std::vector<double>& values);
+
+  /** Adds a column to the results. The default outputs are used if no output
+      is added.
+      @param property the name of the property */
+  void AddOutput(const std::string& property);
+
+  /** Sets the number of threads that trim the points.
+      @param threads the number of threads, 0 to use all the cores. */
+  void SetThreads(unsigned int threads) { max_threads = threads; }
+
+  /** Sets the directory where the results are cached. The cache is disabled
+      by default. */
+  void SetCacheDirectory(const SGPath& dir) { cache_dir = dir; }
+
+  /** Trims all the points of the grid or reads them from the cache.
+      @return the number of points that have been trimmed successfully. */
+  size_t Run(void);
+
+  const std::vector<std::string>& GetAxisNames(void) const { return axis_names; }
+  const std::vector<std::string>& GetOutputNames(void) const { return output_names; }
+  const std::vector<Point>& GetPoints(void) const { return points; }
+
+  /// Returns true if the results of the last run were read from the cache.
+  bool IsFromCache(void) const { return from_cache; }
+  /// Returns the path of the cache file of the current sweep.
+  SGPath GetCacheFile(void);
+
+  /// Writes the results in the CSV format.
+  void Write(std::ostream& out) const;
+  void Write(const SGPath& path) const;
+
+private:
+  FGFDMExec* fdmex;
+  TrimMode mode;
+  unsigned int max_threads = 1;
+  SGPath cache_dir;
+  bool from_cache = false;
+
+  std::vector<std::string> axis_names;
+  std::vector<std::vector<double>> axis_values;
+  std::vector<std::string> output_names;
+  std::vector<Point> points;
+
+  void CheckProperty(const std::string& property) const;
+  std::vector<size_t> GetIndices(size_t point) const;
+  void Trim(FGFDMExec* fdm, size_t point, std::mutex& fdm_mutex);
+  std::string GetHeader(void) const;
+  bool ReadCache(const SGPath& path);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -26,9 +26,14 @@
 #include "models/FGMassBalance.h"
 #include "models/FGAuxiliary.h"
 #include "models/FGAircraft.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <iomanip>
 #include <cstdlib>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 #include "simgear/misc/stdint.hxx"
 #include "FGInitialCondition.h"
 #include "input_output/FGLog.h"
@@ -36,8 +41,15 @@
 namespace JSBSim
 {
 
+struct FGTrimmer::Worker
+{
+    std::unique_ptr<FGFDMExec> fdm;
+    std::unique_ptr<FGTrimmer> trimmer;
+};
+
 FGTrimmer::FGTrimmer(FGFDMExec * fdm, Constraints * constraints) :
-        m_fdm(fdm), m_constraints(constraints)
+        m_fdm(fdm), m_constraints(constraints), m_threads(1),
+        m_evaluations(0), m_evalTime(0.0)
 {
 }
 
@@ -46,6 +58,18 @@ FGTrimmer::~FGTrimmer()
 }
 
 std::vector<double> FGTrimmer::constrain(const std::vector<double> & dv)
+{
+    double phi, theta;
+    applyConstraints(dv, phi, theta);
+
+    std::vector<double> data;
+    data.push_back(phi);
+    data.push_back(theta);
+    return data;
+}
+
+void FGTrimmer::applyConstraints(const std::vector<double> & dv, double & phi,
+                                 double & theta)
 {
     // unpack design vector
     double throttle = dv[0];
@@ -59,8 +83,6 @@ std::vector<double> FGTrimmer::constrain(const std::vector<double> & dv)
     double vt = m_constraints->velocity;
     double altitude = m_constraints->altitude;
     double gamma = m_constraints->gamma;
-    double phi = m_fdm->GetIC()->GetPhiRadIC();
-    double theta = m_fdm->GetIC()->GetThetaRadIC();
     double psi = m_fdm->GetIC()->GetPsiRadIC();
     double p = 0.0, q = 0.0, r= 0.0;
     double u = vt*cos(alpha)*cos(beta);
@@ -143,8 +165,11 @@ std::vector<double> FGTrimmer::constrain(const std::vector<double> & dv)
         m_fdm->GetFCS()->SetThrottlePos(i,throttle);
     }
 
-    // initialize
+    // initialize without integrating so that the cost only depends on the
+    // design vector and not on the previous evaluations
+    m_fdm->SuspendIntegration();
     m_fdm->Initialize(m_fdm->GetIC().get());
+    m_fdm->ResumeIntegration();
     for (unsigned int i=0; i<m_fdm->GetPropulsion()->GetNumEngines(); i++) {
         m_fdm->GetPropulsion()->GetEngine(i)->InitRunning();
     }
@@ -181,11 +206,6 @@ std::vector<double> FGTrimmer::constrain(const std::vector<double> & dv)
         }
         cost = costNew;
     }
-
-    std::vector<double> data;
-    data.push_back(phi);
-    data.push_back(theta);
-    return data;
 }
 
 void FGTrimmer::printSolution(const std::vector<double> & v)
@@ -377,10 +397,85 @@ double FGTrimmer::compute_cost()
 
 double FGTrimmer::eval(const std::vector<double> & v)
 {
-    constrain(v);
+    auto start = std::chrono::steady_clock::now();
+    double cost = evaluate(v);
+    m_evalTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    m_evaluations++;
+    return cost;
+}
+
+double FGTrimmer::evaluate(const std::vector<double> & v)
+{
+    double phi, theta;
+    applyConstraints(v, phi, theta);
     return compute_cost();
 }
 
+void FGTrimmer::evalBatch(const std::vector< std::vector<double> > & vertices,
+                          std::vector<double> & costs)
+{
+    unsigned int nThreads = m_threads;
+    if (nThreads == 0) nThreads = std::max(1U, std::thread::hardware_concurrency());
+    nThreads = std::min(nThreads, static_cast<unsigned int>(vertices.size()));
+
+    // The clones are created at the first batch and kept for the next ones.
+    while (nThreads > 1 && m_workers.size() < nThreads - 1)
+    {
+        auto worker = std::make_unique<Worker>();
+        worker->fdm = m_fdm->Clone();
+        if (!worker->fdm) break;
+        worker->trimmer = std::make_unique<FGTrimmer>(worker->fdm.get(), m_constraints);
+        m_workers.push_back(std::move(worker));
+    }
+    nThreads = std::min(nThreads, static_cast<unsigned int>(m_workers.size() + 1));
+
+    if (nThreads < 2)
+    {
+        FGNelderMead::Function::evalBatch(vertices, costs);
+        return;
+    }
+
+    // A vertex is evaluated from the initial conditions of the FDM and its
+    // cost does not depend on the previous evaluations: the costs are the
+    // same whichever trimmer evaluates the vertex. The calling thread uses
+    // the FDM itself.
+    for (unsigned int i=0; i<nThreads-1; i++)
+        m_workers[i]->fdm->GetIC()->CopyFrom(*m_fdm->GetIC());
+
+    auto start = std::chrono::steady_clock::now();
+    std::atomic<size_t> next{0};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto work = [&](FGTrimmer * trimmer) {
+        try {
+            for (size_t i = next++; i < vertices.size(); i = next++)
+                costs[i] = trimmer->evaluate(vertices[i]);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) error = std::current_exception();
+            next = vertices.size();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    try {
+        for (unsigned int i=0; i<nThreads-1; i++)
+            pool.emplace_back(work, m_workers[i]->trimmer.get());
+    } catch (const std::system_error&) {
+        // Threads are not available on this platform (WebAssembly for
+        // instance): the remaining vertices are evaluated by the calling
+        // thread.
+    }
+    work(this);
+    for (auto & t : pool)
+        t.join();
+
+    m_evalTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    m_evaluations += vertices.size();
+    if (error) std::rethrow_exception(error);
+}
+
 } // JSBSim
 
 
@@ -22,6 +22,7 @@
 #include "math/FGNelderMead.h"
 #include "FGFDMExec.h"
 #include "models/FGInertial.h"
+#include <memory>
 
 namespace JSBSim
 {
@@ -48,6 +49,10 @@ public:
     void printState();
     double compute_cost();
     double eval(const std::vector<double> & v);
+    // evaluates the vertices in parallel with clones of the FDM, see
+    // setThreads
+    void evalBatch(const std::vector< std::vector<double> > & vertices,
+                   std::vector<double> & costs);
     static void limit(double min, double max, double &val)
     {
         if (val<min) val=min;
@@ -55,9 +60,30 @@ public:
     }
     void setFdm(FGFDMExec * fdm) {m_fdm = fdm; }
     FGFDMExec* getFdm() { return m_fdm; }
+    // number of threads that evaluate the batches of vertices, 0 to use all
+    // the cores. Each additional thread runs a clone of the FDM.
+    void setThreads(unsigned int threads) { m_threads = threads; }
+    // number of evaluations and wall clock time (s) spent evaluating them
+    // with the FDM since the last call to resetStatistics
+    unsigned int getEvaluations() const { return m_evaluations; }
+    double getEvalTime() const { return m_evalTime; }
+    void resetStatistics() { m_evaluations = 0; m_evalTime = 0.0; }
 private:
+    // clone of the FDM with its own trimmer
+    struct Worker;
+
     FGFDMExec * m_fdm;
     Constraints * m_constraints;
+    unsigned int m_threads;
+    std::vector< std::unique_ptr<Worker> > m_workers;
+    unsigned int m_evaluations;
+    double m_evalTime;
+
+    // sets the FDM in the state of the design vector and returns the angles
+    // phi and theta computed from the constraints
+    void applyConstraints(const std::vector<double> & v, double & phi,
+                          double & theta);
+    double evaluate(const std::vector<double> & v);
 };
 
 } // JSBSim
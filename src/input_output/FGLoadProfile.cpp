@@ -0,0 +1,169 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGLoadProfile.cpp
+ Date started: 10/17/26
+ Purpose:      Record the timing of the FDM load phases
+
+  ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+This class records a tree of the phases that occur while an aircraft or a
+script is loaded and reports their durations.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/17/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <iomanip>
+#include <sstream>
+
+#include "FGLoadProfile.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+void FGLoadProfile::Clear(void)
+{
+  phases.clear();
+  open_phases.clear();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLoadProfile::Begin(const string& name)
+{
+  if (!enabled) return;
+
+  clock::time_point now = clock::now();
+  if (phases.empty()) origin = now;
+
+  int parent = open_phases.empty() ? -1 : open_phases.back();
+  phases.push_back({name, now, clock::duration::zero(), parent,
+                    static_cast<unsigned int>(open_phases.size())});
+  open_phases.push_back(static_cast<int>(phases.size()-1));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLoadProfile::End(void)
+{
+  if (open_phases.empty()) return;
+
+  Phase& phase = phases[open_phases.back()];
+  phase.duration = clock::now() - phase.start;
+  open_phases.pop_back();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLoadProfile::PrintReport(ostream& out) const
+{
+  using ms = chrono::duration<double, milli>;
+
+  ms total = ms::zero();
+  for (auto& phase: phases)
+    if (phase.parent < 0) total += phase.duration;
+
+  ios::fmtflags flags = out.flags();
+  streamsize precision = out.precision();
+
+  out << endl << "Load profile" << endl
+      << "    time (ms)  share  phase" << endl
+      << fixed;
+
+  for (auto& phase: phases) {
+    ms parent_duration = phase.parent < 0 ? total : phases[phase.parent].duration;
+    ms duration = phase.duration;
+    double share = parent_duration.count() > 0.0 ?
+                   100.0 * duration / parent_duration : 0.0;
+
+    out << setw(13) << setprecision(3) << duration.count()
+        << setw(6) << setprecision(1) << share << "%  "
+        << string(2*phase.depth, ' ') << phase.name << endl;
+  }
+
+  out << setw(13) << setprecision(3) << total.count() << "         total"
+      << endl;
+
+  out.flags(flags);
+  out.precision(precision);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+static string JSONEscape(const string& str)
+{
+  ostringstream buf;
+
+  for (unsigned char c: str) {
+    switch(c) {
+    case '"':  buf << "\\\""; break;
+    case '\\': buf << "\\\\"; break;
+    case '\n': buf << "\\n"; break;
+    case '\t': buf << "\\t"; break;
+    default:
+      if (c < 0x20)
+        buf << "\\u" << hex << setw(4) << setfill('0') << int(c) << dec;
+      else
+        buf << c;
+    }
+  }
+
+  return buf.str();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLoadProfile::WriteChromeTrace(ostream& out) const
+{
+  using us = chrono::duration<double, micro>;
+
+  ios::fmtflags flags = out.flags();
+  streamsize precision = out.precision();
+
+  out << "{\"traceEvents\":[" << fixed << setprecision(3);
+
+  for (size_t i=0; i<phases.size(); ++i) {
+    const Phase& phase = phases[i];
+    us ts = phase.start - origin;
+    us dur = phase.duration;
+
+    if (i > 0) out << ",";
+    out << endl << "{\"name\":\"" << JSONEscape(phase.name)
+        << "\",\"cat\":\"load\",\"ph\":\"X\",\"ts\":" << ts.count()
+        << ",\"dur\":" << dur.count() << ",\"pid\":1,\"tid\":1}";
+  }
+
+  out << endl << "],\"displayTimeUnit\":\"ms\"}" << endl;
+
+  out.flags(flags);
+  out.precision(precision);
+}
+}
@@ -0,0 +1,137 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGLoadProfile.h
+ Date started: 10/17/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/17/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGLOADPROFILE_H
+#define FGLOADPROFILE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "JSBSim_API.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Records a hierarchical timing tree of the load phases of an FDM.
+    The phases are delimited with Begin() and End() or, more conveniently, with
+    a Scope instance. Nothing is recorded until the profile is enabled so the
+    instrumentation can be left in place at a negligible cost.
+
+    The recorded tree can be printed as an indented text report or exported in
+    the Chrome trace event format which can be opened in chrome://tracing or
+    https://ui.perfetto.dev
+
+    @code
+    fdmex->GetLoadProfile()->Enable(true);
+    fdmex->LoadModel("c172x");
+    fdmex->GetLoadProfile()->PrintReport(std::cout);
+    @endcode
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGLoadProfile
+{
+public:
+  /// Starts or stops the recording of the load phases.
+  void Enable(bool enable) { enabled = enable; }
+  bool IsEnabled(void) const { return enabled; }
+
+  /// Discards the recorded phases.
+  void Clear(void);
+
+  /** Opens a phase. Phases opened before this one is closed are recorded as
+      its children.
+      @param name the phase name */
+  void Begin(const std::string& name);
+  /// Closes the phase that was opened last.
+  void End(void);
+
+  /** Prints the timing tree. Each line shows the phase duration and its share
+      of the duration of its parent. */
+  void PrintReport(std::ostream& out) const;
+  /// Writes the timing tree in the Chrome trace event JSON format.
+  void WriteChromeTrace(std::ostream& out) const;
+
+  /** Records a phase for the lifetime of the instance.
+      The phase name is only built when the profile is enabled. */
+  class Scope
+  {
+  public:
+    Scope(FGLoadProfile* p, const std::string& name)
+      : profile(p && p->IsEnabled() ? p : nullptr)
+    { if (profile) profile->Begin(name); }
+    Scope(FGLoadProfile* p, const std::string& prefix, const std::string& name)
+      : profile(p && p->IsEnabled() ? p : nullptr)
+    { if (profile) profile->Begin(prefix + name); }
+    ~Scope() { if (profile) profile->End(); }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+  private:
+    FGLoadProfile* profile;
+  };
+
+private:
+  using clock = std::chrono::steady_clock;
+
+  struct Phase {
+    std::string name;
+    clock::time_point start;
+    clock::duration duration;
+    int parent;
+    unsigned int depth;
+  };
+
+  bool enabled = false;
+  clock::time_point origin;
+  std::vector<Phase> phases;
+  std::vector<int> open_phases;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -187,6 +187,8 @@ void FGLogConsole::Flush(void) {
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGLogConsole::Format(LogFormat format) {
+  if (log_level < min_level) return;
+
   switch (format)
   {
   case LogFormat::RED:
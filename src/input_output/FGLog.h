@@ -148,8 +148,10 @@ class JSBSIM_API FGLogConsole : public FGLogger
 {
 public:
   void SetMinLevel(LogLevel level) { min_level = level; }
-  void FileLocation(const std::string& filename, int line) override
-  { buffer.append("\nIn file " + filename + ": line " + std::to_string(line) + "\n"); }
+  void FileLocation(const std::string& filename, int line) override {
+    if (log_level < min_level) return;
+    buffer.append("\nIn file " + filename + ": line " + std::to_string(line) + "\n");
+  }
   void Format(LogFormat format) override;
   void Flush(void) override;
 
@@ -37,6 +37,11 @@ HISTORY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <atomic>
+#include <set>
+#include <system_error>
+#include <thread>
+
 #include "FGFDMExec.h"
 #include "FGModelLoader.h"
 #include "FGXMLFileRead.h"
@@ -66,13 +71,19 @@ Element_ptr FGModelLoader::Open(Element *el)
     if (CachedFiles.find(path.utf8Str()) != CachedFiles.end())
       document = CachedFiles[path.utf8Str()];
     else {
-      document = XMLFileRead.LoadXMLDocument(path);
+      document = model->GetExec()->TakePrefetchedFile(path.utf8Str());
+      if (!document) {
+        FGLoadProfile::Scope profile(model->GetExec()->GetLoadProfile(),
+                                     "read ", path.utf8Str());
+        document = XMLFileRead.LoadXMLDocument(path);
+      }
       if (document == 0L) {
         FGXMLLogging log(model->GetExec()->GetLogger(), el, LogLevel::ERROR);
         log << "Could not open file: " << fname << endl;
         return NULL;
       }
       CachedFiles[path.utf8Str()] = document;
+      model->GetExec()->AddModelFile(path);
     }
 
     if (document->GetName() != el->GetName()) {
@@ -94,4 +105,61 @@ SGPath CheckPathName(const SGPath& path, const SGPath& filename) {
 
   return fullName.exists() ? fullName : SGPath();
 }
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+map<string, Element_ptr>
+PrefetchFiles(const vector<SGPath>& fullpaths, unsigned int max_threads)
+{
+  map<string, Element_ptr> documents;
+  vector<SGPath> paths;
+  set<string> known;
+
+  // The files that are referenced several times are read once.
+  for (auto& path: fullpaths) {
+    if (!path.isNull() && known.insert(path.utf8Str()).second)
+      paths.push_back(path);
+  }
+
+  // There is nothing to gain from a thread pool for a single file.
+  if (paths.size() < 2) return documents;
+
+  vector<Element_ptr> results(paths.size());
+  atomic<size_t> next{0};
+
+  auto worker = [&]() {
+    for (size_t i = next++; i < paths.size(); i = next++) {
+      FGXMLFileRead XMLFileRead;
+      try {
+        results[i] = XMLFileRead.LoadXMLDocument(paths[i], false);
+      } catch (...) {
+        // Parsing errors are reported when the file is opened again by
+        // FGModelLoader::Open()
+        results[i] = nullptr;
+      }
+    }
+  };
+
+  unsigned int nthreads = max(1U, min(max_threads, thread::hardware_concurrency()));
+  nthreads = min(nthreads, static_cast<unsigned int>(paths.size()));
+
+  vector<thread> pool;
+  try {
+    for (unsigned int i=1; i<nthreads; ++i)
+      pool.emplace_back(worker);
+  } catch (const system_error&) {
+    // Threads are not available on this platform (WebAssembly for instance):
+    // the remaining files are read by the calling thread.
+  }
+  worker();
+  for (auto& t: pool)
+    t.join();
+
+  for (size_t i=0; i<paths.size(); ++i) {
+    if (results[i])
+      documents[paths[i].utf8Str()] = results[i];
+  }
+
+  return documents;
+}
 }
@@ -38,7 +38,10 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "FGXMLElement.h"
 #include "simgear/misc/sg_path.hxx"
@@ -71,6 +74,18 @@ private:
 };
 
 SGPath CheckPathName(const SGPath& path, const SGPath& filename);
+
+/** Reads and parses a list of files concurrently.
+    The files are read and parsed on a small pool of threads. The path names
+    must have been resolved as FGModelLoader::Open() resolves them so that the
+    documents are found under the same name. Files that cannot be found or
+    parsed are skipped: FGModelLoader::Open() will read them again and report
+    the error in the usual way.
+    @param paths the full path names of the files
+    @param max_threads maximum number of threads used to read the files
+    @return the parsed documents indexed by their full path name. */
+std::map<std::string, Element_ptr>
+PrefetchFiles(const std::vector<SGPath>& paths, unsigned int max_threads=4);
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 #endif
@@ -56,7 +56,9 @@ CLASS IMPLEMENTATION
 FGOutputType::FGOutputType(FGFDMExec* fdmex) :
   FGModel(fdmex),
   SubSystems(0),
-  enabled(true)
+  enabled(true),
+  period(0.0),
+  next_output_time(0.0)
 {
   Aerodynamics = FDMExec->GetAerodynamics();
   Auxiliary = FDMExec->GetAuxiliary();
@@ -176,6 +178,7 @@ bool FGOutputType::Load(Element* element)
 bool FGOutputType::InitModel(void)
 {
   bool ret = FGModel::InitModel();
+  next_output_time = 0.0;
 
   Debug(2);
   return ret;
@@ -185,7 +188,16 @@ bool FGOutputType::InitModel(void)
 
 bool FGOutputType::Run(bool Holding)
 {
-  if (FGModel::Run(Holding)) return true;
+  if (FDMExec->VariableTimeStep()) {
+    // The frames do not have the same duration so the output is triggered by
+    // the simulation time rather than by a frame count.
+    if (period > 0.0) {
+      double sim_time = FDMExec->GetSimTime();
+      if (sim_time + 1E-6*period < next_output_time) return true;
+      next_output_time = period * (floor(sim_time / period + 1E-6) + 1.0);
+    }
+  }
+  else if (FGModel::Run(Holding)) return true;
   if (!enabled) return true;
 
   RunPreFunctions();
@@ -204,9 +216,11 @@ void FGOutputType::SetRateHz(double rtHz)
   rtHz = rtHz>1000?1000:(rtHz<0?0:rtHz);
   if (rtHz > 0) {
     SetRate(0.5 + 1.0/(FDMExec->GetDeltaT()*rtHz));
+    period = 1.0/rtHz;
     Enable();
   } else {
     SetRate(1);
+    period = 0.0;
     Disable();
   }
 }
@@ -215,6 +229,9 @@ void FGOutputType::SetRateHz(double rtHz)
 
 double FGOutputType::GetRateHz(void) const
 {
+  if (FDMExec->VariableTimeStep())
+    return period > 0.0 ? 1.0 / period : 0.0;
+
   return 1.0 / (rate * FDMExec->GetDeltaT());
 }
 
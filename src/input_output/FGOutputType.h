@@ -104,7 +104,9 @@ public:
    */
   void SetIdx(unsigned int idx);
 
-  /** Set the output rate for this output instances.
+  /** Set the output rate for this output instances. When the time step of
+      the executive is adaptive, the output is generated at the first frame
+      that reaches each multiple of the period 1/rtHz in simulation time.
       @param rtHz new output rate in Hz */
   void SetRateHz(double rtHz);
 
@@ -197,6 +199,8 @@ protected:
   std::vector <FGPropertyValue*> OutputParameters;
   std::vector <std::string> OutputCaptions;
   bool enabled;
+  double period;           // output period in seconds
+  double next_output_time; // used when the time step is adaptive
 
   std::shared_ptr<FGAerodynamics> Aerodynamics;
   std::shared_ptr<FGAuxiliary> Auxiliary;
@@ -0,0 +1,241 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGRealTimePacer.cpp
+ Date started: 10/17/26
+ Purpose:      Pace the frames against the wall clock
+ Called by:    The standalone application and the embedding applications
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+This class waits between the frames so that the simulation time follows the
+wall clock, and measures how well the deadlines are met.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/17/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <iomanip>
+#include <thread>
+
+#include "FGRealTimePacer.h"
+#include "FGPropertyManager.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+static double Seconds(chrono::steady_clock::duration d)
+{
+  return chrono::duration<double>(d).count();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRealTimePacer::SetTimeAcceleration(double acceleration)
+{
+  time_acceleration = max(acceleration, 0.0);
+  // The deadlines are computed from the current time so that the frames that
+  // have already been run are not paced again with the new acceleration.
+  if (started) Rebase(last_sim_time, clock::now());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRealTimePacer::SetSpinThreshold(double seconds)
+{
+  spin_threshold = max(seconds, 0.0);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRealTimePacer::Bind(FGPropertyManager* pm, const string& path)
+{
+  pm->Tie(path + "/acceleration", this, &FGRealTimePacer::GetTimeAcceleration,
+          &FGRealTimePacer::SetTimeAcceleration);
+  pm->Tie(path + "/spin-threshold-sec", this, &FGRealTimePacer::GetSpinThreshold,
+          &FGRealTimePacer::SetSpinThreshold);
+  pm->Tie(path + "/frames", this, &FGRealTimePacer::GetFrames);
+  pm->Tie(path + "/overruns", this, &FGRealTimePacer::GetOverruns);
+  pm->Tie(path + "/jitter-mean-sec", this, &FGRealTimePacer::GetMeanJitter);
+  pm->Tie(path + "/jitter-max-sec", this, &FGRealTimePacer::GetMaxJitter);
+  pm->Tie(path + "/lateness-max-sec", this, &FGRealTimePacer::GetMaxLateness);
+  pm->Tie(path + "/worst-frame-sec", this, &FGRealTimePacer::GetWorstFrame);
+  pm->Tie(path + "/worst-frame-time-sec", this,
+          &FGRealTimePacer::GetWorstFrameTime);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRealTimePacer::Start(double sim_time)
+{
+  frames = overruns = waits = 0;
+  jitter_sum = jitter_max = lateness_max = 0.0;
+  worst_frame = worst_frame_time = cycle_duration = 0.0;
+
+  Rebase(sim_time, clock::now());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRealTimePacer::Rebase(double sim_time, clock::time_point now)
+{
+  origin = now;
+  frame_start = now;
+  sim_origin = sim_time;
+  last_sim_time = sim_time;
+  started = true;
+  paused = false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRealTimePacer::Pause(void)
+{
+  if (!started || paused) return;
+
+  paused = true;
+  pause_start = clock::now();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRealTimePacer::Resume(void)
+{
+  if (!paused) return;
+
+  clock::duration pause_duration = clock::now() - pause_start;
+  origin += pause_duration;
+  frame_start += pause_duration;
+  paused = false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRealTimePacer::Pace(double sim_time)
+{
+  clock::time_point now = clock::now();
+
+  // The deadlines are computed again from the current time when the
+  // simulation time has been reset.
+  if (!started || sim_time < last_sim_time) {
+    Rebase(sim_time, now);
+    return;
+  }
+
+  // A frame that has not advanced the simulation time (hold, suspended
+  // integration) is not paced: the wall clock time that it took is excluded
+  // from the deadlines as if the pacer had been paused.
+  if (sim_time == last_sim_time) {
+    if (!paused) {
+      origin += now - frame_start;
+      frame_start = now;
+    }
+    return;
+  }
+
+  double execution = Seconds(now - frame_start);
+  frames++;
+  if (execution > worst_frame) {
+    worst_frame = execution;
+    worst_frame_time = sim_time;
+  }
+  last_sim_time = sim_time;
+
+  if (time_acceleration > 0.0) {
+    chrono::duration<double> offset((sim_time - sim_origin) / time_acceleration);
+    clock::time_point deadline = origin
+                                 + chrono::duration_cast<clock::duration>(offset);
+
+    if (now > deadline) {
+      overruns++;
+      lateness_max = max(lateness_max, Seconds(now - deadline));
+    }
+    else {
+      WaitUntil(deadline);
+      now = clock::now();
+      double jitter = Seconds(now - deadline);
+      waits++;
+      jitter_sum += jitter;
+      jitter_max = max(jitter_max, jitter);
+    }
+  }
+
+  cycle_duration = Seconds(now - frame_start);
+  frame_start = now;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Sleeps until the deadline minus the spin threshold then busy waits until the
+// deadline.
+
+void FGRealTimePacer::WaitUntil(clock::time_point deadline) const
+{
+  chrono::duration<double> threshold(spin_threshold);
+  clock::time_point wake_up = deadline
+                              - chrono::duration_cast<clock::duration>(threshold);
+
+  if (clock::now() < wake_up) this_thread::sleep_until(wake_up);
+  while (clock::now() < deadline) {}
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGRealTimePacer::GetElapsedTime(void) const
+{
+  if (!started) return 0.0;
+
+  return Seconds((paused ? pause_start : clock::now()) - origin);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRealTimePacer::PrintReport(ostream& out) const
+{
+  ios::fmtflags flags = out.flags();
+  streamsize precision = out.precision();
+
+  out << endl << "Real-time pacing" << endl << fixed << setprecision(3);
+  if (time_acceleration > 0.0)
+    out << "  time acceleration:  " << time_acceleration << endl;
+  else
+    out << "  time acceleration:  as fast as possible" << endl;
+  out << "  frames:             " << frames << endl
+      << "  overruns:           " << overruns << endl
+      << "  mean jitter (ms):   " << 1000.0*GetMeanJitter() << endl
+      << "  max jitter (ms):    " << 1000.0*jitter_max << endl
+      << "  max lateness (ms):  " << 1000.0*lateness_max << endl
+      << "  worst frame (ms):   " << 1000.0*worst_frame << " at t = "
+      << worst_frame_time << " s" << endl;
+
+  out.flags(flags);
+  out.precision(precision);
+}
+}
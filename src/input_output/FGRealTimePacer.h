@@ -0,0 +1,210 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGRealTimePacer.h
+ Date started: 10/17/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/17/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGREALTIMEPACER_H
+#define FGREALTIMEPACER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <chrono>
+#include <ostream>
+#include <string>
+
+#include "JSBSim_API.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGPropertyManager;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Paces the execution of the frames against the wall clock.
+    Each frame is due at an absolute deadline computed from the simulation
+    time elapsed since the pacer was started, divided by the time
+    acceleration. Since the deadlines do not depend on the duration of the
+    previous waits, the errors of the sleep function do not accumulate. A frame
+    that completes after its deadline is counted as an overrun and the next
+    frames are run without waiting until the simulation has caught up with the
+    wall clock. The simulation itself is not modified: every frame is run with
+    the same time step whatever the load of the computer so the results are the
+    same as in batch mode.
+
+    The wait is a hybrid of sleep and busy wait: the thread sleeps until the
+    deadline minus the spin threshold, then spins until the deadline. The
+    sleep functions of most operating systems may wake up a thread up to a
+    millisecond late so the spin threshold trades the CPU load for the
+    accuracy of the pacing. A null threshold disables the busy wait.
+
+    The pacer measures the following statistics:
+    - the number of frames and of overruns,
+    - the mean and maximum jitter, that is the delay between a deadline and
+      the time at which the thread actually resumes,
+    - the maximum lateness of the overruns,
+    - the longest execution time of a frame and the simulation time at which
+      it occurred.
+
+    @code
+    FGRealTimePacer pacer;
+    pacer.SetTimeAcceleration(2.0);
+    pacer.Bind(fdmex->GetPropertyManager().get());
+    pacer.Start(fdmex->GetSimTime());
+    while (fdmex->Run()) {
+      if (fdmex->Holding())
+        pacer.Pause();
+      else {
+        pacer.Resume();
+        pacer.Pace(fdmex->GetSimTime());
+      }
+    }
+    pacer.PrintReport(std::cout);
+    @endcode
+
+    <h3>Properties</h3>
+    @property simulation/realtime/acceleration Ratio of the simulation time to
+              the wall clock time (default 1). A null value runs the frames as
+              fast as possible.
+    @property simulation/realtime/spin-threshold-sec Duration of the busy wait
+              before each deadline (default 1 ms).
+    @property simulation/realtime/frames (read only) Number of paced frames.
+    @property simulation/realtime/overruns (read only) Number of frames that
+              have completed after their deadline.
+    @property simulation/realtime/jitter-mean-sec (read only) Mean delay of the
+              wake up after a deadline.
+    @property simulation/realtime/jitter-max-sec (read only) Maximum delay of
+              the wake up after a deadline.
+    @property simulation/realtime/lateness-max-sec (read only) Maximum delay of
+              the completion of a frame after its deadline.
+    @property simulation/realtime/worst-frame-sec (read only) Longest
+              execution time of a frame.
+    @property simulation/realtime/worst-frame-time-sec (read only) Simulation
+              time at the end of the longest frame.
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGRealTimePacer
+{
+public:
+  /** Sets the ratio of the simulation time to the wall clock time.
+      @param acceleration the ratio. A null ratio disables the waits. */
+  void SetTimeAcceleration(double acceleration);
+  double GetTimeAcceleration(void) const { return time_acceleration; }
+
+  /** Sets the duration of the busy wait that ends each wait.
+      @param seconds the duration. A null duration disables the busy wait. */
+  void SetSpinThreshold(double seconds);
+  double GetSpinThreshold(void) const { return spin_threshold; }
+
+  /** Ties the settings and the statistics to properties.
+      @param pm   the property manager
+      @param path the path of the properties */
+  void Bind(FGPropertyManager* pm,
+            const std::string& path = "simulation/realtime");
+
+  /** Sets the origin of the deadlines and resets the statistics.
+      @param sim_time the current simulation time */
+  void Start(double sim_time);
+
+  /** Sets the origin of the deadlines again at the next call to Pace(). This
+      is needed when the simulation time is reset. The statistics are kept. */
+  void Restart(void) { started = false; }
+
+  /** Stops the wall clock, for instance while the simulation is on hold. The
+      deadlines are shifted by the duration of the pause when the pacer is
+      resumed. */
+  void Pause(void);
+  void Resume(void);
+
+  /** Records the end of the execution of a frame and waits until the
+      deadline of the simulation time reached by the frame. A frame that has
+      not advanced the simulation time is neither counted nor paced and the
+      wall clock time it took is excluded from the deadlines.
+      @param sim_time the simulation time at the end of the frame */
+  void Pace(double sim_time);
+
+  /// Returns the wall clock time elapsed since the start, pauses excluded.
+  double GetElapsedTime(void) const;
+  /// Returns the duration of the last frame, wait included.
+  double GetCycleDuration(void) const { return cycle_duration; }
+
+  int GetFrames(void) const { return frames; }
+  int GetOverruns(void) const { return overruns; }
+  double GetMeanJitter(void) const
+  { return waits > 0 ? jitter_sum / waits : 0.0; }
+  double GetMaxJitter(void) const { return jitter_max; }
+  double GetMaxLateness(void) const { return lateness_max; }
+  double GetWorstFrame(void) const { return worst_frame; }
+  double GetWorstFrameTime(void) const { return worst_frame_time; }
+
+  /// Prints the statistics.
+  void PrintReport(std::ostream& out) const;
+
+private:
+  using clock = std::chrono::steady_clock;
+
+  double time_acceleration = 1.0;
+  double spin_threshold = 1E-3;
+
+  bool started = false;
+  bool paused = false;
+  clock::time_point origin;
+  clock::time_point pause_start;
+  clock::time_point frame_start;
+  double sim_origin = 0.0;
+  double last_sim_time = 0.0;
+  double cycle_duration = 0.0;
+
+  int frames = 0;
+  int overruns = 0;
+  int waits = 0;
+  double jitter_sum = 0.0;
+  double jitter_max = 0.0;
+  double lateness_max = 0.0;
+  double worst_frame = 0.0;
+  double worst_frame_time = 0.0;
+
+  void Rebase(double sim_time, clock::time_point now);
+  void WaitUntil(clock::time_point deadline) const;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
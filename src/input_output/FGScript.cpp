@@ -102,7 +102,11 @@ bool FGScript::LoadScript(const SGPath& script, double default_dT,
   FGCondition *newCondition;
 
   FGXMLFileRead XMLFileRead;
-  Element* document = XMLFileRead.LoadXMLDocument(script);
+  Element* document = nullptr;
+  {
+    FGLoadProfile::Scope profile(FDMExec->GetLoadProfile(), "read ", script.utf8Str());
+    document = XMLFileRead.LoadXMLDocument(script);
+  }
 
   if (!document) {
     cerr << "File: " << script << " could not be loaded." << endl;
@@ -184,9 +188,12 @@ bool FGScript::LoadScript(const SGPath& script, double default_dT,
   }
 
   auto IC = FDMExec->GetIC();
-  if ( ! IC->Load( initialize )) {
-    cerr << "Initialization unsuccessful" << endl;
-    return false;
+  {
+    FGLoadProfile::Scope profile(FDMExec->GetLoadProfile(), "initial conditions");
+    if ( ! IC->Load( initialize )) {
+      cerr << "Initialization unsuccessful" << endl;
+      return false;
+    }
   }
 
   // Now, read input spec if given.
@@ -239,6 +246,11 @@ bool FGScript::LoadScript(const SGPath& script, double default_dT,
       newEvent->Continuous = true;
     }
 
+    // Should the executive locate the time at which the condition toggles?
+    if (event_element->GetAttributeValue("locate") == string("true")) {
+      newEvent->Locate = true;
+    }
+
     // Process the conditions
     Element* condition_element = event_element->FindElement("condition");
     if (condition_element) {
@@ -380,6 +392,18 @@ void FGScript::ResetEvents(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGScript::GetLocatedConditions(vector<const FGCondition*>& conditions) const
+{
+  for (const auto& thisEvent: Events) {
+    // A one shot event that has been triggered will not be triggered again.
+    if (thisEvent.Locate && thisEvent.Condition
+        && (!thisEvent.Triggered || thisEvent.Persistent || thisEvent.Continuous))
+      conditions.push_back(thisEvent.Condition);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGScript::RunScript(void)
 {
   unsigned i, j;
@@ -157,6 +157,21 @@ CLASS DOCUMENTATION
     to be used are specified in the &quot;use&quot; lines. Next,
     comes the &quot;run&quot; section, where the conditions are
     described in &quot;event&quot; clauses.</p>
+
+    <p>When the executive locates events (see
+    <tt>simulation/event-location/enabled</tt> in FGFDMExec), an event with the
+    attribute <tt>locate="true"</tt> shortens the frame during which its
+    condition toggles so that the frame ends right after the toggle:</p>
+
+    @code
+    <event name="flare" locate="true">
+      <condition> position/h-agl-ft le 30 </condition>
+      <set name="ap/flare" value="1"/>
+    </event>
+    @endcode
+
+    <p>The forces are evaluated again at each attempt to locate the toggle
+    but the flight control system and the propulsion are not run.</p>
     @author Jon S. Berndt
 */
 
@@ -194,6 +209,11 @@ public:
 
   void ResetEvents(void);
 
+  /** Appends the conditions of the events flagged with
+      <tt>locate="true"</tt> that can still be triggered.
+      @param conditions the list to which the conditions are appended */
+  void GetLocatedConditions(std::vector<const FGCondition*>& conditions) const;
+
 private:
   enum eAction {
     FG_RAMP  = 1,
@@ -211,6 +231,7 @@ private:
     FGCondition     *Condition;
     bool             Persistent;
     bool             Continuous;
+    bool             Locate;
     bool             Triggered;
     bool             Notify;
     bool             NotifyKML;
@@ -238,6 +259,7 @@ private:
       Triggered = false;
       Persistent = false;
       Continuous = false;
+      Locate = false;
       Delay = 0.0;
       Notify = Notified = NotifyKML = false;
       Name = "";
@@ -44,7 +44,7 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
-bool Element::converterIsInitialized = false;
+once_flag Element::converterIsInitialized;
 map <string, map <string, double> > Element::convert;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -58,8 +58,9 @@ Element::Element(const string& nm)
   element_index = 0;
   line_number = -1;
 
-  if (!converterIsInitialized) {
-    converterIsInitialized = true;
+  // Elements may be created concurrently by the threads that parse the files
+  // (see PrefetchFiles()).
+  call_once(converterIsInitialized, []() {
     // convert ["from"]["to"] = factor, so: from * factor = to
     // Length
     convert["M"]["FT"] = 3.2808399;
@@ -251,7 +252,7 @@ Element::Element(const string& nm)
     convert["VOLTS"]["VOLTS"] = 1.0;
     convert["OHMS"]["OHMS"] = 1.0;
     convert["AMPERES"]["AMPERES"] = 1.0;
-  }
+  });
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -337,10 +338,22 @@ Element* Element::GetNextElement(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string Element::GetDataLine(unsigned int i)
+const string& Element::GetDataLine(unsigned int i) const
+{
+  static const string empty;
+
+  if (i < data_lines.size()) return data_lines[i];
+  else return empty;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const string& Element::GetFileName(void) const
 {
-  if (!data_lines.empty()) return data_lines[i];
-  else return string("");
+  static const string empty;
+
+  if (file_name) return *file_name;
+  else return empty;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -730,7 +743,7 @@ void Element::AddData(string d)
   if (string_start != string::npos && string_start > 0) {
     d.erase(0,string_start);
   }
-  data_lines.push_back(d);
+  data_lines.push_back(std::move(d));
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -34,8 +34,10 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <memory>
 #include <string>
 #include <map>
+#include <mutex>
 #include <vector>
 
 #include "simgear/structure/SGSharedPtr.hxx"
@@ -183,7 +185,7 @@ public:
       @param i the index of the data line to return (0 by default).
       @return a string representing the data line requested, or the empty string
               if none exists.*/
-  std::string GetDataLine(unsigned int i=0);
+  const std::string& GetDataLine(unsigned int i=0) const;
 
   /// Returns the number of lines of data stored
   unsigned int GetNumDataLines(void) {return (unsigned int)data_lines.size();}
@@ -232,7 +234,7 @@ public:
   /** Returns the name of the file in which the element has been read.
       @return the file name
   */
-  const std::string& GetFileName(void) const { return file_name; }
+  const std::string& GetFileName(void) const;
 
   /** Searches for a specified element.
       Finds the first element that matches the supplied string, or simply the first
@@ -366,7 +368,16 @@ public:
   /** Set the name of the file in which the element has been read.
    *  @param name file name
    */
-  void SetFileName(const std::string& name) { file_name = name; }
+  void SetFileName(const std::string& name)
+  { file_name = std::make_shared<const std::string>(name); }
+
+  /** Set the name of the file in which the element has been read.
+   *  The string is shared with the other elements read from the same file so
+   *  that the file name is not duplicated in every element of a document.
+   *  @param name file name
+   */
+  void SetFileName(std::shared_ptr<const std::string> name)
+  { file_name = std::move(name); }
 
   /** Return a string that contains a description of the location where the
    *  current XML element was read from.
@@ -391,11 +402,11 @@ private:
   std::vector <Element_ptr> children;
   Element *parent;
   unsigned int element_index;
-  std::string file_name;
+  std::shared_ptr<const std::string> file_name;
   int line_number;
   typedef std::map <std::string, std::map <std::string, double> > tMapConvert;
   static tMapConvert convert;
-  static bool converterIsInitialized;
+  static std::once_flag converterIsInitialized;
 };
 
 } // namespace JSBSim
@@ -29,6 +29,8 @@
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <cctype>
+
 #include "FGXMLParse.h"
 #include "input_output/string_utilities.h"
 
@@ -43,6 +45,7 @@ CLASS IMPLEMENTATION
 void FGXMLParse::reset(void)
 {
   current_element = document = nullptr;
+  file_name.reset();
   working_string.erase();
 }
 
@@ -50,9 +53,23 @@ void FGXMLParse::reset(void)
 
 void FGXMLParse::dumpDataLines(void)
 {
-  if (!working_string.empty()) {
-    for (auto s: split(working_string, '\n'))
-      current_element->AddData(s);
+  // Split the text in trimmed lines in a single pass over the buffer. Empty
+  // lines are skipped.
+  const size_t len = working_string.size();
+  size_t start = 0;
+
+  while (start < len) {
+    size_t end = working_string.find('\n', start);
+    if (end == string::npos) end = len;
+
+    size_t first = start, last = end;
+    while (first < last && isspace((unsigned char)working_string[first])) ++first;
+    while (last > first && isspace((unsigned char)working_string[last-1])) --last;
+
+    if (first < last)
+      current_element->AddData(working_string.substr(first, last-first));
+
+    start = end + 1;
   }
   working_string.erase();
 }
@@ -82,7 +99,10 @@ void FGXMLParse::startElement (const char * name, const XMLAttributes &atts)
   }
 
   current_element->SetLineNumber(getLine());
-  current_element->SetFileName(getPath());
+  // All the elements of a document share the same file name string.
+  if (!file_name || *file_name != getPath())
+    file_name = make_shared<const string>(getPath());
+  current_element->SetFileName(file_name);
 
   for (int i=0; i<atts.size();i++) {
     current_element->AddAttribute(atts.getName(i), atts.getValue(i));
@@ -101,7 +121,7 @@ void FGXMLParse::endElement (const char * name)
 
 void FGXMLParse::data (const char * s, int length)
 {
-  working_string += string(s, length);
+  working_string.append(s, length);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -81,6 +81,7 @@ private:
   void dumpDataLines(void);
 
   std::string working_string;
+  std::shared_ptr<const std::string> file_name;
   Element_ptr document;
   Element *current_element;
 };
@@ -38,10 +38,11 @@ INCLUDES
 #define _GNU_SOURCE 1
 #endif
 #include <errno.h>
+#include <cctype>
+#include <charconv>
+#include <cmath>
 #include <iostream>
-#include <sstream>
 #include <stdio.h>
-#include <regex>
 #ifdef __APPLE__
 #include <xlocale.h>
 #else
@@ -79,63 +80,130 @@ struct CNumericLocale
   locale_t Locale;
 };
 
+/* Scans the characters [first, last) for a number with the format
+ *   [+-]?(\d+(\.\d*)?|\.\d+)([eE][+-]?\d+)?
+ * Returns a pointer past the last character of the number or nullptr if the
+ * characters do not start with a number with that format.
+ */
+static const char* scan_number(const char* first, const char* last)
+{
+  const char* p = first;
+  bool mantissa = false;
+
+  if (p != last && (*p == '+' || *p == '-')) ++p;
+  while (p != last && isdigit((unsigned char)*p)) { ++p; mantissa = true; }
+  if (p != last && *p == '.') {
+    ++p;
+    while (p != last && isdigit((unsigned char)*p)) { ++p; mantissa = true; }
+  }
+  if (!mantissa) return nullptr;
+
+  if (p != last && (*p == 'e' || *p == 'E')) {
+    ++p;
+    if (p != last && (*p == '+' || *p == '-')) ++p;
+    if (p == last || !isdigit((unsigned char)*p)) return nullptr;
+    while (p != last && isdigit((unsigned char)*p)) ++p;
+  }
+
+  return p;
+}
+
+/* Converts the characters [first, last) to a double. The characters must have
+ * been validated by scan_number() beforehand.
+ */
+static double convert_number(const char* first, const char* last)
+{
+  double value = 0.0;
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  // std::from_chars does not accept a leading plus sign.
+  const char* start = *first == '+' ? first+1 : first;
+  auto [ptr, ec] = from_chars(start, last, value);
+  if (ec == errc() && ptr == last) return value;
+  // Out of range values are processed below to report overflows and to round
+  // underflows down to zero exactly as strtod() does.
+#endif
+
+  static const CNumericLocale numeric_c;
+  const string number(first, last);
+  errno = 0;          // Reset the error code
+  value = strtod_l(number.c_str(), nullptr, numeric_c.Locale);
+
+  if (fabs(value) == HUGE_VAL && errno == ERANGE)
+    throw InvalidNumber("This number is too large: " + number);
+
+  return value;
+}
+
 /* A locale independent version of atof().
  * Whatever is the current locale of the application, atof_locale_c() reads
  * numbers assuming that the decimal point is the period (.)
  */
 double atof_locale_c(const string& input)
 {
-  static const std::regex number_format(R"(^\s*[+-]?(\d+(\.\d*)?|\.\d+)([eE][+-]?\d+)?\s*$)");
   const char* first = input.c_str();
+  const char* last = first + input.size();
 
-  // Skip leading whitespaces
-  while (isspace(*first)) ++first;
+  // Skip leading and trailing whitespaces
+  while (first != last && isspace((unsigned char)*first)) ++first;
 
-  if (!*first)
+  if (first == last)
     throw InvalidNumber("Expecting a numeric attribute value, but only got spaces");
 
-  if (!std::regex_match(input, number_format))
+  while (isspace((unsigned char)*(last-1))) --last;
+
+  if (scan_number(first, last) != last)
     throw InvalidNumber("Expecting a numeric attribute value, but got: " + input);
 
-  CNumericLocale numeric_c;
-  errno = 0;          // Reset the error code
-  double value = strtod_l(first, nullptr, numeric_c.Locale);
+  return convert_number(first, last);
+}
 
-  // Error management
-  std::stringstream s;
+/* Reads a list of numbers separated by whitespaces.
+ * The numbers are appended to the vector 'values' and their count is returned.
+ * An InvalidNumber exception is thrown if any of the items is not a number.
+ */
+size_t atof_locale_c(const string& input, vector<double>& values)
+{
+  const char* p = input.c_str();
+  const char* end = p + input.size();
+  size_t count = 0;
 
-  if (fabs(value) == HUGE_VAL && errno == ERANGE)
-    s << "This number is too large: " << input;
-  else if (fabs(value) == 0 && errno == EINVAL)
-    s << "Expecting a numeric attribute value, but got: " << input;
-  else
-    return value;
+  while (true) {
+    while (p != end && isspace((unsigned char)*p)) ++p;
+    if (p == end) break;
+
+    const char* last = p;
+    while (last != end && !isspace((unsigned char)*last)) ++last;
 
-  throw InvalidNumber(s.str());
+    if (scan_number(p, last) != last)
+      throw InvalidNumber("Expecting a numeric value, but got: " + string(p, last));
+
+    values.push_back(convert_number(p, last));
+    ++count;
+    p = last;
+  }
+
+  return count;
 }
 
 
 std::string& trim_left(std::string& str)
 {
-  while (!str.empty() && isspace((unsigned char)str[0])) {
-    str = str.erase(0,1);
-  }
-  return str;
+  size_t first = 0;
+  while (first < str.size() && isspace((unsigned char)str[first])) ++first;
+  return str.erase(0, first);
 }
 
 std::string& trim_right(std::string& str)
 {
-  while (!str.empty() && isspace((unsigned char)str[str.size()-1])) {
-    str = str.erase(str.size()-1,1);
-  }
-  return str;
+  size_t last = str.size();
+  while (last > 0 && isspace((unsigned char)str[last-1])) --last;
+  return str.erase(last);
 }
 
 std::string& trim(std::string& str)
 {
-  if (str.empty()) return str;
-  std::string temp_str = trim_right(str);
-  return str = trim_left(temp_str);
+  return trim_left(trim_right(str));
 }
 
 std::string& trim_all_space(std::string& str)
@@ -175,20 +243,21 @@ bool is_number(const std::string& str)
 std::vector <std::string> split(std::string str, char d)
 {
   std::vector <std::string> str_array;
-  size_t index=0;
+  size_t index=0, start=0;
   std::string temp = "";
 
   trim(str);
   index = str.find(d);
   while (index != std::string::npos) {
-    temp = str.substr(0,index);
+    temp = str.substr(start, index-start);
     trim(temp);
     if (!temp.empty()) str_array.push_back(temp);
-    str = str.erase(0,index+1);
-    index = str.find(d);
+    start = index+1;
+    index = str.find(d, start);
   }
-  if (!str.empty()) {
-    temp = trim(str);
+  if (start < str.size()) {
+    temp = str.substr(start);
+    trim(temp);
     if (!temp.empty()) str_array.push_back(temp);
   }
 
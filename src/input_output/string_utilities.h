@@ -49,6 +49,7 @@ CLASS DECLARATION
 
 namespace JSBSim {
 JSBSIM_API double atof_locale_c(const std::string& input);
+JSBSIM_API size_t atof_locale_c(const std::string& input, std::vector<double>& values);
 JSBSIM_API std::string& trim_left(std::string& str);
 JSBSIM_API std::string& trim_right(std::string& str);
 JSBSIM_API std::string& trim(std::string& str);
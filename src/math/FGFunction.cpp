@@ -78,7 +78,7 @@ public:
   aFunc(const func_t& _f, FGFDMExec* fdmex, Element* el,
         const string& prefix, FGPropertyValue* v, unsigned int Nmax=Nmin,
         FGFunction::OddEven odd_even=FGFunction::OddEven::Either)
-    : FGFunction(fdmex->GetPropertyManager()), f(_f)
+    : FGFunction(fdmex->GetPropertyManager()), f(_f), operation(el->GetName())
   {
     Load(el, v, fdmex, prefix);
     CheckMinArguments(el, Nmin);
@@ -90,6 +90,11 @@ public:
     return cached ? cachedValue : f(Parameters);
   }
 
+  double GetDerivative(const FGDerivativeSeeds&) const override {
+    throw BaseException("The function <" + operation
+                        + "> cannot be differentiated.");
+  }
+
 protected:
   void bind(Element* el, const string& Prefix) override {
     string nName = CreateOutputNode(el, Prefix);
@@ -99,6 +104,28 @@ protected:
 
 private:
   const func_t f;
+  const string operation;
+};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Functions that can be differentiated. The functor df computes the derivative
+// of the function from the derivatives of its parameters.
+
+template<typename func_t, typename dfunc_t, unsigned int Nmin>
+class aDiffFunc: public aFunc<func_t, Nmin>
+{
+public:
+  aDiffFunc(const func_t& _f, const dfunc_t& _df, FGFDMExec* fdmex, Element* el,
+            const string& prefix, FGPropertyValue* v, unsigned int Nmax=Nmin,
+            FGFunction::OddEven odd_even=FGFunction::OddEven::Either)
+    : aFunc<func_t, Nmin>(_f, fdmex, el, prefix, v, Nmax, odd_even), df(_df) {}
+
+  double GetDerivative(const FGDerivativeSeeds& seeds) const override {
+    return df(this->Parameters, seeds);
+  }
+
+private:
+  const dfunc_t df;
 };
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -134,6 +161,10 @@ public:
     return false;
   }
 
+  double GetDerivative(const FGDerivativeSeeds&) const override {
+    throw BaseException("Random functions cannot be differentiated.");
+  }
+
 protected:
   // The method GetValue() is not bound for functions without parameters because
   // we do not want the property to return a different value each time it is
@@ -163,17 +194,28 @@ bool GetBinary(double val, const string &ctxMsg)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Derivative of the functions that are piecewise constant.
+
+double zero_fn(double) { return 0.0; }
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // Hides the machinery to create a class for functions from <math.h> such as
-// sin, cos, exp, etc.
+// sin, cos, exp, etc. The function dmath_fn is the derivative of math_fn.
 
-FGFunction* make_MathFn(double(*math_fn)(double), FGFDMExec* fdmex, Element* el,
-                        const string& prefix, FGPropertyValue* v)
+FGFunction* make_MathFn(double(*math_fn)(double), double(*dmath_fn)(double),
+                        FGFDMExec* fdmex, Element* el, const string& prefix,
+                        FGPropertyValue* v)
 {
   auto f = [math_fn](const std::vector<FGParameter_ptr> &p)->double {
              return math_fn(p[0]->GetValue());
            };
-  return new aFunc<decltype(f), 1>(f, fdmex, el, prefix, v);
+  auto df = [dmath_fn](const std::vector<FGParameter_ptr> &p,
+                       const FGDerivativeSeeds& seeds)->double {
+              double dx = p[0]->GetDerivative(seeds);
+              return dx != 0.0 ? dmath_fn(p[0]->GetValue())*dx : 0.0;
+            };
+  return new aDiffFunc<decltype(f), decltype(df), 1>(f, df, fdmex, el, prefix, v);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -181,12 +223,14 @@ FGFunction* make_MathFn(double(*math_fn)(double), FGFDMExec* fdmex, Element* el,
 // It handles the special case where a single argument is provided to the
 // function: in that case the function is ignored and replaced by its argument.
 
-template<typename func_t>
-FGParameter_ptr VarArgsFn(const func_t& _f, FGFDMExec* fdmex, Element* el,
-                          const string& prefix, FGPropertyValue* v)
+template<typename func_t, typename dfunc_t>
+FGParameter_ptr VarArgsFn(const func_t& _f, const dfunc_t& _df,
+                          FGFDMExec* fdmex, Element* el, const string& prefix,
+                          FGPropertyValue* v)
 {
   try {
-    return new aFunc<func_t, 2>(_f, fdmex, el, prefix, v, MaxArgs);
+    return new aDiffFunc<func_t, dfunc_t, 2>(_f, _df, fdmex, el, prefix, v,
+                                             MaxArgs);
   }
   catch(WrongNumberOfArguments& e) {
     if ((e.GetElement() == el) && (e.NumberOfArguments() == 1)) {
@@ -320,6 +364,19 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
 
                return temp;
              };
+  auto dsum = [](const decltype(Parameters)& Parameters,
+                 const FGDerivativeSeeds& seeds)->double {
+                double temp = 0.0;
+
+                for (auto p: Parameters)
+                  temp += p->GetDerivative(seeds);
+
+                return temp;
+              };
+  // Derivative of the comparison and logical operators.
+  auto zero = [](const decltype(Parameters)&, const FGDerivativeSeeds&)->double {
+                return 0.0;
+              };
 
   while (element) {
     string operation = element->GetName();
@@ -384,14 +441,31 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
 
                  return temp;
                };
-      Parameters.push_back(VarArgsFn<decltype(f)>(f, fdmex, element, Prefix, var));
+      auto df = [](const decltype(Parameters)& Parameters,
+                   const FGDerivativeSeeds& seeds)->double {
+                  double temp = 1.0, dtemp = 0.0;
+
+                  for (auto p: Parameters) {
+                    double x = p->GetValue();
+                    dtemp = dtemp*x + temp*p->GetDerivative(seeds);
+                    temp *= x;
+                  }
+
+                  return dtemp;
+                };
+      Parameters.push_back(VarArgsFn<decltype(f), decltype(df)>(f, df, fdmex, element, Prefix, var));
     } else if (operation == "sum") {
-      Parameters.push_back(VarArgsFn<decltype(sum)>(sum, fdmex, element, Prefix, var));
+      Parameters.push_back(VarArgsFn<decltype(sum), decltype(dsum)>(sum, dsum, fdmex, element, Prefix, var));
     } else if (operation == "avg") {
       auto avg = [&](const decltype(Parameters)& p)->double {
                    return sum(p) / p.size();
                  };
-      Parameters.push_back(VarArgsFn<decltype(avg)>(avg, fdmex, element, Prefix, var));
+      // Copies dsum which goes out of scope when Load() returns.
+      auto davg = [dsum](const decltype(Parameters)& p,
+                         const FGDerivativeSeeds& seeds)->double {
+                    return dsum(p, seeds) / p.size();
+                  };
+      Parameters.push_back(VarArgsFn<decltype(avg), decltype(davg)>(avg, davg, fdmex, element, Prefix, var));
     } else if (operation == "difference") {
       auto f = [](const decltype(Parameters)& Parameters)->double {
                  double temp = Parameters[0]->GetValue();
@@ -401,7 +475,16 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
 
                  return temp;
                };
-      Parameters.push_back(VarArgsFn<decltype(f)>(f, fdmex, element, Prefix, var));
+      auto df = [](const decltype(Parameters)& Parameters,
+                   const FGDerivativeSeeds& seeds)->double {
+                  double temp = Parameters[0]->GetDerivative(seeds);
+
+                  for (auto p = Parameters.begin()+1; p != Parameters.end(); ++p)
+                    temp -= (*p)->GetDerivative(seeds);
+
+                  return temp;
+                };
+      Parameters.push_back(VarArgsFn<decltype(f), decltype(df)>(f, df, fdmex, element, Prefix, var));
     } else if (operation == "min") {
       auto f = [](const decltype(Parameters)& Parameters)->double {
                  double _min = HUGE_VAL;
@@ -414,7 +497,23 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
 
                  return _min;
                };
-      Parameters.push_back(VarArgsFn<decltype(f)>(f, fdmex, element, Prefix, var));
+      // The derivative is the derivative of the selected parameter.
+      auto df = [](const decltype(Parameters)& Parameters,
+                   const FGDerivativeSeeds& seeds)->double {
+                  double _min = HUGE_VAL;
+                  FGParameter* selected = Parameters[0];
+
+                  for (auto p : Parameters) {
+                    double x = p->GetValue();
+                    if (x < _min) {
+                      _min = x;
+                      selected = p;
+                    }
+                  }
+
+                  return selected->GetDerivative(seeds);
+                };
+      Parameters.push_back(VarArgsFn<decltype(f), decltype(df)>(f, df, fdmex, element, Prefix, var));
     } else if (operation == "max") {
       auto f = [](const decltype(Parameters)& Parameters)->double {
                  double _max = -HUGE_VAL;
@@ -427,7 +526,23 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
 
                  return _max;
                };
-      Parameters.push_back(VarArgsFn<decltype(f)>(f, fdmex, element, Prefix, var));
+      // The derivative is the derivative of the selected parameter.
+      auto df = [](const decltype(Parameters)& Parameters,
+                   const FGDerivativeSeeds& seeds)->double {
+                  double _max = -HUGE_VAL;
+                  FGParameter* selected = Parameters[0];
+
+                  for (auto p : Parameters) {
+                    double x = p->GetValue();
+                    if (x > _max) {
+                      _max = x;
+                      selected = p;
+                    }
+                  }
+
+                  return selected->GetDerivative(seeds);
+                };
+      Parameters.push_back(VarArgsFn<decltype(f), decltype(df)>(f, df, fdmex, element, Prefix, var));
     } else if (operation == "and") {
       string ctxMsg = element->ReadFrom();
       auto f = [ctxMsg](const decltype(Parameters)& Parameters)->double {
@@ -438,8 +553,8 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
 
                  return 1.0;
                };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, fdmex, element, Prefix,
-                                                     var, MaxArgs));
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(zero), 2>(f, zero, fdmex, element,
+                                                                         Prefix, var, MaxArgs));
     } else if (operation == "or") {
       string ctxMsg = element->ReadFrom();
       auto f = [ctxMsg](const decltype(Parameters)& Parameters)->double {
@@ -450,78 +565,132 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
 
                  return 0.0;
                };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, fdmex, element, Prefix,
-                                                     var, MaxArgs));
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(zero), 2>(f, zero, fdmex, element,
+                                                                         Prefix, var, MaxArgs));
     } else if (operation == "quotient") {
       auto f = [](const decltype(Parameters)& p)->double {
                  double y = p[1]->GetValue();
                  return y != 0.0 ? p[0]->GetValue()/y : HUGE_VAL;
                };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, fdmex, element, Prefix, var));
+      auto df = [](const decltype(Parameters)& p,
+                   const FGDerivativeSeeds& seeds)->double {
+                  double y = p[1]->GetValue();
+                  if (y == 0.0) return HUGE_VAL;
+                  double dx = p[0]->GetDerivative(seeds);
+                  double dy = p[1]->GetDerivative(seeds);
+                  return (dx - p[0]->GetValue()*dy/y)/y;
+                };
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(df), 2>(f, df, fdmex, element, Prefix, var));
     } else if (operation == "pow") {
       auto f = [](const decltype(Parameters)& p)->double {
                  return pow(p[0]->GetValue(), p[1]->GetValue());
                };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, fdmex, element, Prefix, var));
+      auto df = [](const decltype(Parameters)& p,
+                   const FGDerivativeSeeds& seeds)->double {
+                  double x = p[0]->GetValue();
+                  double y = p[1]->GetValue();
+                  double dx = p[0]->GetDerivative(seeds);
+                  double dy = p[1]->GetDerivative(seeds);
+                  double result = dx != 0.0 ? y*pow(x, y-1.0)*dx : 0.0;
+                  if (dy != 0.0) result += pow(x, y)*log(x)*dy;
+                  return result;
+                };
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(df), 2>(f, df, fdmex, element, Prefix, var));
     } else if (operation == "toradians") {
       auto f = [](const decltype(Parameters)& p)->double {
                  return p[0]->GetValue()*M_PI/180.;
                };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, fdmex, element, Prefix, var));
+      auto df = [](const decltype(Parameters)& p,
+                   const FGDerivativeSeeds& seeds)->double {
+                  return p[0]->GetDerivative(seeds)*M_PI/180.;
+                };
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(df), 1>(f, df, fdmex, element, Prefix, var));
     } else if (operation == "todegrees") {
       auto f = [](const decltype(Parameters)& p)->double {
                  return p[0]->GetValue()*180./M_PI;
                };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, fdmex, element, Prefix, var));
+      auto df = [](const decltype(Parameters)& p,
+                   const FGDerivativeSeeds& seeds)->double {
+                  return p[0]->GetDerivative(seeds)*180./M_PI;
+                };
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(df), 1>(f, df, fdmex, element, Prefix, var));
     } else if (operation == "sqrt") {
       auto f = [](const decltype(Parameters)& p)->double {
                  double x = p[0]->GetValue();
                  return x >= 0.0 ? sqrt(x) : -HUGE_VAL;
                };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, fdmex, element, Prefix, var));
+      auto df = [](const decltype(Parameters)& p,
+                   const FGDerivativeSeeds& seeds)->double {
+                  double dx = p[0]->GetDerivative(seeds);
+                  return dx != 0.0 ? 0.5*dx/sqrt(p[0]->GetValue()) : 0.0;
+                };
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(df), 1>(f, df, fdmex, element, Prefix, var));
     } else if (operation == "log2") {
       auto f = [](const decltype(Parameters)& p)->double {
                  double x = p[0]->GetValue();
                  return x > 0.0 ? log10(x)*invlog2val : -HUGE_VAL;
                };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, fdmex, element, Prefix, var));
+      auto df = [](const decltype(Parameters)& p,
+                   const FGDerivativeSeeds& seeds)->double {
+                  double dx = p[0]->GetDerivative(seeds);
+                  return dx != 0.0 ? dx/(p[0]->GetValue()*M_LN2) : 0.0;
+                };
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(df), 1>(f, df, fdmex, element, Prefix, var));
     } else if (operation == "ln") {
       auto f = [](const decltype(Parameters)& p)->double {
                  double x = p[0]->GetValue();
                  return x > 0.0 ? log(x) : -HUGE_VAL;
                };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, fdmex, element, Prefix, var));
+      auto df = [](const decltype(Parameters)& p,
+                   const FGDerivativeSeeds& seeds)->double {
+                  double dx = p[0]->GetDerivative(seeds);
+                  return dx != 0.0 ? dx/p[0]->GetValue() : 0.0;
+                };
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(df), 1>(f, df, fdmex, element, Prefix, var));
     } else if (operation == "log10") {
       auto f = [](const decltype(Parameters)& p)->double {
                  double x = p[0]->GetValue();
                  return x > 0.0 ? log10(x) : -HUGE_VAL;
                };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, fdmex, element, Prefix, var));
+      auto df = [](const decltype(Parameters)& p,
+                   const FGDerivativeSeeds& seeds)->double {
+                  double dx = p[0]->GetDerivative(seeds);
+                  return dx != 0.0 ? dx/(p[0]->GetValue()*M_LN10) : 0.0;
+                };
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(df), 1>(f, df, fdmex, element, Prefix, var));
     } else if (operation == "sign") {
       auto f = [](const decltype(Parameters)& p)->double {
                  return p[0]->GetValue() < 0.0 ? -1 : 1; // 0.0 counts as positive.
                };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, fdmex, element, Prefix, var));
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(zero), 1>(f, zero, fdmex, element, Prefix, var));
     } else if (operation == "exp") {
-      Parameters.push_back(make_MathFn(exp, fdmex, element, Prefix, var));
+      Parameters.push_back(make_MathFn(exp, [](double x) { return exp(x); },
+                                       fdmex, element, Prefix, var));
     } else if (operation == "abs") {
-      Parameters.push_back(make_MathFn(fabs, fdmex, element, Prefix, var));
+      Parameters.push_back(make_MathFn(fabs, [](double x) { return x < 0.0 ? -1.0 : 1.0; },
+                                       fdmex, element, Prefix, var));
     } else if (operation == "sin") {
-      Parameters.push_back(make_MathFn(sin, fdmex, element, Prefix, var));
+      Parameters.push_back(make_MathFn(sin, [](double x) { return cos(x); },
+                                       fdmex, element, Prefix, var));
     } else if (operation == "cos") {
-      Parameters.push_back(make_MathFn(cos, fdmex, element, Prefix, var));
+      Parameters.push_back(make_MathFn(cos, [](double x) { return -sin(x); },
+                                       fdmex, element, Prefix, var));
     } else if (operation == "tan") {
-      Parameters.push_back(make_MathFn(tan, fdmex, element, Prefix, var));
+      Parameters.push_back(make_MathFn(tan, [](double x) { double c = cos(x); return 1.0/(c*c); },
+                                       fdmex, element, Prefix, var));
     } else if (operation == "asin") {
-      Parameters.push_back(make_MathFn(asin, fdmex, element, Prefix, var));
+      Parameters.push_back(make_MathFn(asin, [](double x) { return 1.0/sqrt(1.0-x*x); },
+                                       fdmex, element, Prefix, var));
     } else if (operation == "acos") {
-      Parameters.push_back(make_MathFn(acos, fdmex, element, Prefix, var));
+      Parameters.push_back(make_MathFn(acos, [](double x) { return -1.0/sqrt(1.0-x*x); },
+                                       fdmex, element, Prefix, var));
     } else if (operation == "atan") {
-      Parameters.push_back(make_MathFn(atan, fdmex, element, Prefix, var));
+      Parameters.push_back(make_MathFn(atan, [](double x) { return 1.0/(1.0+x*x); },
+                                       fdmex, element, Prefix, var));
     } else if (operation == "floor") {
-      Parameters.push_back(make_MathFn(floor, fdmex, element, Prefix, var));
+      Parameters.push_back(make_MathFn(floor, zero_fn, fdmex, element, Prefix, var));
     } else if (operation == "ceil") {
-      Parameters.push_back(make_MathFn(ceil, fdmex, element, Prefix, var));
+      Parameters.push_back(make_MathFn(ceil, zero_fn, fdmex, element, Prefix, var));
     } else if (operation == "fmod") {
       auto f = [](const decltype(Parameters)& p)->double {
                  double y = p[1]->GetValue();
@@ -530,7 +699,7 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
       Parameters.push_back(new aFunc<decltype(f), 2>(f, fdmex, element, Prefix, var));
     } else if (operation == "roundmultiple") {
       if (element->GetNumElements() == 1)
-        Parameters.push_back(make_MathFn(round, fdmex, element, Prefix, var));
+        Parameters.push_back(make_MathFn(round, zero_fn, fdmex, element, Prefix, var));
       else {
         auto f = [](const decltype(Parameters)& p)->double {
                    double multiple = p[1]->GetValue();
@@ -542,7 +711,15 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
       auto f = [](const decltype(Parameters)& p)->double {
                  return atan2(p[0]->GetValue(), p[1]->GetValue());
                };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, fdmex, element, Prefix, var));
+      auto df = [](const decltype(Parameters)& p,
+                   const FGDerivativeSeeds& seeds)->double {
+                  double y = p[0]->GetValue();
+                  double x = p[1]->GetValue();
+                  double dy = p[0]->GetDerivative(seeds);
+                  double dx = p[1]->GetDerivative(seeds);
+                  return (x*dy - y*dx)/(x*x + y*y);
+                };
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(df), 2>(f, df, fdmex, element, Prefix, var));
     } else if (operation == "mod") {
       auto f = [](const decltype(Parameters)& p)->double {
                  return static_cast<int>(p[0]->GetValue()) % static_cast<int>(p[1]->GetValue());
@@ -553,50 +730,54 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
                  double scratch;
                  return modf(p[0]->GetValue(), &scratch);
                };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, fdmex, element, Prefix, var));
+      auto df = [](const decltype(Parameters)& p,
+                   const FGDerivativeSeeds& seeds)->double {
+                  return p[0]->GetDerivative(seeds);
+                };
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(df), 1>(f, df, fdmex, element, Prefix, var));
     } else if (operation == "integer") {
       auto f = [](const decltype(Parameters)& p)->double {
                  double result;
                  modf(p[0]->GetValue(), &result);
                  return result;
                };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, fdmex, element, Prefix, var));
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(zero), 1>(f, zero, fdmex, element, Prefix, var));
     } else if (operation == "lt") {
       auto f = [](const decltype(Parameters)& p)->double {
                  return p[0]->GetValue() < p[1]->GetValue() ? 1.0 : 0.0;
                };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, fdmex, element, Prefix, var));
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(zero), 2>(f, zero, fdmex, element, Prefix, var));
     } else if (operation == "le") {
       auto f = [](const decltype(Parameters)& p)->double {
                  return p[0]->GetValue() <= p[1]->GetValue() ? 1.0 : 0.0;
                };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, fdmex, element, Prefix, var));
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(zero), 2>(f, zero, fdmex, element, Prefix, var));
     } else if (operation == "gt") {
       auto f = [](const decltype(Parameters)& p)->double {
                  return p[0]->GetValue() > p[1]->GetValue() ? 1.0 : 0.0;
                };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, fdmex, element, Prefix, var));
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(zero), 2>(f, zero, fdmex, element, Prefix, var));
     } else if (operation == "ge") {
       auto f = [](const decltype(Parameters)& p)->double {
                  return p[0]->GetValue() >= p[1]->GetValue() ? 1.0 : 0.0;
                };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, fdmex, element, Prefix, var));
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(zero), 2>(f, zero, fdmex, element, Prefix, var));
     } else if (operation == "eq") {
       auto f = [](const decltype(Parameters)& p)->double {
                  return p[0]->GetValue() == p[1]->GetValue() ? 1.0 : 0.0;
                };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, fdmex, element, Prefix, var));
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(zero), 2>(f, zero, fdmex, element, Prefix, var));
     } else if (operation == "nq") {
       auto f = [](const decltype(Parameters)& p)->double {
                  return p[0]->GetValue() != p[1]->GetValue() ? 1.0 : 0.0;
                };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, fdmex, element, Prefix, var));
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(zero), 2>(f, zero, fdmex, element, Prefix, var));
     } else if (operation == "not") {
       string ctxMsg = element->ReadFrom();
       auto f = [ctxMsg](const decltype(Parameters)& p)->double {
                  return GetBinary(p[0]->GetValue(), ctxMsg) ? 0.0 : 1.0;
                };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, fdmex, element, Prefix, var));
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(zero), 1>(f, zero, fdmex, element, Prefix, var));
     } else if (operation == "ifthen") {
       string ctxMsg = element->ReadFrom();
       auto f = [ctxMsg](const decltype(Parameters)& p)->double {
@@ -605,7 +786,14 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
                  else
                    return p[2]->GetValue();
                };
-      Parameters.push_back(new aFunc<decltype(f), 3>(f, fdmex, element, Prefix, var));
+      auto df = [ctxMsg](const decltype(Parameters)& p,
+                         const FGDerivativeSeeds& seeds)->double {
+                  if (GetBinary(p[0]->GetValue(), ctxMsg))
+                    return p[1]->GetDerivative(seeds);
+                  else
+                    return p[2]->GetDerivative(seeds);
+                };
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(df), 3>(f, df, fdmex, element, Prefix, var));
     } else if (operation == "random") {
       double mean = 0.0;
       double stddev = 1.0;
@@ -688,8 +876,16 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
                    throw BaseException("Fatal error");
                  }
                };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, fdmex, element, Prefix,
-                                                     var, MaxArgs));
+      // The derivative is the derivative of the selected value. The index is
+      // checked by the computation of the value.
+      auto df = [f](const decltype(Parameters)& p,
+                    const FGDerivativeSeeds& seeds)->double {
+                  f(p);
+                  size_t i = static_cast<size_t>(p[0]->GetValue()+0.5);
+                  return p[i+1]->GetDerivative(seeds);
+                };
+      Parameters.push_back(new aDiffFunc<decltype(f), decltype(df), 2>(f, df, fdmex, element,
+                                                                       Prefix, var, MaxArgs));
     } else if (operation == "interpolate1d") {
       auto f = [](const decltype(Parameters)& p)->double {
                  // This is using the bisection algorithm. Special care has been
@@ -977,6 +1173,13 @@ double FGFunction::GetValue(void) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+double FGFunction::GetDerivative(const FGDerivativeSeeds& seeds) const
+{
+  return Parameters[0]->GetDerivative(seeds);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string FGFunction::GetValueAsString(void) const
 {
   ostringstream buffer;
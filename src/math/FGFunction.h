@@ -801,6 +801,17 @@ public:
     @return the total value of the function. */
   double GetValue(void) const override;
 
+/** Computes the derivative of the function with respect to a variable.
+    The arithmetic and trigonometric operations, the tables and the
+    conditional operations are differentiated analytically. The comparison and
+    logical operations have a null derivative.
+    @param seeds the derivatives of the properties with respect to the
+                 variable.
+    @return the derivative of the function.
+    @throws BaseException if an operation of the function (such as \<random>
+            or \<interpolate1d>) cannot be differentiated. */
+  double GetDerivative(const FGDerivativeSeeds& seeds) const override;
+
 /** The value that the function evaluates to, as a string.
   @return the value of the function as a string. */
   std::string GetValueAsString(void) const;
@@ -808,6 +819,9 @@ public:
 /// Retrieves the name of the function.
   std::string GetName(void) const override {return Name;}
 
+/// Retrieves the property in which the function value is stored (if any).
+  SGPropertyNode* GetOutputNode(void) const { return pNode; }
+
 /** Does the function always return the same result (i.e. does it apply to
     constant parameters) ? */
   bool IsConstant(void) const override;
@@ -65,6 +65,9 @@ public:
     :FGPropertyValue(propName, propertyManager, el), function(f) {}
 
   double GetValue(void) const override { return function->GetValue(GetNode()); }
+  double GetDerivative(const FGDerivativeSeeds& seeds) const override {
+    return function->GetDerivative(GetNode(), seeds);
+  }
 
   std::string GetName(void) const override {
     return function->GetName() + "(" + FGPropertyValue::GetName() + ")";
@@ -0,0 +1,344 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGGravityField.cpp
+ Date started: 10/17/26
+ Purpose:      Spherical harmonic expansion of a planet gravitational field
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+The gravitation is obtained from the gradient of the potential
+
+      GM   N   n   (R)^n
+  U = --  Sum Sum  (-)   Pnm(sin(lat)) (Cnm cos(m lon) + Snm sin(m lon))
+      r   n=0 m=0  (r)
+
+which is computed with the recursions of the normalized Cunningham functions
+Vnm and Wnm (O. Montenbruck, E. Gill, "Satellite Orbits", Springer, 2000,
+eqns 3.29-3.33). The normalization factors of these functions have been merged
+in the recursion factors which are computed once when the coefficients are
+loaded.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/17/26   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cmath>
+#include <sstream>
+
+#include "FGGravityField.h"
+#include "input_output/string_utilities.h"
+#include "simgear/misc/sg_path.hxx"
+#include "simgear/io/iostreams/sgstream.hxx"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGGravityField::FGGravityField(void)
+  : GM(0.0), radius(0.0), degree(0), cache_distance(0.0), cache_valid(false)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGGravityField::Load(const SGPath& path, unsigned int max_degree)
+{
+  sg_ifstream input(path);
+
+  if (!input.is_open())
+    throw BaseException("Could not open the gravity field file: "
+                        + path.utf8Str());
+
+  try {
+    Load(input, max_degree);
+  }
+  catch (BaseException& e) {
+    throw BaseException(path.utf8Str() + ": " + e.what());
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+// Numbers in ICGEM files are sometimes written with the Fortran exponent
+// notation (e.g. 0.484165143790815D-03).
+static double ReadNumber(string token)
+{
+  for (char& c: token)
+    if (c == 'D' || c == 'd') c = 'E';
+
+  return atof_locale_c(token);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGGravityField::Load(istream& input, unsigned int max_degree)
+{
+  string line, key, value;
+  double gm = 0.0, r = 0.0;
+  bool normalized = true;
+  bool header = true;
+  bool central_term = false;
+  unsigned int line_number = 0, n_max = 0;
+  vector<double> Cnm, Snm;
+
+  auto error = [&line_number](const string& msg) {
+    return BaseException("line " + to_string(line_number) + ": " + msg);
+  };
+
+  while (getline(input, line)) {
+    line_number++;
+    istringstream tokens(line);
+
+    if (!(tokens >> key)) continue;
+
+    if (header) {
+      if (key == "end_of_head")
+        header = false;
+      else if (key == "earth_gravity_constant" || key == "gravity_constant") {
+        tokens >> value;
+        gm = ReadNumber(value);
+      }
+      else if (key == "radius") {
+        tokens >> value;
+        r = ReadNumber(value);
+      }
+      else if (key == "norm") {
+        tokens >> value;
+        normalized = value != "unnormalized";
+      }
+      continue;
+    }
+
+    // Time variable terms (gfct, trnd, asin, acos) are not supported.
+    if (key != "gfc") continue;
+
+    unsigned int n, m;
+    string c, s;
+    if (!(tokens >> n >> m >> c >> s))
+      throw error("ill formed coefficient.");
+    if (m > n)
+      throw error("the order " + to_string(m) + " exceeds the degree "
+                  + to_string(n) + ".");
+    if (n > max_degree) continue;
+
+    unsigned int idx = Index(n, m);
+    if (idx >= Cnm.size()) {
+      Cnm.resize(Index(n+1, 0), 0.0);
+      Snm.resize(Index(n+1, 0), 0.0);
+    }
+    n_max = max(n, n_max);
+    if (n == 0) central_term = true;
+    Cnm[idx] = ReadNumber(c);
+    Snm[idx] = ReadNumber(s);
+
+    if (!normalized) {
+      // Pnm = Nnm*Pnm_bar with Nnm = sqrt((n+m)!/((2-delta_0m)(2n+1)(n-m)!))
+      double logN = 0.5*(lgamma(n+m+1.0) - lgamma(n-m+1.0) - log(2.0*n+1.0));
+      if (m > 0) logN -= 0.5*log(2.0);
+      double N = exp(logN);
+      Cnm[idx] *= N;
+      Snm[idx] *= N;
+    }
+  }
+
+  if (header)
+    throw BaseException("the keyword end_of_head is missing.");
+  if (gm <= 0.0)
+    throw BaseException("the gravity constant is missing or invalid.");
+  if (r <= 0.0)
+    throw BaseException("the reference radius is missing or invalid.");
+  if (Cnm.empty())
+    throw BaseException("no coefficients have been found.");
+
+  // Some files only list the perturbations of the point mass gravity. Without
+  // the central term C00 the gravitation would be nearly zero.
+  if (!central_term) Cnm[0] = 1.0;
+
+  GM = gm / (fttom*fttom*fttom);
+  radius = r / fttom;
+  degree = n_max;
+  Cnm.resize(Index(degree+1, 0));
+  Snm.resize(Index(degree+1, 0));
+  C.swap(Cnm);
+  S.swap(Snm);
+
+  InitRecursion();
+  cache_valid = false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGGravityField::InitRecursion(void)
+{
+  // The accelerations of degree n need the functions of degree n+1.
+  unsigned int N1 = degree + 1;
+  unsigned int size = Index(N1+1, 0);
+
+  V.assign(size, 0.0);
+  W.assign(size, 0.0);
+  diag.assign(N1+1, 0.0);
+  A.assign(size, 0.0);
+  B.assign(size, 0.0);
+
+  for (unsigned int m=1; m<=N1; m++)
+    diag[m] = m == 1 ? sqrt(3.0) : sqrt((2.0*m+1.0)/(2.0*m));
+
+  for (unsigned int m=0; m<=N1; m++) {
+    for (unsigned int n=m+1; n<=N1; n++) {
+      double nm = n-m, np = n+m;
+      unsigned int idx = Index(n, m);
+      A[idx] = sqrt((2.0*n+1.0)*(2.0*n-1.0)/(nm*np));
+      if (n > m+1)
+        B[idx] = sqrt((2.0*n+1.0)*(np-1.0)*(nm-1.0)/((2.0*n-3.0)*np*nm));
+    }
+  }
+
+  size = Index(degree+1, 0);
+  Fxy1.assign(size, 0.0);
+  Fxy2.assign(size, 0.0);
+  Fz.assign(size, 0.0);
+
+  for (unsigned int n=0; n<=degree; n++) {
+    double ratio = (2.0*n+1.0)/(2.0*n+3.0);
+    for (unsigned int m=0; m<=n; m++) {
+      double nm = n-m, np = n+m;
+      unsigned int idx = Index(n, m);
+      if (m == 0)
+        Fxy1[idx] = sqrt(0.5*ratio*(n+1.0)*(n+2.0));
+      else {
+        double k = m == 1 ? 2.0 : 1.0;
+        Fxy1[idx] = 0.5*sqrt(ratio*(np+1.0)*(np+2.0));
+        Fxy2[idx] = 0.5*sqrt(k*ratio*(nm+1.0)*(nm+2.0));
+      }
+      Fz[idx] = sqrt(ratio*(np+1.0)*(nm+1.0));
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGGravityField::SetCacheDistance(double distance)
+{
+  cache_distance = max(distance, 0.0);
+  cache_valid = false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGColumnVector3
+FGGravityField::GetGravitation(const FGColumnVector3& position) const
+{
+  double r = position.Magnitude();
+
+  if (cache_distance <= 0.0)
+    cache_valid = false;
+  else if (cache_valid
+           && (position - cached_position).Magnitude() >= cache_distance)
+    cache_valid = false;
+
+  if (!cache_valid) {
+    cached_perturbation = GetPerturbation(position);
+    cached_position = position;
+    cache_valid = cache_distance > 0.0;
+  }
+
+  // The point mass term is always evaluated at the actual position.
+  return cached_perturbation - (GM*C[0]/(r*r*r))*position;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the gravitation of the terms of degree 1 and higher.
+
+FGColumnVector3
+FGGravityField::GetPerturbation(const FGColumnVector3& position) const
+{
+  const unsigned int N1 = degree + 1;
+  double r2 = DotProduct(position, position);
+  double rho = radius / r2;
+  double x0 = position(eX) * rho;
+  double y0 = position(eY) * rho;
+  double z0 = position(eZ) * rho;
+  double rho2 = radius * rho;
+
+  V[0] = radius / sqrt(r2);
+  W[0] = 0.0;
+
+  for (unsigned int m=0; m<=N1; m++) {
+    unsigned int idx = Index(m, m);
+
+    if (m > 0) {
+      unsigned int prev = Index(m-1, m-1);
+      V[idx] = diag[m]*(x0*V[prev] - y0*W[prev]);
+      W[idx] = diag[m]*(x0*W[prev] + y0*V[prev]);
+    }
+
+    if (m == N1) break;
+
+    unsigned int i1 = Index(m+1, m);
+    V[i1] = A[i1]*z0*V[idx];
+    W[i1] = A[i1]*z0*W[idx];
+
+    for (unsigned int n=m+2; n<=N1; n++) {
+      unsigned int i = Index(n, m);
+      unsigned int i2 = Index(n-2, m);
+      i1 = Index(n-1, m);
+      V[i] = A[i]*z0*V[i1] - B[i]*rho2*V[i2];
+      W[i] = A[i]*z0*W[i1] - B[i]*rho2*W[i2];
+    }
+  }
+
+  double ax = 0.0, ay = 0.0, az = 0.0;
+
+  for (unsigned int n=1; n<=degree; n++) {
+    unsigned int up = Index(n+1, 0);
+
+    // Zonal term
+    double c = C[Index(n, 0)];
+    ax -= Fxy1[Index(n, 0)]*c*V[up+1];
+    ay -= Fxy1[Index(n, 0)]*c*W[up+1];
+    az -= Fz[Index(n, 0)]*c*V[up];
+
+    // Tesseral and sectorial terms
+    for (unsigned int m=1; m<=n; m++) {
+      unsigned int idx = Index(n, m);
+      c = C[idx];
+      double s = S[idx];
+      double Vp = V[up+m+1], Wp = W[up+m+1];
+      double Vm = V[up+m-1], Wm = W[up+m-1];
+      ax += Fxy1[idx]*(-c*Vp - s*Wp) + Fxy2[idx]*(c*Vm + s*Wm);
+      ay += Fxy1[idx]*(-c*Wp + s*Vp) + Fxy2[idx]*(-c*Wm + s*Vm);
+      az -= Fz[idx]*(c*V[up+m] + s*W[up+m]);
+    }
+  }
+
+  double GMoverR2 = GM / (radius*radius);
+  return FGColumnVector3(ax, ay, az) * GMoverR2;
+}
+}
@@ -0,0 +1,165 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGGravityField.h
+ Date started: 10/17/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/17/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGGRAVITYFIELD_H
+#define FGGRAVITYFIELD_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <iosfwd>
+#include <vector>
+
+#include "FGJSBBase.h"
+#include "FGColumnVector3.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class SGPath;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Spherical harmonic expansion of a planet gravitational field.
+    The coefficients are read from a file in the ICGEM format (the format used
+    to distribute EGM96, EGM2008 and most of the other global gravity models):
+
+    @code
+    modelname              EGM2008
+    earth_gravity_constant 3.986004415E+14
+    radius                 6378136.3
+    max_degree             2190
+    norm                   fully_normalized
+    end_of_head
+    gfc    0    0  1.0                      0.0
+    gfc    2    0 -0.484165143790815D-03    0.0
+    ...
+    @endcode
+
+    The gravitational constant and the reference radius are in SI units. Both
+    fully normalized and unnormalized coefficients are accepted. Only the
+    <tt>gfc</tt> lines are used: the time variable terms of some models are
+    ignored.
+
+    The gravitation is computed in the planet fixed (ECEF) frame with the
+    recursion of Cunningham on the fully normalized functions
+    \f$\bar{V}_{nm}\f$ and \f$\bar{W}_{nm}\f$ (see O. Montenbruck and
+    E. Gill, "Satellite Orbits", section 3.2). Unlike the evaluation of the
+    Legendre functions in spherical coordinates, the recursion is free of
+    singularity at the poles and does not call any trigonometric function. The
+    recursion factors are computed once when the coefficients are loaded so
+    the cost of an evaluation is proportional to \f$(n_{max}+2)^2\f$.
+
+    The evaluation can optionally be skipped when the position has moved less
+    than a given distance since the last evaluation. Only the difference with
+    the point mass gravitation is reused; the point mass term, which has by
+    far the largest gradient, is always computed at the actual position.
+
+    @see SetCacheDistance
+  */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGGravityField : public FGJSBBase
+{
+public:
+  FGGravityField(void);
+
+  /** Load the coefficients from a file. The coefficient C00 of the point
+      mass term is set to 1 when the file does not list it.
+      @param path        the file in ICGEM format.
+      @param max_degree  the coefficients of a higher degree are ignored.
+      @throws BaseException if the file cannot be read or is ill formed. */
+  void Load(const SGPath& path, unsigned int max_degree);
+
+  /** Load the coefficients from a stream. The coefficient C00 of the point
+      mass term is set to 1 when the stream does not list it.
+      @param input       a stream in ICGEM format.
+      @param max_degree  the coefficients of a higher degree are ignored.
+      @throws BaseException if the content is ill formed. */
+  void Load(std::istream& input, unsigned int max_degree);
+
+  /** Evaluate the gravitation.
+      @param position ECEF position in ft.
+      @return the gravitational acceleration in ft/s^2 in the ECEF frame. */
+  FGColumnVector3 GetGravitation(const FGColumnVector3& position) const;
+
+  /** Set the distance below which the last evaluation is reused.
+      @param distance distance in ft. A null distance (the default) disables
+                      the cache. */
+  void SetCacheDistance(double distance);
+  double GetCacheDistance(void) const { return cache_distance; }
+
+  /// Get the degree and order of the expansion.
+  unsigned int GetDegree(void) const { return degree; }
+  /// Get the gravitational constant of the model in ft^3/s^2.
+  double GetGM(void) const { return GM; }
+  /// Get the reference radius of the model in ft.
+  double GetRadius(void) const { return radius; }
+
+private:
+  double GM;
+  double radius;
+  unsigned int degree;
+  double cache_distance;
+
+  // Fully normalized coefficients, stored by index n*(n+1)/2+m.
+  std::vector<double> C, S;
+  // Factors of the recursion of the normalized Cunningham functions.
+  std::vector<double> diag, A, B;
+  // Factors of the accelerations.
+  std::vector<double> Fxy1, Fxy2, Fz;
+  // Work arrays of the Cunningham functions up to the degree+1.
+  mutable std::vector<double> V, W;
+
+  mutable bool cache_valid;
+  mutable FGColumnVector3 cached_position;
+  mutable FGColumnVector3 cached_perturbation;
+
+  void InitRecursion(void);
+  FGColumnVector3 GetPerturbation(const FGColumnVector3& position) const;
+
+  static unsigned int Index(unsigned int n, unsigned int m) {
+    return n*(n+1)/2 + m;
+  }
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
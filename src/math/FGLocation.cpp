@@ -54,7 +54,7 @@ CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 FGLocation::FGLocation(void)
-  : mECLoc(1.0, 0.0, 0.0), mCacheValid(false)
+  : mECLoc(1.0, 0.0, 0.0), mCacheValid(false), mGeodeticValid(false)
 {
   e2 = c = 0.0;
   a = ec = ec2 = 1.0;
@@ -69,7 +69,7 @@ FGLocation::FGLocation(void)
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 FGLocation::FGLocation(double lon, double lat, double radius)
-  : mCacheValid(false)
+  : mCacheValid(false), mGeodeticValid(false)
 {
   e2 = c = 0.0;
   a = ec = ec2 = 1.0;
@@ -92,7 +92,7 @@ FGLocation::FGLocation(double lon, double lat, double radius)
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 FGLocation::FGLocation(const FGColumnVector3& lv)
-  : mECLoc(lv), mCacheValid(false)
+  : mECLoc(lv), mCacheValid(false), mGeodeticValid(false)
 {
   e2 = c = 0.0;
   a = ec = ec2 = 1.0;
@@ -107,7 +107,8 @@ FGLocation::FGLocation(const FGColumnVector3& lv)
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 FGLocation::FGLocation(const FGLocation& l)
-  : mECLoc(l.mECLoc), mCacheValid(l.mCacheValid)
+  : mECLoc(l.mECLoc), mCacheValid(l.mCacheValid),
+    mGeodeticValid(l.mGeodeticValid)
 {
   a = l.a;
   e2 = l.e2;
@@ -122,17 +123,19 @@ FGLocation::FGLocation(const FGLocation& l)
    * If unset, they may possibly contain NaN and could thus trigger floating
    * point exceptions.
    */
-  if (!mCacheValid) return;
+  if (!mGeodeticValid) return;
 
   mLon = l.mLon;
   mLat = l.mLat;
   mRadius = l.mRadius;
 
-  mTl2ec = l.mTl2ec;
-  mTec2l = l.mTec2l;
-
   mGeodLat = l.mGeodLat;
   GeodeticAltitude = l.GeodeticAltitude;
+
+  if (!mCacheValid) return;
+
+  mTl2ec = l.mTl2ec;
+  mTec2l = l.mTec2l;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -141,6 +144,7 @@ FGLocation& FGLocation::operator=(const FGLocation& l)
 {
   mECLoc = l.mECLoc;
   mCacheValid = l.mCacheValid;
+  mGeodeticValid = l.mGeodeticValid;
   mEllipseSet = l.mEllipseSet;
 
   a = l.a;
@@ -150,18 +154,20 @@ FGLocation& FGLocation::operator=(const FGLocation& l)
   ec2 = l.ec2;
 
   //ag See comment in constructor above
-  if (!mCacheValid) return *this;
+  if (!mGeodeticValid) return *this;
 
   mLon = l.mLon;
   mLat = l.mLat;
   mRadius = l.mRadius;
 
-  mTl2ec = l.mTl2ec;
-  mTec2l = l.mTec2l;
-
   mGeodLat = l.mGeodLat;
   GeodeticAltitude = l.GeodeticAltitude;
 
+  if (!mCacheValid) return *this;
+
+  mTl2ec = l.mTl2ec;
+  mTec2l = l.mTec2l;
+
   return *this;
 }
 
@@ -179,7 +185,7 @@ void FGLocation::SetLongitude(double longitude)
   if (rtmp == 0.0)
     return;
 
-  mCacheValid = false;
+  mCacheValid = mGeodeticValid = false;
 
   mECLoc(eX) = rtmp*cos(longitude);
   mECLoc(eY) = rtmp*sin(longitude);
@@ -189,7 +195,7 @@ void FGLocation::SetLongitude(double longitude)
 
 void FGLocation::SetLatitude(double latitude)
 {
-  mCacheValid = false;
+  mCacheValid = mGeodeticValid = false;
 
   double r = mECLoc.Magnitude();
   if (r == 0.0) {
@@ -213,7 +219,7 @@ void FGLocation::SetLatitude(double latitude)
 
 void FGLocation::SetRadius(double radius)
 {
-  mCacheValid = false;
+  mCacheValid = mGeodeticValid = false;
 
   double rold = mECLoc.Magnitude();
   if (rold == 0.0)
@@ -226,7 +232,7 @@ void FGLocation::SetRadius(double radius)
 
 void FGLocation::SetPosition(double lon, double lat, double radius)
 {
-  mCacheValid = false;
+  mCacheValid = mGeodeticValid = false;
 
   double sinLat = sin(lat);
   double cosLat = cos(lat);
@@ -243,7 +249,7 @@ void FGLocation::SetPosition(double lon, double lat, double radius)
 void FGLocation::SetPositionGeodetic(double lon, double lat, double height)
 {
   assert(mEllipseSet);
-  mCacheValid = false;
+  mCacheValid = mGeodeticValid = false;
 
   double slat = sin(lat);
   double clat = cos(lat);
@@ -258,7 +264,7 @@ void FGLocation::SetPositionGeodetic(double lon, double lat, double height)
 
 void FGLocation::SetEllipse(double semimajor, double semiminor)
 {
-  mCacheValid = false;
+  mCacheValid = mGeodeticValid = false;
   mEllipseSet = true;
 
   a = semimajor;
@@ -273,14 +279,14 @@ void FGLocation::SetEllipse(double semimajor, double semiminor)
 double FGLocation::GetSeaLevelRadius(void) const
 {
   assert(mEllipseSet);
-  ComputeDerived();
-  double cosLat = cos(mLat);
+  double cosLat = cos(GetLatitude());
   return a*ec/sqrt(1.0-e2*cosLat*cosLat);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-void FGLocation::ComputeDerivedUnconditional(void) const
+void FGLocation::ComputeGeodeticUnconditional(double& sinLon, double& cosLon,
+                                              double& sinLat, double& cosLat) const
 {
   // The radius is just the Euclidean norm of the vector.
   mRadius = mECLoc.Magnitude();
@@ -290,7 +296,6 @@ void FGLocation::ComputeDerivedUnconditional(void) const
   double rxy = mECLoc.Magnitude(eX, eY);
 
   // Compute the longitude and its sin/cos values.
-  double sinLon, cosLon;
   if (rxy == 0.0) {
     sinLon = 0.0;
     cosLon = 1.0;
@@ -302,7 +307,6 @@ void FGLocation::ComputeDerivedUnconditional(void) const
   }
 
   // Compute the geocentric & geodetic latitudes.
-  double sinLat, cosLat;
   if (mRadius == 0.0)  {
     mLat = 0.0;
     sinLat = 0.0;
@@ -352,6 +356,17 @@ void FGLocation::ComputeDerivedUnconditional(void) const
     }
   }
 
+  mGeodeticValid = true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLocation::ComputeDerivedUnconditional(void) const
+{
+  double sinLon, cosLon, sinLat, cosLat;
+
+  ComputeGeodeticUnconditional(sinLon, cosLon, sinLat, cosLat);
+
   // Compute the transform matrices from and to the earth centered frame.
   // See Stevens and Lewis, "Aircraft Control and Simulation", Second Edition,
   // Eqn. 1.4-13, page 40. In Stevens and Lewis notation, this is C_n/e - the
@@ -378,7 +393,7 @@ double FGLocation::GetDistanceTo(double target_longitude,
                                  double target_latitude) const
 {
   assert(mEllipseSet);
-  ComputeDerived();
+  ComputeGeodetic();
   GeographicLib::Geodesic geod(a, 1 - ec);
   GeographicLib::Math::real distance;
   geod.Inverse(mGeodLat * radtodeg, mLon * radtodeg, target_latitude * radtodeg,
@@ -393,7 +408,7 @@ double FGLocation::GetHeadingTo(double target_longitude,
                                 double target_latitude) const
 {
   assert(mEllipseSet);
-  ComputeDerived();
+  ComputeGeodetic();
   GeographicLib::Geodesic geod(a, 1 - ec);
   GeographicLib::Math::real heading, azimuth2;
   geod.Inverse(mGeodLat * radtodeg, mLon * radtodeg, target_latitude * radtodeg,
@@ -231,25 +231,37 @@ public:
       @return the longitude in rad of the location represented with this
       class instance. The returned values are in the range between
       -pi <= lon <= pi. Longitude is positive east and negative west. */
-  double GetLongitude() const { ComputeDerived(); return mLon; }
+  double GetLongitude() const {
+    return mGeodeticValid ? mLon : ComputeLongitude();
+  }
 
   /** Get the longitude.
       @return the longitude in deg of the location represented with this
       class instance. The returned values are in the range between
       -180 <= lon <= 180.  Longitude is positive east and negative west. */
-  double GetLongitudeDeg() const { ComputeDerived(); return radtodeg*mLon; }
+  double GetLongitudeDeg() const { return radtodeg*GetLongitude(); }
 
   /** Get the sine of Longitude. */
-  double GetSinLongitude() const { ComputeDerived(); return -mTec2l(2,1); }
+  double GetSinLongitude() const {
+    if (mCacheValid) return -mTec2l(2,1);
+    double rxy = mECLoc.Magnitude(eX, eY);
+    return rxy == 0.0 ? 0.0 : mECLoc(eY)/rxy;
+  }
 
   /** Get the cosine of Longitude. */
-  double GetCosLongitude() const { ComputeDerived(); return mTec2l(2,2); }
+  double GetCosLongitude() const {
+    if (mCacheValid) return mTec2l(2,2);
+    double rxy = mECLoc.Magnitude(eX, eY);
+    return rxy == 0.0 ? 1.0 : mECLoc(eX)/rxy;
+  }
 
   /** Get the GEOCENTRIC latitude in radians.
       @return the geocentric latitude in rad of the location represented with
       this class instance. The returned values are in the range between
       -pi/2 <= lon <= pi/2. Latitude is positive north and negative south. */
-  double GetLatitude() const { ComputeDerived(); return mLat; }
+  double GetLatitude() const {
+    return mGeodeticValid ? mLat : ComputeLatitude();
+  }
 
   /** Get the GEODETIC latitude in radians.
       @return the geodetic latitude in rad of the location represented with this
@@ -257,14 +269,14 @@ public:
       -pi/2 <= lon <= pi/2. Latitude is positive north and negative south. */
   double GetGeodLatitudeRad(void) const {
     assert(mEllipseSet);
-    ComputeDerived(); return mGeodLat;
+    ComputeGeodetic(); return mGeodLat;
   }
 
   /** Get the GEOCENTRIC latitude in degrees.
       @return the geocentric latitude in deg of the location represented with
       this class instance. The returned value is in the range between
       -90 <= lon <= 90. Latitude is positive north and negative south. */
-  double GetLatitudeDeg() const { ComputeDerived(); return radtodeg*mLat; }
+  double GetLatitudeDeg() const { return radtodeg*GetLatitude(); }
 
   /** Get the GEODETIC latitude in degrees.
       @return the geodetic latitude in degrees of the location represented by
@@ -272,13 +284,13 @@ public:
       -90 <= lon <= 90. Latitude is positive north and negative south. */
   double GetGeodLatitudeDeg(void) const {
     assert(mEllipseSet);
-    ComputeDerived(); return radtodeg*mGeodLat;
+    ComputeGeodetic(); return radtodeg*mGeodLat;
   }
 
   /** Gets the geodetic altitude in feet. */
   double GetGeodAltitude(void) const {
     assert(mEllipseSet);
-    ComputeDerived(); return GeodeticAltitude;
+    ComputeGeodetic(); return GeodeticAltitude;
   }
 
   /** Get the sea level radius in feet below the current location. */
@@ -288,7 +300,9 @@ public:
       @return the distance of the location represented with this class
       instance to the center of the earth in ft. The radius value is
       always positive. */
-  double GetRadius() const { ComputeDerived(); return mRadius; }
+  double GetRadius() const {
+    return mGeodeticValid ? mRadius : mECLoc.Magnitude();
+  }
 
   /** Transform matrix from local horizontal to earth centered frame.
       @return a const reference to the rotation matrix of the transform from
@@ -351,7 +365,9 @@ public:
       @return a reference to the vector entry at the given index.
       Indices are counted starting with 1.
       Note that the index given in the argument is unchecked. */
-  double& operator()(unsigned int idx) { mCacheValid = false; return mECLoc.Entry(idx); }
+  double& operator()(unsigned int idx) {
+    mCacheValid = mGeodeticValid = false; return mECLoc.Entry(idx);
+  }
 
   /** Read access the entries of the vector.
       @param idx the component index.
@@ -372,7 +388,7 @@ public:
       used internally to access the elements in a more convenient way.
       Note that the index given in the argument is unchecked. */
   double& Entry(unsigned int idx) {
-    mCacheValid = false; return mECLoc.Entry(idx);
+    mCacheValid = mGeodeticValid = false; return mECLoc.Entry(idx);
   }
 
   /** Sets this location via the supplied vector.
@@ -386,7 +402,7 @@ public:
     mECLoc(eX) = v(eX);
     mECLoc(eY) = v(eY);
     mECLoc(eZ) = v(eZ);
-    mCacheValid = false;
+    mCacheValid = mGeodeticValid = false;
     //ComputeDerived();
     return *this;
   }
@@ -411,7 +427,7 @@ public:
       the ECEF position vector on the left side of the equality, and a reference
       to this object is returned. */
   const FGLocation& operator+=(const FGLocation &l) {
-    mCacheValid = false;
+    mCacheValid = mGeodeticValid = false;
     mECLoc += l.mECLoc;
     return *this;
   }
@@ -421,7 +437,7 @@ public:
       substracted from the ECEF position vector on the left side of the
       equality, and a reference to this object is returned. */
   const FGLocation& operator-=(const FGLocation &l) {
-    mCacheValid = false;
+    mCacheValid = mGeodeticValid = false;
     mECLoc -= l.mECLoc;
     return *this;
   }
@@ -431,7 +447,7 @@ public:
       the equality are scaled by the supplied value (right side), and a
       reference to this object is returned. */
   const FGLocation& operator*=(double scalar) {
-    mCacheValid = false;
+    mCacheValid = mGeodeticValid = false;
     mECLoc *= scalar;
     return *this;
   }
@@ -492,6 +508,42 @@ private:
       ComputeDerivedUnconditional();
   }
 
+  /** Computation of the spherical and geodetic coordinates.
+      This function re-computes the lon/lat/radius values and the geodetic
+      latitude and altitude unconditionally. The sines and cosines of the
+      longitude and of the latitude used by the transformation matrices are
+      returned in the arguments. */
+  void ComputeGeodeticUnconditional(double& sinLon, double& cosLon,
+                                    double& sinLat, double& cosLat) const;
+
+  /** Computation of the spherical and geodetic coordinates.
+      Same as ComputeDerived() but the transformation matrices are not
+      computed. */
+  void ComputeGeodetic(void) const {
+    if (!mGeodeticValid) {
+      double sinLon, cosLon, sinLat, cosLat;
+      ComputeGeodeticUnconditional(sinLon, cosLon, sinLat, cosLat);
+    }
+  }
+
+  /** Computation of the longitude alone.
+      The result is the same than the value cached by
+      ComputeDerivedUnconditional() but the geodetic coordinates and the
+      transformation matrices are not computed. */
+  double ComputeLongitude(void) const {
+    if (mECLoc.Magnitude(eX, eY) == 0.0) return 0.0;
+    return atan2(mECLoc(eY), mECLoc(eX));
+  }
+
+  /** Computation of the geocentric latitude alone.
+      The result is the same than the value cached by
+      ComputeDerivedUnconditional() but the geodetic coordinates and the
+      transformation matrices are not computed. */
+  double ComputeLatitude(void) const {
+    if (mECLoc.Magnitude() == 0.0) return 0.0;
+    return atan2(mECLoc(eZ), mECLoc.Magnitude(eX, eY));
+  }
+
   /** The coordinates in the earth centered frame. This is the master copy.
       The coordinate frame has its center in the middle of the earth.
       Its x-axis points from the center of the earth towards a
@@ -528,6 +580,14 @@ private:
       The C++ keyword "mutable" tells the compiler that the data member is
       allowed to change during a const member function. */
   mutable bool mCacheValid;
+  /** Validity flag of the lon/lat/radius values and of the geodetic
+      coordinates alone.
+      Ground queries only need the geodetic coordinates so they are cached
+      separately from the transformation matrices. The radius, the longitude
+      and the geocentric latitude are cheap enough to be computed on the fly
+      when this flag is not set. mGeodeticValid is always set when
+      mCacheValid is set. */
+  mutable bool mGeodeticValid;
   // Flag that checks that geodetic methods are called after SetEllipse() has
   // been called.
   bool mEllipseSet = false;
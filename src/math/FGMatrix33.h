@@ -79,7 +79,7 @@ public:
 
       Create a zero matrix.
    */
-  FGMatrix33(void);
+  FGMatrix33(void) { InitMatrix(); }
 
   /** Copy constructor.
 
@@ -328,7 +328,56 @@ public:
       Compute and return the product of the current matrix with the
       vector given in the argument.
    */
-  FGColumnVector3 operator*(const FGColumnVector3& v) const;
+  FGColumnVector3 operator*(const FGColumnVector3& v) const {
+    double v1 = v(1);
+    double v2 = v(2);
+    double v3 = v(3);
+
+    // Accumulate the columns one after the other so that the rows are
+    // independent and can be computed in parallel by the compiler.
+    double tmp1 = v1*data[0];  //[(col-1)*eRows+row-1]
+    double tmp2 = v1*data[1];
+    double tmp3 = v1*data[2];
+
+    tmp1 += v2*data[3];
+    tmp2 += v2*data[4];
+    tmp3 += v2*data[5];
+
+    tmp1 += v3*data[6];
+    tmp2 += v3*data[7];
+    tmp3 += v3*data[8];
+
+    return FGColumnVector3( tmp1, tmp2, tmp3 );
+  }
+
+  /** Transposed matrix vector multiplication.
+
+      @param v vector to multiply with.
+      @return product of the transposed matrix with the vector.
+
+      Compute and return the product of the transpose of the current matrix
+      with the vector given in the argument. The result is the same than
+      <tt>Transposed()*v</tt> but the transposed matrix is not built.
+   */
+  FGColumnVector3 TransposedMultiply(const FGColumnVector3& v) const {
+    double v1 = v(1);
+    double v2 = v(2);
+    double v3 = v(3);
+
+    double tmp1 = v1*data[0];
+    double tmp2 = v1*data[3];
+    double tmp3 = v1*data[6];
+
+    tmp1 += v2*data[1];
+    tmp2 += v2*data[4];
+    tmp3 += v2*data[7];
+
+    tmp1 += v3*data[2];
+    tmp2 += v3*data[5];
+    tmp3 += v3*data[8];
+
+    return FGColumnVector3( tmp1, tmp2, tmp3 );
+  }
 
   /** Matrix subtraction.
 
@@ -358,7 +407,21 @@ public:
       Compute and return the product of the current matrix and the matrix
       B given in the argument.
   */
-  FGMatrix33 operator*(const FGMatrix33& B) const;
+  FGMatrix33 operator*(const FGMatrix33& B) const {
+    FGMatrix33 Product;
+
+    Product.data[0] = data[0]*B.data[0] + data[3]*B.data[1] + data[6]*B.data[2];
+    Product.data[1] = data[1]*B.data[0] + data[4]*B.data[1] + data[7]*B.data[2];
+    Product.data[2] = data[2]*B.data[0] + data[5]*B.data[1] + data[8]*B.data[2];
+    Product.data[3] = data[0]*B.data[3] + data[3]*B.data[4] + data[6]*B.data[5];
+    Product.data[4] = data[1]*B.data[3] + data[4]*B.data[4] + data[7]*B.data[5];
+    Product.data[5] = data[2]*B.data[3] + data[5]*B.data[4] + data[8]*B.data[5];
+    Product.data[6] = data[0]*B.data[6] + data[3]*B.data[7] + data[6]*B.data[8];
+    Product.data[7] = data[1]*B.data[6] + data[4]*B.data[7] + data[7]*B.data[8];
+    Product.data[8] = data[2]*B.data[6] + data[5]*B.data[7] + data[8]*B.data[8];
+
+    return Product;
+  }
 
   /** Multiply the matrix with a scalar.
 
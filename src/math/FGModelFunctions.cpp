@@ -80,6 +80,7 @@ void FGModelFunctions::PreLoad(Element* el, FGFDMExec* fdmex, string prefix)
       PreFunctions.push_back(std::make_shared<FGFunction>(fdmex, function, prefix));
     else if (fType == "template") {
       string name = function->GetAttributeValue("name");
+      FGLoadProfile::Scope profile(fdmex->GetLoadProfile(), "template ", name);
       fdmex->AddTemplateFunc(name, function);
     }
 
@@ -19,12 +19,10 @@
 #include "FGNelderMead.h"
 #include <limits>
 #include <cmath>
-#include <cstdlib>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
-#include <ctime>
 
 namespace JSBSim
 {
@@ -35,12 +33,14 @@ FGNelderMead::FGNelderMead(Function * f, const std::vector<double> & initialGues
                            const std::vector<double> & initialStepSize, int iterMax,
                            double rtol, double abstol, double speed, double randomization,
                            bool showConvergeStatus,
-                           bool showSimplex, bool pause, Callback * callback) :
+                           bool showSimplex, bool pause, Callback * callback,
+                           unsigned int seed) :
         m_f(f), m_callback(callback), m_randomization(randomization),
+        m_generator(seed),
         m_lowerBound(lowerBound), m_upperBound(upperBound),
         m_nDim(initialGuess.size()), m_nVert(m_nDim+1),
         m_iMax(1), m_iNextMax(1), m_iMin(1),
-        m_simplex(m_nVert), m_cost(m_nVert), m_elemSum(m_nDim),
+        m_simplex(m_nVert), m_cost(m_nVert), m_elemSum(m_nDim), m_tryVertex(m_nDim),
         m_status(1),
         initialGuess(initialGuess), initialStepSize(initialStepSize),
         iterMax(iterMax), iter(), rtol(rtol), abstol(abstol),
@@ -48,13 +48,10 @@ FGNelderMead::FGNelderMead(Function * f, const std::vector<double> & initialGues
         pause(pause), rtolI(), minCostPrevResize(1), minCost(), minCostPrev(), maxCost(),
         nextMaxCost()
 {
-    srand ( time(NULL) ); // seed random number generator
 }
 
 void FGNelderMead::update()
 {
-    std::cout.precision(3);
-
     // reinitialize simplex whenever rtol condition is met
     if ( rtolI < rtol || iter == 0)
     {
@@ -78,18 +75,16 @@ void FGNelderMead::update()
         constructSimplex(guess,initialStepSize);
     }
 
-    // find vertex costs
-    for (unsigned int vertex=0;vertex<m_nVert;vertex++)
+    // find vertex costs, the vertices are independent from each other so
+    // they are evaluated as a batch
+    try
     {
-        try
-        {
-            m_cost[vertex] = eval(m_simplex[vertex]);   
-        }
-        catch (...)
-        {
-            m_status = -1;
-            throw;
-        }
+        m_f->evalBatch(m_simplex, m_cost);
+    }
+    catch (...)
+    {
+        m_status = -1;
+        throw;
     }
 
     // find max cost, next max cost, and min cost
@@ -106,7 +101,7 @@ void FGNelderMead::update()
     }
 
     // callback
-    if (m_callback) m_callback->eval(m_simplex[m_iMin]);
+    if (m_callback) m_callback->eval(m_simplex[m_iMin], m_cost[m_iMin]);
 
     // compute relative tolerance
     rtolI = 2*std::abs(m_cost[m_iMax] -
@@ -144,6 +139,7 @@ void FGNelderMead::update()
     // output cost and simplex
     if (showConvergeStatus)
     {
+        std::cout.precision(3);
         if ( (minCostPrev + std::numeric_limits<float>::epsilon() )
                 < minCost && minCostPrev != 0)
         {
@@ -169,6 +165,7 @@ void FGNelderMead::update()
     }
     if (showSimplex)
     {
+        std::cout.precision(3);
         std::cout << "simplex: " << std::endl;;
         for (unsigned int j=0;j<m_nVert;j++)
             std::cout << "\t" << std::scientific
@@ -256,7 +253,8 @@ int FGNelderMead::status()
 
 double FGNelderMead::getRandomFactor()
 {
-    double randFact = 1+(float(rand() % 1000)/500-1)*m_randomization;
+    std::uniform_int_distribution<int> distribution(0, 999);
+    double randFact = 1+(float(distribution(m_generator))/500-1)*m_randomization;
     //std::cout << "random factor: " << randFact << std::endl;;
     return randFact;
 }
@@ -266,20 +264,23 @@ std::vector<double> FGNelderMead::getSolution()
     return m_simplex[m_iMin];
 }
 
+double FGNelderMead::getSolutionCost()
+{
+    return m_cost[m_iMin];
+}
+
 double FGNelderMead::tryStretch(double factor)
 {
     // randomize factor so we can avoid locking situations
     factor = factor*getRandomFactor();
 
-    // create trial vertex
+    // create trial vertex, the storage is reused from a trial to the next
     double a= (1.0-factor)/m_nDim;
     double b = a - factor;
-    std::vector<double> tryVertex(m_nDim);
+    std::vector<double> & tryVertex = m_tryVertex;
     for (unsigned int dim=0;dim<m_nDim;dim++)
-    {
         tryVertex[dim] = m_elemSum[dim]*a - m_simplex[m_iMax][dim]*b;
-        boundVertex(tryVertex,m_lowerBound,m_upperBound);
-    }
+    boundVertex(tryVertex,m_lowerBound,m_upperBound);
 
     // find trial cost
     double costTry = eval(tryVertex);
@@ -22,23 +22,38 @@
 #include <vector>
 #include <limits>
 #include <cstddef>
+#include <random>
+
+#include "JSBSim_API.h"
 
 namespace JSBSim
 {
 
-class FGNelderMead
+class JSBSIM_API FGNelderMead
 {
 public:
     class Function
     {
     public:
         virtual double eval(const std::vector<double> & v)  = 0;
+        // evaluates several vertices at once, the costs are returned in the
+        // order of the vertices. The vertices are evaluated one after another
+        // unless the function overrides this method, for instance to
+        // evaluate them in parallel.
+        virtual void evalBatch(const std::vector< std::vector<double> > & vertices,
+                               std::vector<double> & costs)
+        {
+            for (size_t i=0;i<vertices.size();i++) costs[i] = eval(vertices[i]);
+        }
         virtual ~Function() {};
     };
     class Callback
     {
     public:
         virtual void eval(const std::vector<double> & v)  = 0;
+        // called at each update with the best vertex and its cost, which
+        // avoids evaluating the vertex again.
+        virtual void eval(const std::vector<double> & v, double) { eval(v); }
         virtual ~Callback() {};
     };
 
@@ -52,8 +67,10 @@ public:
                  double randomization=0.1,
                  bool showConvergeStatus=true,bool showSimplex=false,
                  bool pause=false,
-                 Callback * callback=NULL);
+                 Callback * callback=NULL,
+                 unsigned int seed=0);
     std::vector<double> getSolution();
+    double getSolutionCost();
 
     void update();
     int status();
@@ -63,6 +80,9 @@ private:
     Function * m_f;
     Callback * m_callback;
     double m_randomization;
+    // each instance has its own random generator so that the instances run
+    // by different threads neither share it nor depend on each other.
+    std::mt19937 m_generator;
     const std::vector<double> & m_lowerBound;
     const std::vector<double> & m_upperBound;
     size_t m_nDim, m_nVert;
@@ -70,6 +90,7 @@ private:
     std::vector< std::vector<double> > m_simplex;
     std::vector<double> m_cost;
     std::vector<double> m_elemSum;
+    std::vector<double> m_tryVertex;
     int m_status;
     const std::vector<double> & initialGuess;
     const std::vector<double> & initialStepSize;
@@ -34,17 +34,25 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <algorithm>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "JSBSim_API.h"
+#include "FGJSBBase.h"
 #include "simgear/structure/SGSharedPtr.hxx"
 
+class SGPropertyNode;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 namespace JSBSim {
 
+class FGDerivativeSeeds;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -65,12 +73,77 @@ public:
   virtual std::string GetName(void) const = 0;
   virtual bool IsConstant(void) const { return false; }
 
+  /** Computes the derivative of the value with respect to a variable (forward
+      mode differentiation).
+      @param seeds the derivatives of the properties with respect to the
+                   variable.
+      @return the derivative of the value.
+      @throws BaseException if the parameter cannot be differentiated. */
+  virtual double GetDerivative(const FGDerivativeSeeds&) const {
+    throw BaseException("The parameter " + GetName()
+                        + " cannot be differentiated.");
+  }
+
   // SGPropertyNode impersonation.
   double getDoubleValue(void) const { return GetValue(); }
 };
 
 typedef SGSharedPtr<FGParameter> FGParameter_ptr;
 
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DECLARATION: FGDerivativeSeeds
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** The derivatives of some properties with respect to a variable from which
+    FGParameter::GetDerivative() starts the differentiation.
+    A property is either seeded with its derivative, or computed by a
+    registered function which is then differentiated, or held constant. Note
+    that the properties computed by the C++ code are not related to each
+    other: aero/alpha-rad and aero/alpha-deg must both be seeded to
+    differentiate with respect to the angle of attack. */
+
+class JSBSIM_API FGDerivativeSeeds
+{
+public:
+  /// Sets the derivative of a property with respect to the variable.
+  void SetSeed(const SGPropertyNode* node, double derivative) {
+    seeds[node] = derivative;
+  }
+
+  /// Registers the function that computes the value of a property.
+  void AddFunction(const SGPropertyNode* node, const FGParameter* function) {
+    if (node) functions[node] = function;
+  }
+
+  /** Records the properties that are held constant, in the order in which
+      the differentiation reads them. These are the inputs of the functions.
+      @param list the list to which the properties are appended or nullptr to
+                  stop the recording. */
+  void RecordInputs(std::vector<const SGPropertyNode*>* list) {
+    inputs = list;
+  }
+
+  /// Returns the derivative of a property with respect to the variable.
+  double GetDerivative(const SGPropertyNode* node) const {
+    auto seed = seeds.find(node);
+    if (seed != seeds.end()) return seed->second;
+
+    auto function = functions.find(node);
+    if (function != functions.end())
+      return function->second->GetDerivative(*this);
+
+    if (inputs && std::find(inputs->begin(), inputs->end(), node) == inputs->end())
+      inputs->push_back(node);
+
+    return 0.0;
+  }
+
+private:
+  std::unordered_map<const SGPropertyNode*, double> seeds;
+  std::unordered_map<const SGPropertyNode*, const FGParameter*> functions;
+  std::vector<const SGPropertyNode*>* inputs = nullptr;
+};
+
 inline double operator*(double v, const FGParameter_ptr& p) {
   return v*p->GetValue();
 }
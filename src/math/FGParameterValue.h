@@ -87,6 +87,9 @@ public:
   }
 
   double GetValue(void) const override { return param->GetValue(); }
+  double GetDerivative(const FGDerivativeSeeds& seeds) const override {
+    return param->GetDerivative(seeds);
+  }
   bool IsConstant(void) const override { return param->IsConstant(); }
 
   std::string GetName(void) const override {
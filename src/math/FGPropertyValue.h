@@ -69,6 +69,9 @@ public:
                   std::shared_ptr<FGPropertyManager> propertyManager, Element* el);
 
   double GetValue(void) const override;
+  double GetDerivative(const FGDerivativeSeeds& seeds) const override {
+    return seeds.GetDerivative(GetNode())*Sign;
+  }
   bool IsConstant(void) const override {
     return PropertyNode && (!PropertyNode->isTied()
                          && !PropertyNode->getAttribute(SGPropertyNode::WRITE));
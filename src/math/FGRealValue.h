@@ -61,6 +61,7 @@ public:
   explicit FGRealValue(double val) : Value(val) {}
 
   double GetValue(void) const override { return Value; };
+  double GetDerivative(const FGDerivativeSeeds&) const override { return 0.0; }
   std::string GetName(void) const override;
   bool IsConstant(void) const override { return true; }
 
@@ -17,100 +17,311 @@
  */
 
 #include "initialization/FGInitialCondition.h"
+#include "models/FGAerodynamics.h"
 #include "FGStateSpace.h"
+#include <atomic>
 #include <limits>
 #include <iomanip>
+#include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 
 namespace JSBSim
 {
 
+struct FGStateSpace::Worker
+{
+    std::unique_ptr<FGFDMExec> fdm;
+    std::unique_ptr<FGStateSpace> ss;
+    std::vector< std::unique_ptr<Component> > components;
+};
+
+FGStateSpace::FGStateSpace(FGFDMExec * fdm) : x(fdm,this), u(fdm,this), y(fdm,this),
+        m_fdm(fdm), m_difference(eFivePoint), m_step(1e-4),
+        m_relativeStep(false), m_threads(1), m_aeroPartials(false)
+{
+}
+
+FGStateSpace::~FGStateSpace()
+{
+}
+
+// replaces the aerodynamics of an FDM by their first order expansion about
+// its current state while the jacobians are computed so that the finite
+// differences get the analytic partials of the aerodynamics
+namespace {
+class AeroLinearization
+{
+public:
+    AeroLinearization(FGFDMExec * fdm, bool enable) :
+            m_aero(fdm->GetAerodynamics())
+    {
+        if (enable) m_aero->Linearize();
+    }
+    ~AeroLinearization()
+    {
+        m_aero->ClearLinearization();
+    }
+private:
+    std::shared_ptr<FGAerodynamics> m_aero;
+};
+}
+
 void FGStateSpace::linearize(
     std::vector<double> x0,
     std::vector<double> u0,
-    std::vector<double> y0,
+    std::vector<double> /* y0 */,
     std::vector< std::vector<double> > & A,
     std::vector< std::vector<double> > & B,
     std::vector< std::vector<double> > & C,
     std::vector< std::vector<double> > & D)
 {
-    double h = 1e-4;
+    if (parallelLinearize(x0,u0,A,B,C,D)) return;
+
+    if (m_aeroPartials) x.set(x0);
+    AeroLinearization aero(m_fdm, m_aeroPartials);
 
     // A, d(x)/dx
-    numericalJacobian(A,x,x,x0,x0,h,true);
+    numericalJacobian(A,x,x,x0,true);
     // B, d(x)/du
-    numericalJacobian(B,x,u,x0,u0,h,true);
+    numericalJacobian(B,x,u,u0,true);
     // C, d(y)/dx
-    numericalJacobian(C,y,x,y0,x0,h);
+    numericalJacobian(C,y,x,x0);
     // D, d(y)/du
-    numericalJacobian(D,y,u,y0,u0,h);
+    numericalJacobian(D,y,u,u0);
 
 }
 
 void FGStateSpace::numericalJacobian(std::vector< std::vector<double> >  & J, ComponentVector & y,
-                                     ComponentVector & x, const std::vector<double> & y0, const std::vector<double> & x0, double h, bool computeYDerivative)
+                                     ComponentVector & x, const std::vector<double> & x0, bool computeYDerivative)
 {
     size_t nX = x.getSize();
     size_t nY = y.getSize();
-    double f1 = 0, f2 = 0, fn1 = 0, fn2 = 0;
     J.resize(nY);
     for (unsigned int iY=0;iY<nY;iY++)
     {
         J[iY].resize(nX);
         for (unsigned int iX=0;iX<nX;iX++)
-        {
-            x.set(x0);
-            x.set(iX,x.get(iX)+h);
-            if (computeYDerivative) f1 = y.getDeriv(iY);
-            else f1 = y.get(iY);
-
-            x.set(x0);
-            x.set(iX,x.get(iX)+2*h);
-            if (computeYDerivative) f2 = y.getDeriv(iY);
-            else f2 = y.get(iY);
-
-            x.set(x0);
-            x.set(iX,x.get(iX)-h);
-            if (computeYDerivative) fn1 = y.getDeriv(iY);
-            else fn1 = y.get(iY);
-
-            x.set(x0);
-            x.set(iX,x.get(iX)-2*h);
-            if (computeYDerivative) fn2 = y.getDeriv(iY);
-            else fn2 = y.get(iY);
-
-			double diff1 = f1-fn1;
-			double diff2 = f2-fn2;
-
-			// correct for angle wrap
-			if (x.getComp(iX)->getUnit().compare("rad") == 0) {
-				while(diff1 > M_PI) diff1 -= 2*M_PI;
-				if(diff1 < -M_PI) diff1 += 2*M_PI;
-				if(diff2 > M_PI) diff2 -= 2*M_PI;
-				if(diff2 < -M_PI) diff2 += 2*M_PI;
-			} else if (x.getComp(iX)->getUnit().compare("deg") == 0) {
-				if(diff1 > 180) diff1 -= 360;
-				if(diff1 < -180) diff1 += 360;
-				if(diff2 > 180) diff2 -= 360;
-				if(diff2 < -180) diff2 += 360;
-			}
-            J[iY][iX] = (8*diff1-diff2)/(12*h); // 3rd order taylor approx from lewis, pg 203
-
-            x.set(x0);
-
-            if (m_fdm->GetDebugLevel() > 1)
+            J[iY][iX] = jacobianElement(y,x,x0,iY,iX,computeYDerivative);
+    }
+}
+
+// correct a difference of angles for the wrap
+static double angleWrap(double diff, const std::string & unit)
+{
+    if (unit == "rad") {
+        while(diff > M_PI) diff -= 2*M_PI;
+        if(diff < -M_PI) diff += 2*M_PI;
+    } else if (unit == "deg") {
+        if(diff > 180) diff -= 360;
+        if(diff < -180) diff += 360;
+    }
+    return diff;
+}
+
+double FGStateSpace::jacobianElement(ComponentVector & y, ComponentVector & x,
+                                     const std::vector<double> & x0, unsigned int iY,
+                                     unsigned int iX, bool computeYDerivative)
+{
+    double f1 = 0, f2 = 0, fn1 = 0, fn2 = 0, dfdx = 0;
+    const Component * comp = x.getComp(iX);
+    double h = comp->getStep() > 0 ? comp->getStep() : m_step;
+    if (m_relativeStep) h *= std::max(1.0, fabs(x0[iX]));
+
+    x.set(x0);
+    x.set(iX,x.get(iX)+h);
+    if (computeYDerivative) f1 = y.getDeriv(iY);
+    else f1 = y.get(iY);
+
+    if (m_difference == eFivePoint)
+    {
+        x.set(x0);
+        x.set(iX,x.get(iX)+2*h);
+        if (computeYDerivative) f2 = y.getDeriv(iY);
+        else f2 = y.get(iY);
+    }
+
+    x.set(x0);
+    x.set(iX,x.get(iX)-h);
+    if (computeYDerivative) fn1 = y.getDeriv(iY);
+    else fn1 = y.get(iY);
+
+    if (m_difference == eFivePoint)
+    {
+        x.set(x0);
+        x.set(iX,x.get(iX)-2*h);
+        if (computeYDerivative) fn2 = y.getDeriv(iY);
+        else fn2 = y.get(iY);
+    }
+
+    double diff1 = angleWrap(f1-fn1, comp->getUnit());
+    double diff2 = angleWrap(f2-fn2, comp->getUnit());
+
+    if (m_difference == eFivePoint)
+        dfdx = (8*diff1-diff2)/(12*h); // 3rd order taylor approx from lewis, pg 203
+    else
+        dfdx = diff1/(2*h);
+
+    x.set(x0);
+
+    if (m_fdm->GetDebugLevel() > 1)
+    {
+        std::cout << std::scientific << "\ty:\t" << y.getName(iY) << "\tx:\t"
+                  << x.getName(iX)
+                  << "\tfn2:\t" << fn2 << "\tfn1:\t" << fn1
+                  << "\tf1:\t" << f1 << "\tf2:\t" << f2
+                  << "\tf1-fn1:\t" << f1-fn1
+                  << "\tf2-fn2:\t" << f2-fn2
+                  << "\tdf/dx:\t" << dfdx
+                  << std::fixed << std::endl;
+    }
+
+    return dfdx;
+}
+
+bool FGStateSpace::prepareWorkers(unsigned int count)
+{
+    while (m_workers.size() < count)
+    {
+        auto worker = std::make_unique<Worker>();
+        worker->fdm = m_fdm->Clone();
+        if (!worker->fdm) return false;
+        worker->ss = std::make_unique<FGStateSpace>(worker->fdm.get());
+
+        // The components shared by several vectors (such as y = x) are
+        // copied once.
+        std::map<const Component *, Component *> copies;
+        auto copy = [&](const ComponentVector & from, ComponentVector & to) {
+            for (unsigned int i=0;i<from.getSize();i++)
+            {
+                const Component * comp = from.getComp(i);
+                Component * & c = copies[comp];
+                if (!c)
+                {
+                    c = comp->clone();
+                    if (!c) return false;
+                    worker->components.emplace_back(c);
+                }
+                to.add(c);
+            }
+            return true;
+        };
+        if (!copy(x, worker->ss->x) || !copy(u, worker->ss->u)
+            || !copy(y, worker->ss->y))
+            return false;
+
+        m_workers.push_back(std::move(worker));
+    }
+
+    for (auto & worker : m_workers)
+    {
+        worker->ss->m_difference = m_difference;
+        worker->ss->m_step = m_step;
+        worker->ss->m_relativeStep = m_relativeStep;
+    }
+
+    return true;
+}
+
+bool FGStateSpace::parallelLinearize(const std::vector<double> & x0, const std::vector<double> & u0,
+                                     std::vector< std::vector<double> > & A,
+                                     std::vector< std::vector<double> > & B,
+                                     std::vector< std::vector<double> > & C,
+                                     std::vector< std::vector<double> > & D)
+{
+    unsigned int nThreads = m_threads;
+    if (nThreads == 0) nThreads = std::max(1U, std::thread::hardware_concurrency());
+    if (nThreads < 2) return false;
+
+    // The elements of the four jacobians are computed independently from
+    // each other by clones of the FDM. Each clone is set in the state of the
+    // FDM before computing an element so that the results do not depend on
+    // the order in which the elements are computed nor on the number of
+    // threads. The FDM itself is left unchanged.
+    struct Task
+    {
+        std::vector< std::vector<double> > * J;
+        ComponentVector FGStateSpace::* y;
+        ComponentVector FGStateSpace::* x;
+        const std::vector<double> * x0;
+        bool computeYDerivative;
+        unsigned int iY, iX;
+    };
+    std::vector<Task> tasks;
+    auto addTasks = [&](std::vector< std::vector<double> > & J,
+                        ComponentVector FGStateSpace::* y,
+                        ComponentVector FGStateSpace::* x,
+                        const std::vector<double> & x0, bool deriv) {
+        size_t nX = (this->*x).getSize();
+        size_t nY = (this->*y).getSize();
+        J.assign(nY, std::vector<double>(nX));
+        for (unsigned int iY=0;iY<nY;iY++)
+            for (unsigned int iX=0;iX<nX;iX++)
+                tasks.push_back({&J, y, x, &x0, deriv, iY, iX});
+    };
+    addTasks(A, &FGStateSpace::x, &FGStateSpace::x, x0, true);
+    addTasks(B, &FGStateSpace::x, &FGStateSpace::u, u0, true);
+    addTasks(C, &FGStateSpace::y, &FGStateSpace::x, x0, false);
+    addTasks(D, &FGStateSpace::y, &FGStateSpace::u, u0, false);
+
+    nThreads = std::min(nThreads, static_cast<unsigned int>(tasks.size()));
+    if (nThreads < 2 || !prepareWorkers(nThreads)) return false;
+
+    std::atomic<size_t> next{0};
+    std::exception_ptr error;
+    std::mutex errorMutex, fdmMutex;
+
+    auto work = [&](FGStateSpace * ss) {
+        try {
+            // The aerodynamics are expanded about the operating point.
+            if (m_aeroPartials)
             {
-                std::cout << std::scientific << "\ty:\t" << y.getName(iY) << "\tx:\t"
-                          << x.getName(iX)
-                          << "\tfn2:\t" << fn2 << "\tfn1:\t" << fn1
-                          << "\tf1:\t" << f1 << "\tf2:\t" << f2
-                          << "\tf1-fn1:\t" << f1-fn1
-                          << "\tf2-fn2:\t" << f2-fn2
-                          << "\tdf/dx:\t" << J[iY][iX]
-                          << std::fixed << std::endl;
+                {
+                    std::lock_guard<std::mutex> lock(fdmMutex);
+                    ss->m_fdm->CopyState(*m_fdm);
+                }
+                ss->x.set(x0);
             }
+            AeroLinearization aero(ss->m_fdm, m_aeroPartials);
+            for (size_t i = next++; i < tasks.size(); i = next++)
+            {
+                const Task & t = tasks[i];
+                {
+                    // Some getters of the FDM update a cache: the clones
+                    // read its state one at a time.
+                    std::lock_guard<std::mutex> lock(fdmMutex);
+                    ss->m_fdm->CopyState(*m_fdm);
+                }
+                // The engines are not copied in steady state: they are
+                // settled by a first evaluation at the operating point.
+                ss->x.set(x0);
+                (*t.J)[t.iY][t.iX] = ss->jacobianElement(ss->*(t.y), ss->*(t.x),
+                                                         *t.x0, t.iY, t.iX,
+                                                         t.computeYDerivative);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) error = std::current_exception();
+            next = tasks.size();
         }
+    };
+
+    std::vector<std::thread> pool;
+    try {
+        for (unsigned int i=1; i<nThreads; i++)
+            pool.emplace_back(work, m_workers[i]->ss.get());
+    } catch (const std::system_error&) {
+        // Threads are not available on this platform (WebAssembly for
+        // instance): the remaining elements are computed by the calling
+        // thread.
     }
+    work(m_workers[0]->ss.get());
+    for (auto & t : pool)
+        t.join();
+
+    if (error) std::rethrow_exception(error);
+    return true;
 }
 
 std::ostream &operator<<( std::ostream &out, const FGStateSpace::Component &c )
@@ -31,6 +31,7 @@
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <memory>
 
 namespace JSBSim
 {
@@ -46,10 +47,17 @@ public:
         FGStateSpace * m_stateSpace;
         FGFDMExec * m_fdm;
         std::string m_name, m_unit;
+        double m_step;
     public:
         Component(const std::string & name, const std::string & unit) :
-                m_stateSpace(), m_fdm(), m_name(name), m_unit(unit) {};
+                m_stateSpace(), m_fdm(), m_name(name), m_unit(unit), m_step() {};
         virtual ~Component() {};
+        // copy of the component for another state space, null if the
+        // component cannot be copied
+        virtual Component * clone() const
+        {
+            return nullptr;
+        }
         virtual double get() const = 0;
         virtual void set(double val) = 0;
         virtual double getDeriv() const
@@ -96,6 +104,30 @@ public:
         {
             return m_unit;
         }
+        // step of the finite differences, zero to use the step of the state
+        // space
+        void setStep(double step)
+        {
+            m_step = step;
+        }
+        double getStep() const
+        {
+            return m_step;
+        }
+    };
+
+    // base class of the components that can be copied to the clones of the
+    // FDM that compute the jacobians in parallel
+    template <class T>
+    class ClonableComponent : public Component
+    {
+    public:
+        ClonableComponent(const std::string & name, const std::string & unit) :
+                Component(name, unit) {};
+        Component * clone() const override
+        {
+            return new T(static_cast<const T &>(*this));
+        }
     };
 
     // component vector class
@@ -214,8 +246,11 @@ public:
     // component vectors
     ComponentVector x, u, y;
 
+    // finite difference schemes
+    enum eDifference {eFivePoint, eCentral};
+
     // constructor
-    FGStateSpace(FGFDMExec * fdm) : x(fdm,this), u(fdm,this), y(fdm,this), m_fdm(fdm) {};
+    FGStateSpace(FGFDMExec * fdm);
 
     void setFdm(FGFDMExec * fdm) { m_fdm = fdm; }
 
@@ -272,9 +307,33 @@ public:
     }
 
     // deconstructor
-    virtual ~FGStateSpace() {};
+    virtual ~FGStateSpace();
+
+    // finite difference scheme: the five point stencil (default, fourth
+    // order) or the central difference (second order, half the runs)
+    void setDifference(eDifference difference) { m_difference = difference; }
+
+    // step of the finite differences for the components which do not have
+    // their own step. A relative step is scaled by the magnitude of the
+    // component when it is larger than 1.
+    void setStep(double step, bool relative = false)
+    {
+        m_step = step;
+        m_relativeStep = relative;
+    }
+
+    // number of threads that compute the jacobians, 0 to use all the cores.
+    // Each additional thread runs a clone of the FDM.
+    void setThreads(unsigned int threads) { m_threads = threads; }
 
-    // linearization function
+    // use the analytic partials of the aerodynamics rather than their finite
+    // differences (disabled by default). The aerodynamics fall back to the
+    // finite differences when one of their functions cannot be
+    // differentiated. The model is still run as many times.
+    void setAeroPartials(bool enable) { m_aeroPartials = enable; }
+
+    // linearization function, the outputs y0 are not used since the
+    // jacobians are only evaluated around x0 and u0.
     void linearize(std::vector<double> x0, std::vector<double> u0, std::vector<double> y0,
                    std::vector< std::vector<double> > & A,
                    std::vector< std::vector<double> > & B,
@@ -284,22 +343,47 @@ public:
 
 private:
 
+    // clone of the FDM with a copy of the state space
+    struct Worker;
+
     // compute numerical jacobian of a matrix
     void numericalJacobian(std::vector< std::vector<double> > & J, ComponentVector & y,
-                           ComponentVector & x, const std::vector<double> & y0,
-                           const std::vector<double> & x0, double h=1e-5, bool computeYDerivative = false);
+                           ComponentVector & x, const std::vector<double> & x0,
+                           bool computeYDerivative = false);
+
+    // compute an element of a jacobian
+    double jacobianElement(ComponentVector & y, ComponentVector & x,
+                           const std::vector<double> & x0, unsigned int iY,
+                           unsigned int iX, bool computeYDerivative);
+
+    // compute the four jacobians with several threads
+    bool parallelLinearize(const std::vector<double> & x0, const std::vector<double> & u0,
+                           std::vector< std::vector<double> > & A,
+                           std::vector< std::vector<double> > & B,
+                           std::vector< std::vector<double> > & C,
+                           std::vector< std::vector<double> > & D);
+
+    // set up the clones of the FDM in the state of the FDM
+    bool prepareWorkers(unsigned int count);
 
     // flight dynamcis model
     FGFDMExec * m_fdm;
 
+    eDifference m_difference;
+    double m_step;
+    bool m_relativeStep;
+    unsigned int m_threads;
+    bool m_aeroPartials;
+    std::vector< std::unique_ptr<Worker> > m_workers;
+
 public:
 
     // components
 
-    class Vt : public Component
+    class Vt : public ClonableComponent<Vt>
     {
     public:
-        Vt() : Component("Vt","ft/s") {};
+        Vt() : ClonableComponent("Vt","ft/s") {};
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetVt();
@@ -319,10 +403,10 @@ public:
 
     };
 
-    class VGround : public Component
+    class VGround : public ClonableComponent<VGround>
     {
     public:
-        VGround() : Component("VGround","ft/s") {};
+        VGround() : ClonableComponent("VGround","ft/s") {};
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetVground();
@@ -333,10 +417,10 @@ public:
         }
     };
 
-    class AccelX : public Component
+    class AccelX : public ClonableComponent<AccelX>
     {
     public:
-        AccelX() : Component("AccelX","ft/s^2") {};
+        AccelX() : ClonableComponent("AccelX","ft/s^2") {};
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetPilotAccel(1);
@@ -347,10 +431,10 @@ public:
         }
     };
 
-    class AccelY : public Component
+    class AccelY : public ClonableComponent<AccelY>
     {
     public:
-        AccelY() : Component("AccelY","ft/s^2") {};
+        AccelY() : ClonableComponent("AccelY","ft/s^2") {};
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetPilotAccel(2);
@@ -361,10 +445,10 @@ public:
         }
     };
 
-    class AccelZ : public Component
+    class AccelZ : public ClonableComponent<AccelZ>
     {
     public:
-        AccelZ() : Component("AccelZ","ft/s^2") {};
+        AccelZ() : ClonableComponent("AccelZ","ft/s^2") {};
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetPilotAccel(3);
@@ -375,10 +459,10 @@ public:
         }
     };
 
-    class Alpha : public Component
+    class Alpha : public ClonableComponent<Alpha>
     {
     public:
-        Alpha() : Component("Alpha","rad") {};
+        Alpha() : ClonableComponent("Alpha","rad") {};
         double get() const
         {
             return m_fdm->GetAuxiliary()->Getalpha();
@@ -399,10 +483,10 @@ public:
         }
     };
 
-    class Theta : public Component
+    class Theta : public ClonableComponent<Theta>
     {
     public:
-        Theta() : Component("Theta","rad") {};
+        Theta() : ClonableComponent("Theta","rad") {};
         double get() const
         {
             return m_fdm->GetPropagate()->GetEuler(2);
@@ -418,10 +502,10 @@ public:
         }
     };
 
-    class Q : public Component
+    class Q : public ClonableComponent<Q>
     {
     public:
-        Q() : Component("Q","rad/s") {};
+        Q() : ClonableComponent("Q","rad/s") {};
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQR(2);
@@ -436,10 +520,10 @@ public:
         }
     };
 
-    class Alt : public Component
+    class Alt : public ClonableComponent<Alt>
     {
     public:
-        Alt() : Component("Alt","ft") {};
+        Alt() : ClonableComponent("Alt","ft") {};
         double get() const
         {
             return m_fdm->GetPropagate()->GetAltitudeASL();
@@ -454,10 +538,10 @@ public:
         }
     };
 
-    class Beta : public Component
+    class Beta : public ClonableComponent<Beta>
     {
     public:
-        Beta() : Component("Beta","rad") {};
+        Beta() : ClonableComponent("Beta","rad") {};
         double get() const
         {
             return m_fdm->GetAuxiliary()->Getbeta();
@@ -474,10 +558,10 @@ public:
         }
     };
 
-    class Phi : public Component
+    class Phi : public ClonableComponent<Phi>
     {
     public:
-        Phi() : Component("Phi","rad") {};
+        Phi() : ClonableComponent("Phi","rad") {};
         double get() const
         {
             return m_fdm->GetPropagate()->GetEuler(1);
@@ -492,10 +576,10 @@ public:
         }
     };
 
-    class P : public Component
+    class P : public ClonableComponent<P>
     {
     public:
-        P() : Component("P","rad/s") {};
+        P() : ClonableComponent("P","rad/s") {};
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQR(1);
@@ -510,10 +594,10 @@ public:
         }
     };
 
-    class R : public Component
+    class R : public ClonableComponent<R>
     {
     public:
-        R() : Component("R","rad/s") {};
+        R() : ClonableComponent("R","rad/s") {};
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQR(3);
@@ -528,10 +612,10 @@ public:
         }
     };
 
-    class Psi : public Component
+    class Psi : public ClonableComponent<Psi>
     {
     public:
-        Psi() : Component("Psi","rad") {};
+        Psi() : ClonableComponent("Psi","rad") {};
         double get() const
         {
             return m_fdm->GetPropagate()->GetEuler(3);
@@ -546,10 +630,10 @@ public:
         }
     };
 
-    class ThrottleCmd : public Component
+    class ThrottleCmd : public ClonableComponent<ThrottleCmd>
     {
     public:
-        ThrottleCmd() : Component("ThtlCmd","norm") {};
+        ThrottleCmd() : ClonableComponent("ThtlCmd","norm") {};
         double get() const
         {
             return m_fdm->GetFCS()->GetThrottleCmd(0);
@@ -562,10 +646,10 @@ public:
         }
     };
 
-    class ThrottlePos : public Component
+    class ThrottlePos : public ClonableComponent<ThrottlePos>
     {
     public:
-        ThrottlePos() : Component("ThtlPos","norm") {};
+        ThrottlePos() : ClonableComponent("ThtlPos","norm") {};
         double get() const
         {
             return m_fdm->GetFCS()->GetThrottlePos(0);
@@ -577,10 +661,10 @@ public:
         }
     };
 
-    class DaCmd : public Component
+    class DaCmd : public ClonableComponent<DaCmd>
     {
     public:
-        DaCmd() : Component("DaCmd","norm") {};
+        DaCmd() : ClonableComponent("DaCmd","norm") {};
         double get() const
         {
             return m_fdm->GetFCS()->GetDaCmd();
@@ -592,10 +676,10 @@ public:
         }
     };
 
-    class DaPos : public Component
+    class DaPos : public ClonableComponent<DaPos>
     {
     public:
-        DaPos() : Component("DaPos","norm") {};
+        DaPos() : ClonableComponent("DaPos","norm") {};
         double get() const
         {
             return m_fdm->GetFCS()->GetDaLPos();
@@ -607,10 +691,10 @@ public:
         }
     };
 
-    class DeCmd : public Component
+    class DeCmd : public ClonableComponent<DeCmd>
     {
     public:
-        DeCmd() : Component("DeCmd","norm") {};
+        DeCmd() : ClonableComponent("DeCmd","norm") {};
         double get() const
         {
             return m_fdm->GetFCS()->GetDeCmd();
@@ -622,10 +706,10 @@ public:
         }
     };
 
-    class DePos : public Component
+    class DePos : public ClonableComponent<DePos>
     {
     public:
-        DePos() : Component("DePos","norm") {};
+        DePos() : ClonableComponent("DePos","norm") {};
         double get() const
         {
             return m_fdm->GetFCS()->GetDePos();
@@ -636,10 +720,10 @@ public:
         }
     };
 
-    class DrCmd : public Component
+    class DrCmd : public ClonableComponent<DrCmd>
     {
     public:
-        DrCmd() : Component("DrCmd","norm") {};
+        DrCmd() : ClonableComponent("DrCmd","norm") {};
         double get() const
         {
             return m_fdm->GetFCS()->GetDrCmd();
@@ -651,10 +735,10 @@ public:
         }
     };
 
-    class DrPos : public Component
+    class DrPos : public ClonableComponent<DrPos>
     {
     public:
-        DrPos() : Component("DrPos","norm") {};
+        DrPos() : ClonableComponent("DrPos","norm") {};
         double get() const
         {
             return m_fdm->GetFCS()->GetDrPos();
@@ -665,10 +749,10 @@ public:
         }
     };
 
-    class Rpm0 : public Component
+    class Rpm0 : public ClonableComponent<Rpm0>
     {
     public:
-        Rpm0() : Component("Rpm0","rev/min") {};
+        Rpm0() : ClonableComponent("Rpm0","rev/min") {};
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(0)->GetThruster()->GetRPM();
@@ -679,10 +763,10 @@ public:
         }
     };
 
-    class Rpm1 : public Component
+    class Rpm1 : public ClonableComponent<Rpm1>
     {
     public:
-        Rpm1() : Component("Rpm1","rev/min") {};
+        Rpm1() : ClonableComponent("Rpm1","rev/min") {};
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(1)->GetThruster()->GetRPM();
@@ -693,10 +777,10 @@ public:
         }
     };
 
-    class Rpm2 : public Component
+    class Rpm2 : public ClonableComponent<Rpm2>
     {
     public:
-        Rpm2() : Component("Rpm2","rev/min") {};
+        Rpm2() : ClonableComponent("Rpm2","rev/min") {};
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(2)->GetThruster()->GetRPM();
@@ -707,10 +791,10 @@ public:
         }
     };
 
-    class Rpm3 : public Component
+    class Rpm3 : public ClonableComponent<Rpm3>
     {
     public:
-        Rpm3() : Component("Rpm3","rev/min") {};
+        Rpm3() : ClonableComponent("Rpm3","rev/min") {};
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(3)->GetThruster()->GetRPM();
@@ -721,10 +805,10 @@ public:
         }
     };
 
-    class PropPitch : public Component
+    class PropPitch : public ClonableComponent<PropPitch>
     {
     public:
-        PropPitch() : Component("Prop Pitch","deg") {};
+        PropPitch() : ClonableComponent("Prop Pitch","deg") {};
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(0)->GetThruster()->GetPitch();
@@ -736,10 +820,10 @@ public:
         }
     };
 
-    class Longitude : public Component
+    class Longitude : public ClonableComponent<Longitude>
     {
     public:
-        Longitude() : Component("Longitude","rad") {};
+        Longitude() : ClonableComponent("Longitude","rad") {};
         double get() const
         {
             return m_fdm->GetPropagate()->GetLongitude();
@@ -754,10 +838,10 @@ public:
         }
     };
 
-    class Latitude : public Component
+    class Latitude : public ClonableComponent<Latitude>
     {
     public:
-        Latitude() : Component("Latitude","rad") {};
+        Latitude() : ClonableComponent("Latitude","rad") {};
         double get() const
         {
             return m_fdm->GetPropagate()->GetLatitude();
@@ -772,10 +856,10 @@ public:
         }
     };
 
-    class Pi : public Component
+    class Pi : public ClonableComponent<Pi>
     {
     public:
-        Pi() : Component("P inertial","rad/s") {};
+        Pi() : ClonableComponent("P inertial","rad/s") {};
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQRi(1);
@@ -793,10 +877,10 @@ public:
         }
     };
 
-    class Qi : public Component
+    class Qi : public ClonableComponent<Qi>
     {
     public:
-        Qi() : Component("Q inertial","rad/s") {};
+        Qi() : ClonableComponent("Q inertial","rad/s") {};
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQRi(2);
@@ -814,10 +898,10 @@ public:
         }
     };
 
-    class Ri : public Component
+    class Ri : public ClonableComponent<Ri>
     {
     public:
-        Ri() : Component("R inertial","rad/s") {};
+        Ri() : ClonableComponent("R inertial","rad/s") {};
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQRi(3);
@@ -835,10 +919,10 @@ public:
         }
     };
 
-    class Vn : public Component
+    class Vn : public ClonableComponent<Vn>
     {
     public:
-        Vn() : Component("Vel north","feet/s") {};
+        Vn() : ClonableComponent("Vel north","feet/s") {};
         double get() const
         {
             return m_fdm->GetPropagate()->GetVel(1);
@@ -854,10 +938,10 @@ public:
         }
     };
 
-    class Ve : public Component
+    class Ve : public ClonableComponent<Ve>
     {
     public:
-        Ve() : Component("Vel east","feet/s") {};
+        Ve() : ClonableComponent("Vel east","feet/s") {};
         double get() const
         {
             return m_fdm->GetPropagate()->GetVel(2);
@@ -873,10 +957,10 @@ public:
         }
     };
 
-    class Vd : public Component
+    class Vd : public ClonableComponent<Vd>
     {
     public:
-        Vd() : Component("Vel down","feet/s") {};
+        Vd() : ClonableComponent("Vel down","feet/s") {};
         double get() const
         {
             return m_fdm->GetPropagate()->GetVel(3);
@@ -892,10 +976,10 @@ public:
         }
     };
 
-    class COG : public Component
+    class COG : public ClonableComponent<COG>
     {
     public:
-        COG() : Component("Course Over Ground","rad") {};
+        COG() : ClonableComponent("Course Over Ground","rad") {};
         double get() const
         {
             //cog = atan2(Ve,Vn)
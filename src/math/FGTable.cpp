@@ -110,6 +110,30 @@ unsigned int FindNumColumns(const string& test_line)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+// Reads the numbers of a <tableData> element straight into the table data.
+void ReadTableData(Element* tableData, vector<double>& data)
+{
+  for (unsigned int i=0; i<tableData->GetNumDataLines(); i++) {
+    const string& line = tableData->GetDataLine(i);
+    if (line.find_first_not_of("0123456789.-+eE \t\n") != string::npos) {
+      cerr << " In file " << tableData->GetFileName() << endl
+           << "   Illegal character found in line "
+           << tableData->GetLineNumber() + i + 1 << ": " << endl << line << endl;
+      throw BaseException("Illegal character");
+    }
+    try {
+      atof_locale_c(line, data);
+    } catch (InvalidNumber& e) {
+      cerr << " In file " << tableData->GetFileName() << endl
+           << "   Invalid number found in line "
+           << tableData->GetLineNumber() + i + 1 << ": " << endl << line << endl;
+      throw;
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
                  const std::string& Prefix)
   : PropertyManager(pm)
@@ -284,36 +308,25 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
     }
   }
 
-  stringstream buf;
-
-  for (unsigned int i=0; i<tableData->GetNumDataLines(); i++) {
-    string line = tableData->GetDataLine(i);
-    if (line.find_first_not_of("0123456789.-+eE \t\n") != string::npos) {
-      cerr << " In file " << tableData->GetFileName() << endl
-           << "   Illegal character found in line "
-           << tableData->GetLineNumber() + i + 1 << ": " << endl << line << endl;
-      throw BaseException("Illegal character");
-    }
-    buf << line << " ";
-  }
-
   switch (dimension) {
   case 1:
     nRows = tableData->GetNumDataLines();
     nCols = 1;
     Type = tt1D;
     // Fill unused elements with NaNs to detect illegal access.
+    Data.reserve(2*nRows+2);
     Data.push_back(std::numeric_limits<double>::quiet_NaN());
     Data.push_back(std::numeric_limits<double>::quiet_NaN());
-    *this << buf;
+    ReadTableData(tableData, Data);
     break;
   case 2:
     nRows = tableData->GetNumDataLines()-1;
     nCols = FindNumColumns(tableData->GetDataLine(0));
     Type = tt2D;
     // Fill unused elements with NaNs to detect illegal access.
+    Data.reserve((nRows+1)*(nCols+1));
     Data.push_back(std::numeric_limits<double>::quiet_NaN());
-    *this << buf;
+    ReadTableData(tableData, Data);
     break;
   case 3:
     nRows = el->GetNumElements("tableData");
@@ -579,6 +592,184 @@ double FGTable::GetValue(double rowKey, double colKey, double tableKey) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+double FGTable::GetDerivative(const FGDerivativeSeeds& seeds) const
+{
+  assert(!internal);
+
+  double dRowKey = lookupProperty[eRow]->GetDerivative(seeds);
+  double dColKey = 0.0, dTableKey = 0.0;
+  if (Type != tt1D) dColKey = lookupProperty[eColumn]->GetDerivative(seeds);
+  if (Type == tt3D) dTableKey = lookupProperty[eTable]->GetDerivative(seeds);
+
+  // Skip the search of the breakpoints when the lookup properties do not
+  // depend on the variable.
+  if (dRowKey == 0.0 && dColKey == 0.0 && dTableKey == 0.0) return 0.0;
+
+  double dRow, dCol, dTable;
+
+  switch (Type) {
+  case tt1D:
+    return GetSlope(lookupProperty[eRow]->getDoubleValue())*dRowKey;
+  case tt2D:
+    GetGradient(lookupProperty[eRow]->getDoubleValue(),
+                lookupProperty[eColumn]->getDoubleValue(), dRow, dCol);
+    return dRow*dRowKey + dCol*dColKey;
+  case tt3D:
+    GetGradient(lookupProperty[eRow]->getDoubleValue(),
+                lookupProperty[eColumn]->getDoubleValue(),
+                lookupProperty[eTable]->getDoubleValue(), dRow, dCol, dTable);
+    return dRow*dRowKey + dCol*dColKey + dTable*dTableKey;
+  default:
+    assert(false); // Should never be called
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The breakpoints are searched exactly as in GetValue() so that the slopes are
+// those of the segments used by the interpolation. At an inner breakpoint the
+// slope is the mean of the slopes of both segments, which is the limit of the
+// central differences.
+
+double FGTable::GetSlope(double key) const
+{
+  assert(nCols == 1);
+  assert(Data.size() == 2*nRows+2);
+  // The value is constant beyond the ends of the table.
+  if (key <= Data[2] || key >= Data[2*nRows])
+    return 0.0;
+
+  unsigned int r = 2;
+  while (Data[2*r] < key) r++;
+
+  double slope = (Data[2*r+1] - Data[2*r-1]) / (Data[2*r] - Data[2*r-2]);
+  if (Data[2*r] == key)
+    slope = 0.5*(slope + (Data[2*r+3] - Data[2*r+1]) / (Data[2*r+2] - Data[2*r]));
+
+  return slope;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The derivative with respect to the row (resp. column) coordinate does not
+// depend on the column (resp. row) segment at a breakpoint, so the means are
+// taken separately.
+
+void FGTable::GetGradient(double rowKey, double colKey, double& dRow,
+                          double& dCol) const
+{
+  if (nCols == 1) {
+    dRow = GetSlope(rowKey);
+    dCol = 0.0;
+    return;
+  }
+
+  assert(Type == tt2D);
+  assert(Data.size() == (nCols+1)*(nRows+1));
+
+  GetGradient(rowKey, colKey, false, false, dRow, dCol);
+
+  double dRowAbove, dColAbove;
+  for (unsigned int c=2; c < nCols; ++c) {
+    if (Data[c] == colKey) {
+      GetGradient(rowKey, colKey, false, true, dRowAbove, dColAbove);
+      dCol = 0.5*(dCol + dColAbove);
+      break;
+    }
+  }
+  for (unsigned int r=2; r < nRows; ++r) {
+    if (Data[r*(nCols+1)] == rowKey) {
+      GetGradient(rowKey, colKey, true, false, dRowAbove, dColAbove);
+      dRow = 0.5*(dRow + dRowAbove);
+      break;
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTable::GetGradient(double rowKey, double colKey, bool rowAbove,
+                          bool colAbove, double& dRow, double& dCol) const
+{
+  unsigned int c = 2;
+  while((Data[c] < colKey || (colAbove && Data[c] == colKey)) && c < nCols) c++;
+  double x0 = Data[c-1];
+  double Span = Data[c] - x0;
+  assert(Span > 0.0);
+  double cFactor = (colKey - x0) / Span;
+  // The value is constant where the factor is constrained.
+  double dcFactor = (cFactor >= 0.0 && cFactor <= 1.0) ? 1.0 / Span : 0.0;
+  cFactor = Constrain(0.0, cFactor, 1.0);
+
+  if (nRows == 1) {
+    dRow = 0.0;
+    dCol = dcFactor*(Data[(nCols+1)+c] - Data[(nCols+1)+c-1]);
+    return;
+  }
+
+  size_t r = 2;
+  while((Data[r*(nCols+1)] < rowKey
+         || (rowAbove && Data[r*(nCols+1)] == rowKey)) && r < nRows) r++;
+  x0 = Data[(r-1)*(nCols+1)];
+  Span = Data[r*(nCols+1)] - x0;
+  assert(Span > 0.0);
+  double rFactor = (rowKey - x0) / Span;
+  double drFactor = (rFactor >= 0.0 && rFactor <= 1.0) ? 1.0 / Span : 0.0;
+  rFactor = Constrain(0.0, rFactor, 1.0);
+
+  double col1low = Data[(r-1)*(nCols+1)+c-1];
+  double col1high = Data[r*(nCols+1)+c-1];
+  double col2low = Data[(r-1)*(nCols+1)+c];
+  double col2high = Data[r*(nCols+1)+c];
+  double col1temp = rFactor*col1high+(1.0-rFactor)*col1low;
+  double col2temp = rFactor*col2high+(1.0-rFactor)*col2low;
+
+  dCol = dcFactor*(col2temp-col1temp);
+  dRow = drFactor*(cFactor*(col2high-col2low)+(1.0-cFactor)*(col1high-col1low));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTable::GetGradient(double rowKey, double colKey, double tableKey,
+                          double& dRow, double& dCol, double& dTable) const
+{
+  assert(Type == tt3D);
+  assert(Data.size() == nRows+1);
+
+  dTable = 0.0;
+  if(tableKey <= Data[1]) {
+    Tables[0]->GetGradient(rowKey, colKey, dRow, dCol);
+    return;
+  }
+  else if (tableKey >= Data[nRows]) {
+    Tables[nRows-1]->GetGradient(rowKey, colKey, dRow, dCol);
+    return;
+  }
+
+  unsigned int r = 2;
+  while (Data[r] < tableKey) r++;
+
+  double x0 = Data[r-1];
+  double Span = Data[r] - x0;
+  assert(Span > 0.0);
+  double Factor = (tableKey - x0) / Span;
+
+  double dRow0, dCol0, dRow1, dCol1;
+  Tables[r-2]->GetGradient(rowKey, colKey, dRow0, dCol0);
+  Tables[r-1]->GetGradient(rowKey, colKey, dRow1, dCol1);
+  dRow = Factor*(dRow1 - dRow0) + dRow0;
+  dCol = Factor*(dCol1 - dCol0) + dCol0;
+  dTable = (Tables[r-1]->GetValue(rowKey, colKey)
+            - Tables[r-2]->GetValue(rowKey, colKey)) / Span;
+
+  // At an inner breakpoint, dTable is the mean of the slopes of both segments.
+  if (tableKey == Data[r] && r < nRows)
+    dTable = 0.5*(dTable + (Tables[r]->GetValue(rowKey, colKey)
+                            - Tables[r-1]->GetValue(rowKey, colKey))
+                           / (Data[r+1] - Data[r]));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 double FGTable::GetMinValue(void) const
 {
   assert(Type == tt1D);
@@ -596,14 +787,11 @@ double FGTable::GetMinValue(void) const
 
 void FGTable::operator<<(istream& in_stream)
 {
-  double x;
   assert(Type != tt3D);
 
-  in_stream >> x;
-  while(in_stream) {
-    Data.push_back(x);
-    in_stream >> x;
-  }
+  string line;
+  while (getline(in_stream, line))
+    atof_locale_c(line, Data);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -269,12 +269,42 @@ public:
   /// @return The interpolated value
   double GetValue(double rowKey, double colKey, double TableKey) const;
 
+  /** Get the derivative of the current table value with respect to a
+      variable. The table is differentiated along the segments selected by
+      the interpolation: at an inner breakpoint the mean of the slopes of the
+      segments on each side is used, and the slope is null at and beyond the
+      first and last breakpoints.
+      @param seeds the derivatives of the properties with respect to the
+                   variable.
+      @return the derivative of the table value. */
+  double GetDerivative(const FGDerivativeSeeds& seeds) const override;
+  /// @brief Get the slope of a 1D internal table
+  /// @param key Row coordinate at which the slope must be computed
+  /// @return The derivative of the value with respect to the row coordinate
+  double GetSlope(double key) const;
+  /// @brief Get the gradient of a 2D internal table
+  /// @param rowKey Row coordinate at which the gradient must be computed
+  /// @param colKey Column coordinate at which the gradient must be computed
+  /// @param dRow [out] derivative with respect to the row coordinate
+  /// @param dCol [out] derivative with respect to the column coordinate
+  void GetGradient(double rowKey, double colKey, double& dRow,
+                   double& dCol) const;
+  /// @brief Get the gradient of a 3D internal table
+  /// @param rowKey Row coordinate at which the gradient must be computed
+  /// @param colKey Column coordinate at which the gradient must be computed
+  /// @param TableKey Table coordinate at which the gradient must be computed
+  /// @param dRow [out] derivative with respect to the row coordinate
+  /// @param dCol [out] derivative with respect to the column coordinate
+  /// @param dTable [out] derivative with respect to the table coordinate
+  void GetGradient(double rowKey, double colKey, double TableKey, double& dRow,
+                   double& dCol, double& dTable) const;
+
   double GetMinValue(void) const;
   double GetMinValue(double colKey) const;
   double GetMinValue(double colKey, double TableKey) const;
 
-  /** Read the table in.
-      Data in the config file should be in matrix format with the row
+  /** Appends a value to the table.
+      The values should be appended in matrix format with the row
       independents as the first column and the column independents in
       the first row.  The implication of this layout is that there should
       be no value in the upper left corner of the matrix e.g:
@@ -294,9 +324,13 @@ public:
        ...
        </pre>
        */
+  FGTable& operator<<(const double x);
 
+  /** Appends the whitespace separated values read from a stream to the
+      table. The values are laid out as for operator<<(const double).
+      @throw InvalidNumber if the stream contains an item that is not a
+             number. */
   void operator<<(std::istream&);
-  FGTable& operator<<(const double x);
 
   double GetElement(unsigned int r, unsigned int c) const;
   double operator()(unsigned int r, unsigned int c) const
@@ -325,6 +359,10 @@ private:
   std::string Name;
   void bind(Element* el, const std::string& Prefix);
   void missingData(Element *el, unsigned int expected_size, size_t actual_size);
+  // Gradient of a 2D table along the segments before the breakpoints equal
+  // to the keys or, if requested, after them.
+  void GetGradient(double rowKey, double colKey, bool rowAbove, bool colAbove,
+                   double& dRow, double& dCol) const;
   void Debug(int from);
 };
 }
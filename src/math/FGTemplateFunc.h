@@ -64,10 +64,16 @@ public:
     return FGFunction::GetValue();
   }
 
+  double GetDerivative(SGPropertyNode* node, const FGDerivativeSeeds& seeds) {
+    var->SetNode(node);
+    return FGFunction::GetDerivative(seeds);
+  }
+
 private:
   /* Direct calls to FGFunction::GetValue are meaningless from the public interface.
      The method is therefore made private. */
   using FGFunction::GetValue;
+  using FGFunction::GetDerivative;
   /* FGTemplateFunc must not be bound to the property manager. The bind method
      is therefore made private and overloaded as a no-op */
   void bind(Element*, const std::string&) override {}
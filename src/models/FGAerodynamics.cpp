@@ -303,6 +303,18 @@ bool FGAerodynamics::Run(bool Holding)
   // as positive numbers. However, the wind axes themselves assume that the X
   // and Z forces are positive forward and down. Same applies to the stability
   // axes.
+  if (IsLinearized()) {
+    vForces = linearization.Forces;
+    vMoments = linearization.Moments;
+    for (size_t i=0; i < linearization.inputs.size(); ++i) {
+      double delta = linearization.inputs[i]->getDoubleValue()
+                   - linearization.values[i];
+      if (delta == 0.0) continue;
+      vForces += delta*linearization.dForces[i];
+      vMoments += delta*linearization.dMoments[i];
+    }
+  }
+
   vFw = in.Tb2w * vForces;
   vFw(eDrag) *= -1; vFw(eLift) *= -1;
 
@@ -328,6 +340,164 @@ FGColumnVector3 FGAerodynamics::GetForcesInStabilityAxes(void) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+FGDerivativeSeeds FGAerodynamics::GetDerivativeSeeds(void) const
+{
+  FGDerivativeSeeds seeds;
+
+  for (auto& prefunc: PreFunctions)
+    seeds.AddFunction(prefunc->GetOutputNode(), prefunc.get());
+
+  for (unsigned int i=0; i<6; i++) {
+    for (auto f: AeroFunctions[i])
+      seeds.AddFunction(f->GetOutputNode(), f);
+    for (auto f: AeroFunctionsAtCG[i])
+      seeds.AddFunction(f->GetOutputNode(), f);
+  }
+
+  if (AeroRPShift)
+    seeds.AddFunction(AeroRPShift->GetOutputNode(), AeroRPShift);
+
+  return seeds;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Follows the computations of Run() with the derivatives of each quantity.
+
+void FGAerodynamics::GetPartials(const FGDerivativeSeeds& seeds,
+                                 FGColumnVector3& dForces,
+                                 FGColumnVector3& dMoments) const
+{
+  FGColumnVector3 dFnative, dFnativeAtCG, dMomentsMRC;
+
+  for (unsigned int axis_ctr = 0; axis_ctr < 3; ++axis_ctr) {
+    for (auto f: AeroFunctions[axis_ctr])
+      dFnative(axis_ctr+1) += f->GetDerivative(seeds);
+    for (auto f: AeroFunctionsAtCG[axis_ctr])
+      dFnativeAtCG(axis_ctr+1) += f->GetDerivative(seeds);
+    for (auto f: AeroFunctions[axis_ctr+3])
+      dMomentsMRC(axis_ctr+1) += f->GetDerivative(seeds);
+  }
+
+  double dAlpha = seeds.GetDerivative(PropertyManager->GetNode("aero/alpha-rad"));
+  double dBeta = seeds.GetDerivative(PropertyManager->GetNode("aero/beta-rad"));
+  FGMatrix33 dTw2b, dTs2b;
+  GetTransformDerivatives(dAlpha, dBeta, dTw2b, dTs2b);
+
+  // The members vFnative and vFnativeAtCG hold the forces with their signs
+  // already flipped by Run().
+  FGColumnVector3 dForcesMRC, dForcesAtCG;
+  switch (forceAxisType) {
+  case atBodyXYZ:
+    dForcesMRC = dFnative;
+    dForcesAtCG = dFnativeAtCG;
+    break;
+  case atWind:
+    dFnative(eDrag)*=-1; dFnative(eLift)*=-1;
+    dForcesMRC = in.Tw2b*dFnative + dTw2b*vFnative;
+
+    dFnativeAtCG(eDrag)*=-1; dFnativeAtCG(eLift)*=-1;
+    dForcesAtCG = in.Tw2b*dFnativeAtCG + dTw2b*vFnativeAtCG;
+    break;
+  case atBodyAxialNormal:
+    dFnative(eX)*=-1; dFnative(eZ)*=-1;
+    dForcesMRC = dFnative;
+
+    dFnativeAtCG(eX)*=-1; dFnativeAtCG(eZ)*=-1;
+    dForcesAtCG = dFnativeAtCG;
+    break;
+  case atStability:
+    dFnative(eDrag) *= -1; dFnative(eLift) *= -1;
+    dForcesMRC = Ts2b*dFnative + dTs2b*vFnative;
+
+    dFnativeAtCG(eDrag) *= -1; dFnativeAtCG(eLift) *= -1;
+    dForcesAtCG = Ts2b*dFnativeAtCG + dTs2b*vFnativeAtCG;
+    break;
+  default:
+    throw BaseException("FGAerodynamics: a proper axis type has NOT been "
+                        "selected.");
+  }
+
+  FGColumnVector3 dMomentsMRCBodyXYZ;
+  switch (momentAxisType) {
+  case atBodyXYZ:
+    dMomentsMRCBodyXYZ = dMomentsMRC;
+    break;
+  case atStability:
+    dMomentsMRCBodyXYZ = Ts2b*dMomentsMRC + dTs2b*vMomentsMRC;
+    break;
+  case atWind:
+    dMomentsMRCBodyXYZ = in.Tw2b*dMomentsMRC + dTw2b*vMomentsMRC;
+    break;
+  default:
+    throw BaseException("FGAerodynamics: a proper axis type has NOT been "
+                        "selected.");
+  }
+
+  FGColumnVector3 dDXYZcg;
+  if (AeroRPShift) dDXYZcg(eX) = -AeroRPShift->GetDerivative(seeds)*in.Wingchord;
+
+  // M = r X F where F excludes the forces applied at the CG.
+  dMoments = dMomentsMRCBodyXYZ + dDXYZcg*(vForces - vForcesAtCG)
+           + vDXYZcg*dForcesMRC;
+  dForces = dForcesMRC + dForcesAtCG;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAerodynamics::GetPartials(const map<string, double>& seeds,
+                                 FGColumnVector3& dForces,
+                                 FGColumnVector3& dMoments) const
+{
+  FGDerivativeSeeds derivativeSeeds = GetDerivativeSeeds();
+
+  for (auto& seed: seeds) {
+    SGPropertyNode* node = PropertyManager->GetNode(seed.first);
+    if (!node)
+      throw BaseException("FGAerodynamics: the property " + seed.first
+                          + " does not exist.");
+    derivativeSeeds.SetSeed(node, seed.second);
+  }
+
+  GetPartials(derivativeSeeds, dForces, dMoments);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// A first pass without any seed collects the inputs of the functions, then
+// each input is seeded in turn. The expansion is made about the actual
+// forces and moments so the last call to Run() must not have been made with
+// an expansion.
+
+bool FGAerodynamics::Linearize(void)
+{
+  Linearization lin;
+  FGDerivativeSeeds seeds = GetDerivativeSeeds();
+  FGColumnVector3 dF, dM;
+
+  try {
+    seeds.RecordInputs(&lin.inputs);
+    GetPartials(seeds, dF, dM);
+    seeds.RecordInputs(nullptr);
+
+    for (auto node: lin.inputs) {
+      seeds.SetSeed(node, 1.0);
+      GetPartials(seeds, dF, dM);
+      seeds.SetSeed(node, 0.0);
+      lin.values.push_back(node->getDoubleValue());
+      lin.dForces.push_back(dF);
+      lin.dMoments.push_back(dM);
+    }
+  } catch (const BaseException&) {
+    return false;
+  }
+
+  lin.Forces = vForces;
+  lin.Moments = vMoments;
+  linearization = lin;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGAerodynamics::Load(Element *document)
 {
   string axis;
@@ -370,6 +540,7 @@ bool FGAerodynamics::Load(Element *document)
     AeroFunctionArray ca;
     AeroFunctionArray ca_atCG;
     axis = axis_element->GetAttributeValue("name");
+    FGLoadProfile::Scope profile(FDMExec->GetLoadProfile(), "axis ", axis);
     function_element = axis_element->FindElement("function");
     while (function_element) {
       try {
@@ -660,6 +831,40 @@ void FGAerodynamics::BuildStabilityTransformMatrices(void)
   Tb2s = Ts2b.Transposed();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Derivatives of the wind-to-body matrix (see FGAuxiliary) and of the
+// stability-to-body matrix given the derivatives of alpha and beta.
+
+void FGAerodynamics::GetTransformDerivatives(double dAlpha, double dBeta,
+                                             FGMatrix33& dTw2b,
+                                             FGMatrix33& dTs2b) const
+{
+  double ca = cos(in.Alpha);
+  double sa = sin(in.Alpha);
+  double cb = cos(in.Beta);
+  double sb = sin(in.Beta);
+
+  dTw2b(1, 1) = -sa*cb*dAlpha - ca*sb*dBeta;
+  dTw2b(1, 2) =  sa*sb*dAlpha - ca*cb*dBeta;
+  dTw2b(1, 3) = -ca*dAlpha;
+  dTw2b(2, 1) =  cb*dBeta;
+  dTw2b(2, 2) = -sb*dBeta;
+  dTw2b(2, 3) =  0.0;
+  dTw2b(3, 1) =  ca*cb*dAlpha - sa*sb*dBeta;
+  dTw2b(3, 2) = -ca*sb*dAlpha - sa*cb*dBeta;
+  dTw2b(3, 3) = -sa*dAlpha;
+
+  dTs2b(1, 1) = -sa*dAlpha;
+  dTs2b(1, 2) = 0.0;
+  dTs2b(1, 3) = -ca*dAlpha;
+  dTs2b(2, 1) = 0.0;
+  dTs2b(2, 2) = 0.0;
+  dTs2b(2, 3) = 0.0;
+  dTs2b(3, 1) = ca*dAlpha;
+  dTs2b(3, 2) = 0.0;
+  dTs2b(3, 3) = -sa*dAlpha;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
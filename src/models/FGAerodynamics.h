@@ -235,6 +235,58 @@ public:
 
   std::vector <FGFunction*> * GetAeroFunctions(void) const { return AeroFunctions; }
 
+  /** Builds the seeds of a differentiation of the aerodynamic forces and
+      moments. The functions of the aerodynamics section are registered in the
+      seeds so that the properties which they compute are differentiated. The
+      seeds of the variable are then to be set by the caller.
+      @return the seeds without any seed set. */
+  FGDerivativeSeeds GetDerivativeSeeds(void) const;
+
+  /** Computes the partial derivatives of the aerodynamic forces and moments
+      with respect to a variable. The aerodynamic functions are differentiated
+      analytically (see FGFunction::GetDerivative) rather than by running the
+      model again. The rotation from the wind or stability axes to the body
+      axes is differentiated with the seeds of aero/alpha-rad and
+      aero/beta-rad. The derivatives are computed at the state of the last
+      call to Run().
+      @param seeds the derivatives of the properties with respect to the
+                   variable (see GetDerivativeSeeds).
+      @param dForces [out] the derivative of the total force in the body axes.
+      @param dMoments [out] the derivative of the total moment about the CG in
+                      the body axes.
+      @throws BaseException if a function cannot be differentiated. */
+  void GetPartials(const FGDerivativeSeeds& seeds, FGColumnVector3& dForces,
+                   FGColumnVector3& dMoments) const;
+
+  /** Computes the partial derivatives of the aerodynamic forces and moments
+      with respect to a variable.
+      @param seeds the derivatives of the properties with respect to the
+                   variable, indexed by the property names.
+      @param dForces [out] the derivative of the total force in the body axes.
+      @param dMoments [out] the derivative of the total moment about the CG in
+                      the body axes.
+      @throws BaseException if a property does not exist or if a function
+              cannot be differentiated. */
+  void GetPartials(const std::map<std::string, double>& seeds,
+                   FGColumnVector3& dForces, FGColumnVector3& dMoments) const;
+
+  /** Replaces the aerodynamic forces and moments by their first order
+      expansion about the state of the last call to Run(). The expansion is
+      made with respect to the properties which the aerodynamic functions
+      read, and its coefficients are computed by GetPartials(). The finite
+      difference jacobians of FGStateSpace and FGTrim then get the exact
+      derivatives of the aerodynamics while the other models are still
+      differentiated numerically.
+      @return false if a function cannot be differentiated, in which case the
+              aerodynamics are left unchanged. */
+  bool Linearize(void);
+
+  /// Restores the aerodynamics that Linearize() has replaced.
+  void ClearLinearization(void) { linearization.inputs.clear(); }
+
+  /// Returns true if the aerodynamics are replaced by their expansion.
+  bool IsLinearized(void) const { return !linearization.inputs.empty(); }
+
   struct Inputs {
     double Alpha;
     double Beta;
@@ -275,6 +327,14 @@ private:
   double bi2vel, ci2vel,alphaw;
   double clsq, lod, qbar_area;
 
+  // First order expansion of the forces and moments (see Linearize())
+  struct Linearization {
+    std::vector<const SGPropertyNode*> inputs;
+    std::vector<double> values;
+    std::vector<FGColumnVector3> dForces, dMoments;
+    FGColumnVector3 Forces, Moments;
+  } linearization;
+
   typedef double (FGAerodynamics::*PMF)(int) const;
   void DetermineAxisSystem(Element* document);
   void ProcessAxesNameAndFrame(FGAerodynamics::eAxisType& axisType,
@@ -282,6 +342,8 @@ private:
                                Element* el, const std::string& validNames);
   void bind(void);
   void BuildStabilityTransformMatrices(void);
+  void GetTransformDerivatives(double dAlpha, double dBeta, FGMatrix33& dTw2b,
+                               FGMatrix33& dTs2b) const;
 
   void Debug(int from) override;
 };
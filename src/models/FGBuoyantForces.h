@@ -116,6 +116,9 @@ public:
       @return false if no error */
   bool Run(bool Holding) override;
 
+  /// The model is idle when no gas cell is defined.
+  bool IsIdle(void) const override { return NoneDefined; }
+
   /** Loads the Buoyant forces model.
       The Load function for this class expects the XML parser to
       have found the Buoyant_forces keyword in the configuration file.
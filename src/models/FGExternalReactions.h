@@ -142,7 +142,10 @@ public:
                      "Resume" command to be given.
       @return true always.  */
   bool Run(bool Holding) override;
-  
+
+  /// The model is idle when no external force is defined.
+  bool IsIdle(void) const override { return Forces.empty(); }
+
   /** Loads the external forces from the XML configuration file.
       If the external_reactions section is encountered in the vehicle configuration
       file, this Load() method is called. All external forces will be parsed, and 
@@ -507,6 +507,8 @@ bool FGFCS::Load(Element* document)
 
     string sOnOffProperty = channel_element->GetAttributeValue("execute");
     string sChannelName = channel_element->GetAttributeValue("name");
+    FGLoadProfile::Scope profile(FDMExec->GetLoadProfile(), "channel ",
+                                 sChannelName);
 
     if (!channel_element->GetAttributeValue("execrate").empty())
       ChannelRate = channel_element->GetAttributeValueAsNumber("execrate");
@@ -61,6 +61,11 @@ CLASS DOCUMENTATION
       execrate [optional] is the rate at which the channel should execute.
                A value of 0 or 1 will execute the channel every frame, a value of 2
                every other frame (half rate), a value of 4 is every 4th frame (quarter rate)
+
+      When the executive runs with an adaptive time step, the components of a
+      channel are run with the simulation time elapsed since the channel was
+      last run so that filters, integrators and rate limits keep their time
+      constants. Delays remain expressed in frames.
       */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -79,6 +84,7 @@ public:
     ExecRate = execRate < 1 ? 1 : execRate;
     // Set ExecFrameCountSinceLastRun so that each components are initialized
     ExecFrameCountSinceLastRun = ExecRate;
+    LastRunTime = -1.0;
   }
 
   /// Destructor
@@ -113,6 +119,7 @@ public:
     // Set ExecFrameCountSinceLastRun so that each components are initialized
     // after a reset.
     ExecFrameCountSinceLastRun = ExecRate;
+    LastRunTime = -1.0;
   }
   /// Executes all the components in a channel.
   void Execute() {
@@ -132,6 +139,7 @@ public:
     // channel will be run at rate 1 if trimming, or when the next execrate
     // frame is reached
     if (fcs->GetTrimStatus() || ExecFrameCountSinceLastRun >= ExecRate) {
+      if (fcs->GetExec()->VariableTimeStep()) UpdateComponentsDt();
       for (unsigned int i=0; i<FCSComponents.size(); i++)
         FCSComponents[i]->Run();
     }
@@ -140,6 +148,20 @@ public:
   int GetRate(void) const { return ExecRate; }
 
   private:
+    // With an adaptive time step, the frames do not have the same duration so
+    // the components are run with the simulation time that has elapsed since
+    // the channel was last run.
+    void UpdateComponentsDt(void) {
+      double sim_time = fcs->GetExec()->GetSimTime();
+      double dt = LastRunTime < 0.0 ? fcs->GetChannelDeltaT()
+                                    : sim_time - LastRunTime;
+      LastRunTime = sim_time;
+      if (dt <= 0.0) return;
+
+      for (unsigned int i=0; i<FCSComponents.size(); i++)
+        FCSComponents[i]->SetDt(dt);
+    }
+
     FGFCS* fcs;
     FCSCompVec FCSComponents;
     SGConstPropertyNode_ptr OnOffNode;
@@ -147,6 +169,7 @@ public:
 
     int ExecRate;        // rate at which this system executes, 0 or 1 every frame, 2 every second frame etc..
     int ExecFrameCountSinceLastRun;
+    double LastRunTime;  // simulation time at which the channel was last run (adaptive time step only)
 };
 
 }
@@ -35,6 +35,8 @@ HISTORY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <limits>
+
 #include "FGFDMExec.h"
 #include "FGInertial.h"
 #include "input_output/FGXMLElement.h"
@@ -119,6 +121,13 @@ bool FGInertial::Load(Element* el)
 
   GroundCallback->SetEllipse(a, b);
 
+  // The gravity field of a previously loaded planet does not apply to this one.
+  GravityField.reset();
+  if (gravType == gtSphericalHarmonics) gravType = gtWGS84;
+
+  Element* field_el = el->FindElement("gravity_field");
+  if (field_el) LoadGravityField(field_el);
+
   // Messages to warn the user about possible inconsistencies.
   if (debug_lvl > 0) {
     FGLogging log(FDMExec->GetLogger(), LogLevel::WARN);
@@ -152,6 +161,9 @@ bool FGInertial::Run(bool Holding)
   case gtWGS84:
     vGravAccel = GetGravityJ2(in.Position);
     break;
+  case gtSphericalHarmonics:
+    vGravAccel = GravityField->GetGravitation(in.Position);
+    break;
   }
 
   return false;
@@ -171,11 +183,15 @@ FGMatrix33 FGInertial::GetTl2ec(const FGLocation& location) const
     }
     break;
   case gtWGS84:
+  case gtSphericalHarmonics:
     {
       FGLocation sea_level = location;
       sea_level.SetPositionGeodetic(location.GetLongitude(),
                                     location.GetGeodLatitudeRad(), 0.0);
-      Down = GetGravityJ2(location);
+      if (gravType == gtWGS84)
+        Down = GetGravityJ2(location);
+      else
+        Down = GravityField->GetGravitation(location);
       Down -= vOmegaPlanet*(vOmegaPlanet*sea_level);}
     }
   Down.Normalize();
@@ -224,6 +240,46 @@ FGColumnVector3 FGInertial::GetGravityJ2(const FGLocation& position) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGInertial::LoadGravityField(Element* el)
+{
+  string fname = el->GetAttributeValue("file");
+  if (fname.empty()) {
+    XMLLogException err(FDMExec->GetLogger(), el);
+    err << "The gravity field file name is missing." << endl;
+    throw err;
+  }
+
+  SGPath path = SGPath::fromUtf8(fname);
+  if (path.isRelative()) {
+    SGPath dir = SGPath::fromUtf8(SGPath::fromUtf8(el->GetFileName()).dir());
+    if (dir.isNull() || !(dir/fname).exists())
+      dir = FDMExec->GetRootDir();
+    path = dir/fname;
+  }
+
+  unsigned int max_degree = numeric_limits<unsigned int>::max();
+  if (el->HasAttribute("degree"))
+    max_degree = static_cast<unsigned int>(el->GetAttributeValueAsNumber("degree"));
+
+  auto field = std::make_unique<FGGravityField>();
+  try {
+    field->Load(path, max_degree);
+  }
+  catch (BaseException& e) {
+    XMLLogException err(FDMExec->GetLogger(), el);
+    err << e.what() << endl;
+    throw err;
+  }
+
+  if (el->FindElement("cache_distance"))
+    field->SetCacheDistance(el->FindElementValueAsNumberConvertTo("cache_distance", "FT"));
+
+  GravityField = std::move(field);
+  gravType = gtSphericalHarmonics;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGInertial::SetAltitudeAGL(FGLocation& location, double altitudeAGL)
 {
   FGColumnVector3 vDummy;
@@ -252,6 +308,12 @@ void FGInertial::SetGravityType(int gt)
   case eGravType::gtWGS84:
     if (J2 == 0.0)
       log << "WGS84 gravity model has been set without specifying the J2 gravitational constant." << endl;
+    break;
+  case eGravType::gtSphericalHarmonics:
+    if (!GravityField) {
+      log << "The spherical harmonics gravity model requires a <gravity_field> element. The gravity model is unchanged." << endl;
+      return;
+    }
   }
 
   gravType = gt;
@@ -299,7 +361,11 @@ void FGInertial::Debug(int from)
           << "    Semi minor axis: " << b << endl
           << "    Rotation rate  : " << scientific << vOmegaPlanet(eZ) << endl
           << "    GM             : " << GM << endl
-          << "    J2             : " << J2 << endl << defaultfloat << endl;
+          << "    J2             : " << J2 << endl << defaultfloat;
+      if (GravityField)
+        log << "    Gravity field  : degree " << GravityField->GetDegree()
+            << endl;
+      log << endl;
     }
   }
   if (debug_lvl & 2 ) { // Instantiation/Destruction notification
@@ -42,6 +42,7 @@ INCLUDES
 
 #include "FGModel.h"
 #include "math/FGLocation.h"
+#include "math/FGGravityField.h"
 #include "input_output/FGGroundCallback.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -56,6 +57,25 @@ CLASS DOCUMENTATION
 
 /** Models inertial forces (e.g. centripetal and coriolis accelerations).
     Starting conversion to WGS84.
+
+    The planet characteristics are read from the <tt>&lt;planet&gt;</tt>
+    element. In addition to the J2 model, the gravitation can be computed from
+    a spherical harmonic expansion whose coefficients are read from a file in
+    the ICGEM format:
+
+    @code
+    <gravity_field file="{string}" degree="{integer}">
+      <cache_distance unit="{LENGTH}"> {number} </cache_distance>
+    </gravity_field>
+    @endcode
+
+    The file name is relative to the directory of the planet file. The
+    expansion is truncated to the degree given by the attribute
+    <tt>degree</tt> (all the coefficients of the file are used if it is
+    omitted). The optional element <tt>cache_distance</tt> specifies the
+    distance below which the last evaluation of the expansion is reused (see
+    FGGravityField::SetCacheDistance). When a gravity field is loaded, it
+    becomes the gravitation model (<tt>simulation/gravity-model</tt> = 2).
   */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -157,7 +177,10 @@ public:
     gtStandard,
     /// Evaluate gravity using WGS84 formulas that take the Earth oblateness
     /// into account
-    gtWGS84
+    gtWGS84,
+    /// Evaluate gravity using the spherical harmonic expansion read from the
+    /// <gravity_field> element
+    gtSphericalHarmonics
   };
 
   /// Get the gravity type.
@@ -215,9 +238,11 @@ private:
   double b;    // WGS84 semiminor axis length in feet
   int gravType;
   std::unique_ptr<FGGroundCallback> GroundCallback;
+  std::unique_ptr<FGGravityField> GravityField;
 
   double GetGAccel(double r) const;
   FGColumnVector3 GetGravityJ2(const FGLocation& position) const;
+  void LoadGravityField(Element* el);
   void bind(void);
   void Debug(int from) override;
 };
@@ -116,6 +116,7 @@ bool FGInput::Load(Element* el)
   PostLoad(element, FDMExec);
 
   InputTypes.push_back(Input);
+  FDMExec->RescheduleModels();
 
   Debug(2);
   return true;
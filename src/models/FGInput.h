@@ -110,6 +110,9 @@ public:
       @return false if no error */
   bool Run(bool Holding) override;
 
+  /// The model is idle when no input instance is defined.
+  bool IsIdle(void) const override { return InputTypes.empty(); }
+
   /** Adds a new input instance to the Input Manager. The definition of the
       new input instance is read from a file.
       @param fname the name of the file from which the ouput directives should
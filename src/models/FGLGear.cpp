@@ -327,7 +327,7 @@ const FGColumnVector3& FGLGear::GetBodyForces(void)
       // transform this height in actual compression of the strut (BOGEY) or in
       // the normal direction to the ground (STRUCTURE)
       double normalZ = (in.Tec2l*normal)(eZ);
-      LGearProj = -(mTGear.Transposed() * vGroundNormal)(eZ);
+      LGearProj = -mTGear.TransposedMultiply(vGroundNormal)(eZ);
 
       // The following equations use the vector to the tire contact patch
       // including the strut compression.
@@ -355,13 +355,13 @@ const FGColumnVector3& FGLGear::GetBodyForces(void)
       vActingXYZn = vXYZn + Tb2s * vWhlDisplVec;
       FGColumnVector3 vBodyWhlVel = in.PQR * vWhlContactVec;
       vBodyWhlVel += in.UVW - in.Tec2b * terrainVel;
-      vWhlVelVec = mTGear.Transposed() * vBodyWhlVel;
+      vWhlVelVec = mTGear.TransposedMultiply(vBodyWhlVel);
 
-      InitializeReporting();
+      if (!fdmex->IntermediateStage()) InitializeReporting();
       ComputeSteeringAngle();
       ComputeGroundFrame();
 
-      vGroundWhlVel = mT.Transposed() * vBodyWhlVel;
+      vGroundWhlVel = mT.TransposedMultiply(vBodyWhlVel);
 
       if (fdmex->GetTrimStatus() || in.TotalDeltaT == 0.0)
         compressSpeed = 0.0; // Steady state is sought during trimming
@@ -404,10 +404,14 @@ const FGColumnVector3& FGLGear::GetBodyForces(void)
       // Return to neutral position between 1.0 and 0.8 gear pos.
       SteerAngle *= max(gearPos-0.8, 0.0)/0.2;
 
-      ResetReporting();
+      if (!fdmex->IntermediateStage()) ResetReporting();
     }
   }
 
+  // The intermediate stages of a multi-stage integration scheme are not frames:
+  // the wheel spin and the reporting are only updated once per time step.
+  if (fdmex->IntermediateStage()) return FGForce::GetBodyForces();
+
   if (!WOW) {
     // Let wheel spin down slowly
     vWhlVelVec(eX) -= 13.0 * in.TotalDeltaT;
@@ -427,6 +431,19 @@ const FGColumnVector3& FGLGear::GetBodyForces(void)
   return FGForce::GetBodyForces();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGLGear::GetContactHeight(const FGLocation& location,
+                                 const FGMatrix33& Tb2l) const
+{
+  FGColumnVector3 normal, terrainVel, dummy;
+  FGLocation contact;
+  FGLocation gearLoc = location.LocalToLocation(Tb2l * GetBodyLocation());
+
+  return fdmex->GetInertial()->GetContactPoint(gearLoc, contact, normal,
+                                               terrainVel, dummy);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // Build a local "ground" coordinate system defined by
 //  eX : projection of the rolling direction on the ground
@@ -656,7 +673,7 @@ void FGLGear::ComputeVerticalStrutForce()
   switch (eContactType) {
   case ctBOGEY:
     // Project back the strut force in the local coordinate frame of the ground
-    vFn(eZ) = StrutForce / (mTGear.Transposed()*vGroundNormal)(eZ);
+    vFn(eZ) = StrutForce / mTGear.TransposedMultiply(vGroundNormal)(eZ);
     break;
   case ctSTRUCTURE:
     vFn(eZ) = -StrutForce;
@@ -763,7 +780,7 @@ void FGLGear::UpdateForces(void)
     vFn(eY) = LMultiplier[ftSide].value;
   }
   else {
-    FGColumnVector3 forceDir = mT.Transposed() * LMultiplier[ftDynamic].ForceJacobian;
+    FGColumnVector3 forceDir = mT.TransposedMultiply(LMultiplier[ftDynamic].ForceJacobian);
     vFn(eX) = LMultiplier[ftDynamic].value * forceDir(eX);
     vFn(eY) = LMultiplier[ftDynamic].value * forceDir(eY);
   }
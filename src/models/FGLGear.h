@@ -248,6 +248,15 @@ public:
   const FGColumnVector3& GetLocalGear(void) const { return vLocalGear; }
   double GetLocalGear(int idx) const { return vLocalGear(idx); }
 
+  /** Gets the height of the uncompressed contact point above the ground for a
+      given vehicle position and orientation. The height is negative when the
+      gear is compressed. The ground bumps are not taken into account.
+      @param location the location of the center of gravity
+      @param Tb2l     the transform matrix from the body to the local frame
+      @return the height in feet */
+  double GetContactHeight(const FGLocation& location,
+                          const FGMatrix33& Tb2l) const;
+
   /// Gets the name of the gear
   const std::string& GetName(void) const {return name; }
   /// Gets the Weight On Wheels flag value
@@ -284,11 +293,11 @@ public:
 
   double GetWheelRollForce(void) {
     UpdateForces();
-    FGColumnVector3 vForce = mTGear.Transposed() * FGForce::GetBodyForces();
+    FGColumnVector3 vForce = mTGear.TransposedMultiply(FGForce::GetBodyForces());
     return vForce(eX)*cos(SteerAngle) + vForce(eY)*sin(SteerAngle); }
   double GetWheelSideForce(void) {
     UpdateForces();
-    FGColumnVector3 vForce = mTGear.Transposed() * FGForce::GetBodyForces();
+    FGColumnVector3 vForce = mTGear.TransposedMultiply(FGForce::GetBodyForces());
     return vForce(eY)*cos(SteerAngle) - vForce(eX)*sin(SteerAngle); }
   double GetBodyXForce(void) {
     UpdateForces();
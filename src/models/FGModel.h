@@ -86,6 +86,12 @@ public:
       @return false if no error */
   virtual bool Run(bool Holding);
 
+  /** Tells whether the model has nothing to compute.
+      The executive leaves idle models out of the frame loop. A model that
+      reports being idle must keep its outputs at their initial values.
+      @return true if running the model would have no effect */
+  virtual bool IsIdle(void) const { return false; }
+
   bool InitModel(void) override;
   /// Set the ouput rate for the model in frames
   void SetRate(unsigned int tt) {rate = tt;}
@@ -235,6 +235,7 @@ bool FGOutput::Load(int subSystems, std::string protocol, std::string type,
   Output->SetOutputProperties(outputProperties);
 
   OutputTypes.push_back(Output);
+  FDMExec->RescheduleModels();
 
   Debug(2);
   return true;
@@ -285,6 +286,7 @@ bool FGOutput::Load(Element* document, const SGPath& dir)
   Output->PostLoad(document, FDMExec);
 
   OutputTypes.push_back(Output);
+  FDMExec->RescheduleModels();
 
   Debug(2);
   return true;
@@ -144,6 +144,8 @@ public:
                      on a socket for the "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  /// The model is idle when no output instance is defined.
+  bool IsIdle(void) const override { return OutputTypes.empty(); }
   /** Makes all the output instances to generate their ouput. This method does
       not check that the time step at which the output is requested is
       consistent with the output rate RATE_IN_HZ. Although Print is not a
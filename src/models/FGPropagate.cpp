@@ -94,11 +94,14 @@ FGPropagate::FGPropagate(FGFDMExec* fdmex)
   integrator_translational_rate = eAdamsBashforth2;
   integrator_rotational_position = eRectEuler;
   integrator_translational_position = eAdamsBashforth3;
+  integrator_runge_kutta = eRKNone;
+  step_taken = step_proposed = 0.0;
+  stale_histories = false;
 
-  VState.dqPQRidot.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqUVWidot.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqInertialVelocity.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqQtrndot.resize(5, FGQuaternion(0.0,0.0,0.0));
+  VState.dqPQRidot.Fill(FGColumnVector3(0.0,0.0,0.0));
+  VState.dqUVWidot.Fill(FGColumnVector3(0.0,0.0,0.0));
+  VState.dqInertialVelocity.Fill(FGColumnVector3(0.0,0.0,0.0));
+  VState.dqQtrndot.Fill(FGQuaternion(0.0,0.0,0.0));
 
   epa = 0.0;
 
@@ -123,15 +126,13 @@ bool FGPropagate::InitModel(void)
   VState.vLocation.SetEllipse(in.SemiMajor, in.SemiMinor);
   Inertial->SetAltitudeAGL(VState.vLocation, 4.0);
 
-  VState.dqPQRidot.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqUVWidot.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqInertialVelocity.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqQtrndot.resize(5, FGColumnVector3(0.0,0.0,0.0));
-
   integrator_rotational_rate = eRectEuler;
   integrator_translational_rate = eAdamsBashforth2;
   integrator_rotational_position = eRectEuler;
   integrator_translational_position = eAdamsBashforth3;
+  integrator_runge_kutta = eRKNone;
+  step_taken = step_proposed = 0.0;
+  stale_histories = false;
 
   epa = 0.0;
 
@@ -185,14 +186,15 @@ void FGPropagate::SetInitialState(const FGInitialCondition* FGIC)
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-// Initialize the past value deques
+// Initialize the past value histories
 
 void FGPropagate::InitializeDerivatives()
 {
-  VState.dqPQRidot.assign(5, in.vPQRidot);
-  VState.dqUVWidot.assign(5, in.vUVWidot);
-  VState.dqInertialVelocity.assign(5, VState.vInertialVelocity);
-  VState.dqQtrndot.assign(5, VState.vQtrndot);
+  VState.dqPQRidot.Fill(in.vPQRidot);
+  VState.dqUVWidot.Fill(in.vUVWidot);
+  VState.dqInertialVelocity.Fill(VState.vInertialVelocity);
+  VState.dqQtrndot.Fill(VState.vQtrndot);
+  stale_histories = false;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -225,26 +227,54 @@ bool FGPropagate::Run(bool Holding)
   // Propagate rotational / translational velocity, angular /translational position, respectively.
 
   if (!FDMExec->IntegrationSuspended()) {
-    Integrate(VState.qAttitudeECI,      VState.vQtrndot,      VState.dqQtrndot,          dt, integrator_rotational_position);
-    Integrate(VState.vPQRi,             in.vPQRidot,          VState.dqPQRidot,          dt, integrator_rotational_rate);
-    Integrate(VState.vInertialPosition, VState.vInertialVelocity, VState.dqInertialVelocity, dt, integrator_translational_position);
-    Integrate(VState.vInertialVelocity, in.vUVWidot,          VState.dqUVWidot,          dt, integrator_translational_rate);
+    // The nominal step is proposed for the next frame until the time step is
+    // made adaptive.
+    if (in.Tolerance == 0.0) step_proposed = dt;
+
+    if (in.Tolerance > 0.0) {
+      dt = IntegrateAdaptive(dt);
+      stale_histories = true;
+    }
+    else if (integrator_runge_kutta != eRKNone) {
+      IntegrateRungeKutta(dt, integrator_runge_kutta, GetIntegratedState(),
+                          GetStateDerivative());
+      stale_histories = true;
+    }
+    else {
+      // The Runge-Kutta schemes do not feed the past value histories so they
+      // must be primed again when switching back to the multistep schemes.
+      if (stale_histories) InitializeDerivatives();
+      Integrate(VState.qAttitudeECI,      VState.vQtrndot,      VState.dqQtrndot,          dt, integrator_rotational_position);
+      Integrate(VState.vPQRi,             in.vPQRidot,          VState.dqPQRidot,          dt, integrator_rotational_rate);
+      Integrate(VState.vInertialPosition, VState.vInertialVelocity, VState.dqInertialVelocity, dt, integrator_translational_position);
+      Integrate(VState.vInertialVelocity, in.vUVWidot,          VState.dqUVWidot,          dt, integrator_translational_rate);
+    }
   }
 
+  // 1. Update the Earth position angle (EPA)
+  epa += in.vOmegaPlanet(eZ)*dt;
+
+  UpdateDerivedState();
+
+  // Compute orbital parameters in the inertial frame
+  ComputeOrbitalParameters();
+
+  Debug(2);
+  return false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Updates the transformation matrices and the auxiliary state variables from
+// the integrated state and the Earth position angle.
+
+void FGPropagate::UpdateDerivedState(void)
+{
   // CAUTION : the order of the operations below is very important to get
   // transformation matrices that are consistent with the new state of the
   // vehicle
 
-  // 1. Update the Earth position angle (EPA)
-  epa += in.vOmegaPlanet(eZ)*dt;
-
   // 2. Update the Ti2ec and Tec2i transforms from the updated EPA
-  double cos_epa = cos(epa);
-  double sin_epa = sin(epa);
-  Ti2ec = { cos_epa, sin_epa, 0.0,
-            -sin_epa, cos_epa, 0.0,
-            0.0, 0.0, 1.0 };
-  Tec2i = Ti2ec.Transposed();          // ECEF to ECI frame transform
+  UpdateEarthPositionMatrices();
 
   // 3. Update the location from the updated Ti2ec and inertial position
   VState.vLocation = Ti2ec*VState.vInertialPosition;
@@ -274,12 +304,215 @@ bool FGPropagate::Run(bool Holding)
   // Compute vehicle velocity wrt ECEF frame, expressed in Local horizontal
   // frame.
   vVel = Tb2l * VState.vUVW;
+}
 
-  // Compute orbital parameters in the inertial frame
-  ComputeOrbitalParameters();
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-  Debug(2);
-  return false;
+void FGPropagate::UpdateEarthPositionMatrices(void)
+{
+  double cos_epa = cos(epa);
+  double sin_epa = sin(epa);
+  Ti2ec = { cos_epa, sin_epa, 0.0,
+            -sin_epa, cos_epa, 0.0,
+            0.0, 0.0, 1.0 };
+  Tec2i = Ti2ec.Transposed();          // ECEF to ECI frame transform
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Butcher tableaux of the whole state Runge-Kutta schemes. The weights b[]
+// give the propagated solution and the weights e[] give the difference between
+// the embedded solution and the propagated one (zero if there is none).
+// See Hairer, Norsett & Wanner, "Solving Ordinary Differential Equations I",
+// Second edition (1993), tables 1.2 (page 138) and 4.1 (page 177)
+
+namespace {
+  struct ButcherTableau {
+    unsigned int stages;
+    double c[6];
+    double a[6][5];
+    double b[6];
+    double e[6];
+  };
+
+  const ButcherTableau RK4Tableau = {
+    4,
+    {0.0, 0.5, 0.5, 1.0},
+    {{},
+     {0.5},
+     {0.0, 0.5},
+     {0.0, 0.0, 1.0}},
+    {1./6., 1./3., 1./3., 1./6.},
+    {}
+  };
+
+  const ButcherTableau RKF45Tableau = {
+    6,
+    {0.0, 1./4., 3./8., 12./13., 1.0, 1./2.},
+    {{},
+     {1./4.},
+     {3./32., 9./32.},
+     {1932./2197., -7200./2197., 7296./2197.},
+     {439./216., -8.0, 3680./513., -845./4104.},
+     {-8./27., 2.0, -3544./2565., 1859./4104., -11./40.}},
+    {25./216., 0.0, 1408./2565., 2197./4104., -1./5., 0.0},
+    {16./135. - 25./216., 0.0, 6656./12825. - 1408./2565.,
+     28561./56430. - 2197./4104., -9./50. + 1./5., 2./55.}
+  };
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Integrates the whole vehicle state X0 over the time step dt with a
+// Runge-Kutta scheme. K0 is the state derivative at the beginning of the time
+// step; the derivatives at the intermediate stages are obtained by running the
+// force and moment models through the executive. On exit, the integrated state
+// has been advanced while the EPA and the derived state are left to the caller.
+
+void FGPropagate::IntegrateRungeKutta(double dt, eRungeKuttaType type,
+                                      const StateVector& X0,
+                                      const StateVector& K0)
+{
+  const ButcherTableau& rk = type == eRKF45 ? RKF45Tableau : RK4Tableau;
+  const double epa0 = epa;
+  StateVector K[6];
+
+  K[0] = K0;
+
+  for (unsigned int s=1; s<rk.stages; ++s) {
+    StateVector X = X0;
+    for (unsigned int j=0; j<s; ++j) {
+      double h = dt*rk.a[s][j];
+      if (h == 0.0) continue;
+      X.qAttitudeECI      += h*K[j].qAttitudeECI;
+      X.vPQRi             += h*K[j].vPQRi;
+      X.vInertialPosition += h*K[j].vInertialPosition;
+      X.vInertialVelocity += h*K[j].vInertialVelocity;
+    }
+
+    epa = epa0 + in.vOmegaPlanet(eZ)*rk.c[s]*dt;
+    SetIntegratedState(X);
+    FDMExec->RunIntermediateStage();
+    K[s] = GetStateDerivative();
+  }
+
+  StateVector X = X0;
+  StateError = StateVector();
+  StateError.qAttitudeECI = FGQuaternion::zero();
+
+  for (unsigned int j=0; j<rk.stages; ++j) {
+    double h = dt*rk.b[j];
+    X.qAttitudeECI      += h*K[j].qAttitudeECI;
+    X.vPQRi             += h*K[j].vPQRi;
+    X.vInertialPosition += h*K[j].vInertialPosition;
+    X.vInertialVelocity += h*K[j].vInertialVelocity;
+
+    double he = dt*rk.e[j];
+    StateError.qAttitudeECI      += he*K[j].qAttitudeECI;
+    StateError.vPQRi             += he*K[j].vPQRi;
+    StateError.vInertialPosition += he*K[j].vInertialPosition;
+    StateError.vInertialVelocity += he*K[j].vInertialVelocity;
+  }
+
+  epa = epa0;
+  X.qAttitudeECI.Normalize();
+  VState.qAttitudeECI      = X.qAttitudeECI;
+  VState.vPQRi             = X.vPQRi;
+  VState.vInertialPosition = X.vInertialPosition;
+  VState.vInertialVelocity = X.vInertialVelocity;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Integrates the vehicle state with the Runge-Kutta-Fehlberg scheme and
+// controls the time step from its error estimate. The step is rejected and
+// integrated again with a shorter time step as long as the error exceeds the
+// tolerance and the time step is above its lower bound. The step for the next
+// frame is proposed from the error of the step that has been taken.
+// Returns the time step that has been taken.
+// See Hairer, Norsett & Wanner, "Solving Ordinary Differential Equations I",
+// Second edition (1993), section II.4 (page 167)
+
+double FGPropagate::IntegrateAdaptive(double dt)
+{
+  const double safety = 0.9, min_factor = 0.2, max_factor = 5.0;
+  // The derivatives at the beginning of the time step have been computed by the
+  // executive at the end of the previous time step. They must be saved since
+  // the intermediate stages of a rejected step overwrite them.
+  const StateVector X0 = GetIntegratedState();
+  const StateVector K0 = GetStateDerivative();
+  double ratio;
+
+  for(;;) {
+    IntegrateRungeKutta(dt, eRKF45, X0, K0);
+    ratio = GetErrorRatio(X0);
+    if (ratio <= 1.0 || dt <= in.DeltaTMin) break;
+
+    dt = max(dt*max(min_factor, safety*pow(ratio, -0.2)), in.DeltaTMin);
+  }
+
+  step_taken = dt;
+  if (ratio > 0.0)
+    step_proposed = dt*Constrain(min_factor, safety*pow(ratio, -0.2), max_factor);
+  else
+    step_proposed = dt*max_factor;
+
+  return dt;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the ratio of the error estimate of the last Runge-Kutta-Fehlberg step
+// to the tolerance. Each part of the state is scaled by its magnitude at the
+// beginning of the step, or by one unit if it is smaller than that.
+
+double FGPropagate::GetErrorRatio(const StateVector& X0) const
+{
+  double position = StateError.vInertialPosition.Magnitude()
+                  / max(X0.vInertialPosition.Magnitude(), 1.0);
+  double velocity = StateError.vInertialVelocity.Magnitude()
+                  / max(X0.vInertialVelocity.Magnitude(), 1.0);
+  double attitude = StateError.qAttitudeECI.Magnitude();
+  double rate = StateError.vPQRi.Magnitude() / max(X0.vPQRi.Magnitude(), 1.0);
+
+  return max(max(position, velocity), max(attitude, rate)) / in.Tolerance;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGPropagate::StateVector FGPropagate::GetIntegratedState(void) const
+{
+  return {VState.qAttitudeECI, VState.vPQRi, VState.vInertialPosition,
+          VState.vInertialVelocity};
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGPropagate::StateVector FGPropagate::GetStateDerivative(void) const
+{
+  return {VState.vQtrndot, in.vPQRidot, VState.vInertialVelocity, in.vUVWidot};
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Moves the vehicle to an intermediate stage of a Runge-Kutta step so that the
+// models can be evaluated at that state.
+
+void FGPropagate::SetIntegratedState(const StateVector& state)
+{
+  VState.qAttitudeECI      = state.qAttitudeECI;
+  VState.qAttitudeECI.Normalize();
+  VState.vPQRi             = state.vPQRi;
+  VState.vInertialPosition = state.vInertialPosition;
+  VState.vInertialVelocity = state.vInertialVelocity;
+
+  UpdateDerivedState();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropagate::RestoreSnapshot(const Snapshot& snapshot)
+{
+  VState = snapshot.VState;
+  in = snapshot.in;
+  epa = snapshot.epa;
+
+  UpdateDerivedState();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -331,29 +564,62 @@ void FGPropagate::CalculateUVW(void)
   VState.vUVW = Ti2b * (VState.vInertialVelocity - (in.vOmegaPlanet * VState.vInertialPosition));
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Coefficients of the multistep integrators indexed by eIntegrateType. The
+// increment is scale*dt*sum(c[i]*ValDot[i]) where ValDot[0] is the most recent
+// derivative. The coefficients are those of the explicit formulas that were
+// previously written for each integrator so that the results are unchanged.
+
+namespace {
+  struct MultistepScheme {
+    unsigned int steps;
+    double scale;
+    double c[5];
+  };
+
+  const MultistepScheme MultistepSchemes[] = {
+    {0, 0.0, {}},                                  // eNone
+    {1, 1.0, {1.0}},                               // eRectEuler
+    {2, 0.5, {1.0, 1.0}},                          // eTrapezoidal
+    {2, 1.0, {1.5, -0.5}},                         // eAdamsBashforth2
+    {3, 1/12.0, {23.0, -16.0, 5.0}},               // eAdamsBashforth3
+    {4, 1/24.0, {55.0, -59.0, 37.0, -9.0}},        // eAdamsBashforth4
+    {0, 0.0, {}},                                  // eBuss1
+    {0, 0.0, {}},                                  // eBuss2
+    {0, 0.0, {}},                                  // eLocalLinearization
+    {5, 1.0, {1901./720., -1387./360., 109./30., -637./360., 251./720.}} // eAdamsBashforth5
+  };
+
+  template <class T, unsigned int N>
+  void IntegrateMultistep(T& Integrand, const FGRingBuffer<T, N>& ValDot,
+                          double dt, const MultistepScheme& scheme)
+  {
+    T sum = scheme.c[0]*ValDot[0];
+    for (unsigned int i=1; i<scheme.steps; ++i)
+      sum += scheme.c[i]*ValDot[i];
+
+    Integrand += scheme.scale*dt*sum;
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGPropagate::Integrate( FGColumnVector3& Integrand,
                              FGColumnVector3& Val,
-                             deque <FGColumnVector3>& ValDot,
+                             FGRingBuffer<FGColumnVector3, 5>& ValDot,
                              double dt,
                              eIntegrateType integration_type)
 {
-  ValDot.push_front(Val);
-  ValDot.pop_back();
+  ValDot.Push(Val);
 
   switch(integration_type) {
-  case eRectEuler:       Integrand += dt*ValDot[0];
-    break;
-  case eTrapezoidal:     Integrand += 0.5*dt*(ValDot[0] + ValDot[1]);
-    break;
-  case eAdamsBashforth2: Integrand += dt*(1.5*ValDot[0] - 0.5*ValDot[1]);
-    break;
-  case eAdamsBashforth3: Integrand += (1/12.0)*dt*(23.0*ValDot[0] - 16.0*ValDot[1] + 5.0*ValDot[2]);
-    break;
-  case eAdamsBashforth4: Integrand += (1/24.0)*dt*(55.0*ValDot[0] - 59.0*ValDot[1] + 37.0*ValDot[2] - 9.0*ValDot[3]);
-    break;
-  case eAdamsBashforth5: Integrand += dt*((1901./720.)*ValDot[0] - (1387./360.)*ValDot[1] + (109./30.)*ValDot[2] - (637./360.)*ValDot[3] + (251./720.)*ValDot[4]);
+  case eRectEuler:
+  case eTrapezoidal:
+  case eAdamsBashforth2:
+  case eAdamsBashforth3:
+  case eAdamsBashforth4:
+  case eAdamsBashforth5:
+    IntegrateMultistep(Integrand, ValDot, dt, MultistepSchemes[integration_type]);
     break;
   case eNone: // do nothing, freeze translational rate
     break;
@@ -374,25 +640,20 @@ void FGPropagate::Integrate( FGColumnVector3& Integrand,
 
 void FGPropagate::Integrate( FGQuaternion& Integrand,
                              FGQuaternion& Val,
-                             deque <FGQuaternion>& ValDot,
+                             FGRingBuffer<FGQuaternion, 5>& ValDot,
                              double dt,
                              eIntegrateType integration_type)
 {
-  ValDot.push_front(Val);
-  ValDot.pop_back();
+  ValDot.Push(Val);
 
   switch(integration_type) {
-  case eRectEuler:       Integrand += dt*ValDot[0];
-    break;
-  case eTrapezoidal:     Integrand += 0.5*dt*(ValDot[0] + ValDot[1]);
-    break;
-  case eAdamsBashforth2: Integrand += dt*(1.5*ValDot[0] - 0.5*ValDot[1]);
-    break;
-  case eAdamsBashforth3: Integrand += (1/12.0)*dt*(23.0*ValDot[0] - 16.0*ValDot[1] + 5.0*ValDot[2]);
-    break;
-  case eAdamsBashforth4: Integrand += (1/24.0)*dt*(55.0*ValDot[0] - 59.0*ValDot[1] + 37.0*ValDot[2] - 9.0*ValDot[3]);
-    break;
-  case eAdamsBashforth5: Integrand += dt*((1901./720.)*ValDot[0] - (1387./360.)*ValDot[1] + (109./30.)*ValDot[2] - (637./360.)*ValDot[3] + (251./720.)*ValDot[4]);
+  case eRectEuler:
+  case eTrapezoidal:
+  case eAdamsBashforth2:
+  case eAdamsBashforth3:
+  case eAdamsBashforth4:
+  case eAdamsBashforth5:
+    IntegrateMultistep(Integrand, ValDot, dt, MultistepSchemes[integration_type]);
     break;
   case eBuss1:
     {
@@ -741,6 +1002,23 @@ void FGPropagate::DumpState(void)
 
 //******************************************************************************
 
+void FGPropagate::SetRungeKutta(int type)
+{
+  switch (type) {
+  case eRKNone:
+  case eRK4:
+  case eRKF45:
+    integrator_runge_kutta = static_cast<eRungeKuttaType>(type);
+    break;
+  default:
+    FGLogging log(FDMExec->GetLogger(), LogLevel::ERROR);
+    log << "Unknown Runge-Kutta scheme " << type
+        << " for simulation/integrator/runge-kutta. The value must be 0, 4 or 45.\n";
+  }
+}
+
+//******************************************************************************
+
 void FGPropagate::WriteStateFile(int num)
 {
   sg_ofstream outfile;
@@ -912,6 +1190,8 @@ void FGPropagate::bind(void)
   PropertyManager->Tie("simulation/integrator/rate/translational", (int*)&integrator_translational_rate);
   PropertyManager->Tie("simulation/integrator/position/rotational", (int*)&integrator_rotational_position);
   PropertyManager->Tie("simulation/integrator/position/translational", (int*)&integrator_translational_position);
+  PropertyManager->Tie("simulation/integrator/runge-kutta", this,
+                       &FGPropagate::GetRungeKutta, &FGPropagate::SetRungeKutta);
 
   PropertyManager->Tie<FGPropagate, int>("simulation/write-state-file", this,
                                          nullptr, &FGPropagate::WriteStateFile);
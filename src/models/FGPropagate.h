@@ -43,6 +43,7 @@ INCLUDES
 #include "models/FGModel.h"
 #include "math/FGLocation.h"
 #include "math/FGQuaternion.h"
+#include "math/FGRingBuffer.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -85,6 +86,38 @@ CLASS DOCUMENTATION
     5: Adams Bashforth 4
     @endcode
 
+    Alternatively, the whole vehicle state can be integrated with a multi-stage
+    Runge-Kutta scheme. The scheme is selected with the property
+
+    @code
+    simulation/integrator/runge-kutta
+    @endcode
+
+    which can be set to one of the following values:
+
+    @code
+    0: Disabled, the four integrators above are used (default)
+    4: Classical Runge-Kutta 4
+    45: Runge-Kutta-Fehlberg 4(5)
+    @endcode
+
+    Any other value is rejected with an error message and the scheme in use is
+    kept.
+
+    When the executive runs with an adaptive time step (see
+    FGFDMExec::AdaptiveTimeStep()), the Runge-Kutta-Fehlberg scheme is used
+    whatever the integrators selected above. A step whose error estimate
+    exceeds the tolerance is rejected and integrated again with a shorter time
+    step, and the time step of the next frame is proposed from the error of
+    the step that has been taken.
+
+    The forces and moments are then re-evaluated at each intermediate stage of
+    the scheme by FGFDMExec::RunIntermediateStage(). The flight control system,
+    the propulsion, the winds and the gas cells are not run at the intermediate
+    stages: their outputs are held over the time step. The Runge-Kutta-Fehlberg
+    scheme propagates the 4th order solution and estimates its error with the
+    embedded 5th order solution.
+
     @author Jon S. Berndt, Mathias Froehlich, Bertrand Coconnier
   */
 
@@ -132,10 +165,12 @@ public:
 
     FGColumnVector3 vInertialPosition;
 
-    std::deque <FGColumnVector3> dqPQRidot;
-    std::deque <FGColumnVector3> dqUVWidot;
-    std::deque <FGColumnVector3> dqInertialVelocity;
-    std::deque <FGQuaternion>    dqQtrndot;
+    /** Past values of the derivatives used by the multistep integrators,
+        from the most recent to the oldest. */
+    FGRingBuffer<FGColumnVector3, 5> dqPQRidot;
+    FGRingBuffer<FGColumnVector3, 5> dqUVWidot;
+    FGRingBuffer<FGColumnVector3, 5> dqInertialVelocity;
+    FGRingBuffer<FGQuaternion, 5>    dqQtrndot;
   };
 
   /** Constructor.
@@ -155,6 +190,9 @@ public:
   enum eIntegrateType {eNone = 0, eRectEuler, eTrapezoidal, eAdamsBashforth2,
                        eAdamsBashforth3, eAdamsBashforth4, eBuss1, eBuss2, eLocalLinearization, eAdamsBashforth5};
 
+  /// These define the values used to select a whole state Runge-Kutta scheme.
+  enum eRungeKuttaType {eRKNone = 0, eRK4 = 4, eRKF45 = 45};
+
   /** Initializes the FGPropagate class after instantiation and prior to first execution.
       The base class FGModel::InitModel is called first, initializing pointers to the
       other FGModel objects (and others).  */
@@ -425,6 +463,17 @@ public:
       */
   double GetLocalTerrainRadius(void) const;
 
+  /** Returns the time step over which the state has been integrated by the
+      last frame when the time step is adaptive.
+      @return time step in seconds */
+  double GetStepTaken(void) const { return step_taken; }
+
+  /** Returns the time step proposed by the error control for the next frame
+      when the time step is adaptive. Otherwise, returns the step of the last
+      frame.
+      @return time step in seconds */
+  double GetProposedStep(void) const { return step_proposed; }
+
   /** Returns the Earth position angle.
       @return Earth position angle in radians.
    */
@@ -615,14 +664,44 @@ public:
     double SemiMinor;
     double GM; // Gravitational parameter
     double DeltaT;
+    double DeltaTMin;
+    double Tolerance; // Tolerance of the adaptive time step (0 if disabled)
   } in;
 
+  /** The state from which a time step is integrated. The executive saves it
+      to integrate a time step again over a shorter duration when an event
+      has been located within the time step. */
+  struct Snapshot {
+    VehicleState VState;
+    Inputs in;
+    double epa;
+  };
+
+  /// Returns the state from which the next time step will be integrated.
+  Snapshot GetSnapshot(void) const { return {VState, in, epa}; }
+
+  /** Restores a state returned by GetSnapshot().
+      @param snapshot the state to restore */
+  void RestoreSnapshot(const Snapshot& snapshot);
+
 private:
 
 // state vector
 
   struct VehicleState VState;
 
+  /** The integrated part of the vehicle state, or its time derivative, as
+      handled by the Runge-Kutta schemes. */
+  struct StateVector {
+    FGQuaternion    qAttitudeECI;
+    FGColumnVector3 vPQRi;
+    FGColumnVector3 vInertialPosition;
+    FGColumnVector3 vInertialVelocity;
+  };
+
+  /// Error estimate of the last step made with an embedded Runge-Kutta scheme.
+  StateVector StateError;
+
   std::shared_ptr<FGInertial> Inertial;
   FGColumnVector3 vVel;
   FGMatrix33 Tec2b;
@@ -658,6 +737,7 @@ private:
   eIntegrateType integrator_translational_rate;
   eIntegrateType integrator_rotational_position;
   eIntegrateType integrator_translational_position;
+  eRungeKuttaType integrator_runge_kutta;
 
   void CalculateInertialVelocity(void);
   void CalculateUVW(void);
@@ -665,21 +745,37 @@ private:
 
   void Integrate( FGColumnVector3& Integrand,
                   FGColumnVector3& Val,
-                  std::deque <FGColumnVector3>& ValDot,
+                  FGRingBuffer<FGColumnVector3, 5>& ValDot,
                   double dt,
                   eIntegrateType integration_type);
 
   void Integrate( FGQuaternion& Integrand,
                   FGQuaternion& Val,
-                  std::deque <FGQuaternion>& ValDot,
+                  FGRingBuffer<FGQuaternion, 5>& ValDot,
                   double dt,
                   eIntegrateType integration_type);
 
+  double step_taken;    // Time step taken by the last adaptive integration
+  double step_proposed; // Time step proposed for the next adaptive integration
+  bool stale_histories; // The past value histories lag behind the state
+
+  void IntegrateRungeKutta(double dt, eRungeKuttaType type,
+                           const StateVector& X0, const StateVector& K0);
+  double IntegrateAdaptive(double dt);
+  double GetErrorRatio(const StateVector& X0) const;
+  StateVector GetIntegratedState(void) const;
+  StateVector GetStateDerivative(void) const;
+  void SetIntegratedState(const StateVector& state);
+
   void UpdateLocationMatrices(void);
+  void UpdateEarthPositionMatrices(void);
+  void UpdateDerivedState(void);
   void UpdateBodyMatrices(void);
   void UpdateVehicleState(void);
   void ComputeOrbitalParameters(void);
 
+  int GetRungeKutta(void) const { return integrator_runge_kutta; }
+  void SetRungeKutta(int type);
   void WriteStateFile(int num);
   void bind(void);
   void Debug(int from);
@@ -266,9 +266,6 @@ void FGPropulsion::ConsumeFuel(FGEngine* engine)
 
 bool FGPropulsion::GetSteadyState(void)
 {
-  double currentThrust = 0, lastThrust = -1;
-  int steady_count = 0, j = 0;
-  bool steady = false;
   bool TrimMode = FDMExec->GetTrimStatus();
   double TimeStep = FDMExec->GetDeltaT();
 
@@ -277,28 +274,13 @@ bool FGPropulsion::GetSteadyState(void)
 
   if (!FGModel::Run(false)) {
     FDMExec->SetTrimStatus(true);
-    // This is a time marching algorithm so it needs a non-zero time step to
-    // reach a steady state.
+    // The engines that cannot compute their steady state directly are time
+    // marched so a non-zero time step is needed to reach a steady state.
     in.TotalDeltaT = 0.5;
 
     for (auto& engine: Engines) {
-      steady=false;
-      steady_count=0;
-      j=0;
-      while (!steady && j < 6000) {
-        engine->Calculate();
-        lastThrust = currentThrust;
-        currentThrust = engine->GetThrust();
-        if (fabs(lastThrust-currentThrust) < 0.0001) {
-          steady_count++;
-          if (steady_count > 120) {
-            steady=true;
-          }
-        } else {
-          steady_count=0;
-        }
-        j++;
-      }
+      if (!engine->CalculateSteadyState())
+        MarchToSteadyState(engine.get());
       vForces  += engine->GetBodyForces();  // sum body frame forces
       vMoments += engine->GetMoments();     // sum body frame moments
     }
@@ -312,6 +294,32 @@ bool FGPropulsion::GetSteadyState(void)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The piston, turboprop, electric and rocket engines are plainly time marched.
+// The rocket engines are steady after the minimum number of iterations. The
+// marches that run out of iterations are limit cycles of the explicit RPM and
+// propeller governor updates at this large time step: a secant on the
+// propeller RPM bounded by the idle and maximum RPM does not converge them
+// either, so no acceleration is attempted.
+
+void FGPropulsion::MarchToSteadyState(FGEngine* engine)
+{
+  double currentThrust = 0, lastThrust = -1;
+  int steady_count = 0;
+
+  for (int j=0; j < 6000; j++) {
+    engine->Calculate();
+    lastThrust = currentThrust;
+    currentThrust = engine->GetThrust();
+    if (fabs(lastThrust-currentThrust) < 0.0001) {
+      steady_count++;
+      if (steady_count > 120) break;
+    } else {
+      steady_count=0;
+    }
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGPropulsion::InitRunning(int n)
@@ -467,8 +475,19 @@ bool FGPropulsion::Load(Element* el)
 
 SGPath FGPropulsion::FindFullPathName(const SGPath& path) const
 {
-  SGPath name = FGModel::FindFullPathName(path);
-  if (!ReadingEngine && !name.isNull()) return name;
+  if (!ReadingEngine) {
+    SGPath name = FGModel::FindFullPathName(path);
+    if (!name.isNull()) return name;
+  }
+
+  return FindEngineFullPathName(path);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+SGPath FGPropulsion::FindEngineFullPathName(const SGPath& path) const
+{
+  SGPath name;
 
 #ifdef _WIN32
   // Singular and plural are allowed for the folder names for consistency with
@@ -146,7 +146,9 @@ public:
     return Tanks[index];
   }
 
-  /** Loops the engines until thrust output steady (used for trimming) */
+  /** Brings the engines to their steady state (used for trimming). The
+      engines that cannot compute their equilibrium directly are looped until
+      their thrust output is steady. */
   bool GetSteadyState(void);
 
   /** Sets up the engines as running */
@@ -170,6 +172,11 @@ public:
   double GetTanksWeight(void) const;
 
   SGPath FindFullPathName(const SGPath& path) const override;
+  /** Returns the full path name of an engine or a thruster file. The file is
+      searched in the engine folders of the aircraft then in the engine path.
+      @param path the name of the file
+      @return the full path name or an empty path if the file is not found. */
+  SGPath FindEngineFullPathName(const SGPath& path) const;
   inline int GetActiveEngine(void) const {return ActiveEngine;}
   inline bool GetFuelFreeze(void) const {return FuelFreeze;}
 
@@ -201,6 +208,7 @@ private:
   double DumpRate;
   double RefuelRate;
   void ConsumeFuel(FGEngine* engine);
+  void MarchToSteadyState(FGEngine* engine);
 
   bool ReadingEngine;
 
@@ -96,6 +96,10 @@ public:
   std::string GetType(void) const { return Type; }
   virtual double GetOutputPct(void) const { return 0; }
   virtual void ResetPastStates(void);
+  /** Sets the time step with which the component is run. Components that
+      precompute coefficients from the time step must update them here.
+      @param delta_t the time step in seconds */
+  virtual void SetDt(double delta_t) { dt = delta_t; }
 
 protected:
   FGFCS* fcs;
@@ -92,6 +92,15 @@ void FGFilter::ResetPastStates(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFilter::SetDt(double delta_t)
+{
+  FGFCSComponent::SetDt(delta_t);
+
+  CalculateDynamicFilters();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFilter::ReadFilterCoefficients(Element* element, int index,
                                       std::shared_ptr<FGPropertyManager> PropertyManager)
 {
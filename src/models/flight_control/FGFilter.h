@@ -221,6 +221,7 @@ public:
   bool Run (void) override;
 
   void ResetPastStates(void) override;
+  void SetDt(double delta_t) override;
 
 private:
   bool DynamicFilter;
@@ -160,6 +160,19 @@ FGLinearActuator::~FGLinearActuator()
 
 // %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGLinearActuator::SetDt(double delta_t)
+{
+  FGFCSComponent::SetDt(delta_t);
+
+  if (lag > 0.0) {
+    double denom = 2.00 + dt*lag;
+    ca = dt * lag / denom;
+    cb = (2.00 - dt * lag) / denom;
+  }
+}
+
+// %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGLinearActuator::Run(void )
 {
   if (ptrSet && !ptrSet->IsConstant()) set = ptrSet->GetValue() >= 0.5;
@@ -143,6 +143,19 @@ void FGSensor::ResetPastStates(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGSensor::SetDt(double delta_t)
+{
+  FGFCSComponent::SetDt(delta_t);
+
+  if (lag != 0.0) {
+    double denom = 2.00 + dt*lag;
+    ca = dt*lag / denom;
+    cb = (2.00 - dt*lag) / denom;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGSensor::Run(void)
 {
   Input = InputNodes[0]->getDoubleValue();
@@ -150,6 +150,7 @@ public:
 
   bool Run (void) override;
   void ResetPastStates(void) override;
+  void SetDt(double delta_t) override;
 
 protected:
   enum eNoiseType {ePercent=0, eAbsolute} NoiseType;
@@ -170,6 +170,13 @@ public:
   /** Calculates the thrust of the engine, and other engine functions. */
   virtual void Calculate(void) = 0;
 
+  /** Brings the engine directly to its steady state for the current inputs.
+      Engines that cannot compute their equilibrium directly return false and
+      are time marched by FGPropulsion::GetSteadyState() instead. Only the
+      turbine engines override it.
+      @return true if the steady state has been computed. */
+  virtual bool CalculateSteadyState(void) { return false; }
+
   virtual double GetThrust(void) const;
     
   /** The fuel need is calculated based on power levels and flow rate for that
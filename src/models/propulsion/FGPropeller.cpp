@@ -217,7 +217,7 @@ double FGPropeller::Calculate(double EnginePower)
   // Simualtion (3rd edition)" eqn 8.2-1
   // Variables in.AeroUVW and in.AeroPQR include the wind and turbulence effects
   // as computed by FGAuxiliary.
-  FGColumnVector3 localAeroVel = mT.Transposed() * (in.AeroUVW + in.AeroPQR*vDXYZ);
+  FGColumnVector3 localAeroVel = mT.TransposedMultiply(in.AeroUVW + in.AeroPQR*vDXYZ);
   double omega, PowerAvailable;
 
   double Vel = localAeroVel(eU);
@@ -79,6 +79,7 @@ FGTurbine::FGTurbine(FGFDMExec* exec, Element *el, int engine_number, struct Inp
   EPR = 1.0;
   disableWindmill = false;
   ThrottlePos = 0.0;
+  SteadyState = false;
 
   Load(exec, el);
   Debug(0);
@@ -172,6 +173,27 @@ void FGTurbine::Calculate(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGTurbine::CalculateSteadyState(void)
+{
+  if (Thruster->GetType() != FGThruster::ttNozzle &&
+      Thruster->GetType() != FGThruster::ttDirect)
+    return false;
+
+  // The phase functions may hand over to another phase (e.g. start to run) in
+  // which case the engine is stepped again until the phase no longer changes.
+  SteadyState = true;
+  for (int i=0; i <= tpTrim; i++) {
+    phaseType previous = phase;
+    Calculate();
+    if (phase == previous) break;
+  }
+  SteadyState = false;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 double FGTurbine::Off(void)
 {
   Running = false;
@@ -402,7 +424,10 @@ double FGTurbine::GetPowerAvailable(void) const {
 
 double FGTurbine::Seek(double *var, double target, double accel, double decel) {
   double v = *var;
-  if (v > target) {
+  if (SteadyState) {
+    // The target is reached unless the rate towards it is zero.
+    if ((v > target && decel > 0.0) || (v < target && accel > 0.0)) v = target;
+  } else if (v > target) {
     v -= in.TotalDeltaT * decel;
     if (v < target) v = target;
   } else if (v < target) {
@@ -182,6 +182,12 @@ public:
   enum phaseType { tpOff, tpRun, tpSpinUp, tpStart, tpStall, tpSeize, tpTrim };
 
   void Calculate(void);
+  /** Computes the steady state of an engine that drives a nozzle or a direct
+      thruster. The spools, the fuel flow and the temperatures seek their
+      targets at constant rates, so their equilibrium is reached in a single
+      step of infinite duration.
+      @return false if the thruster has its own dynamics (propeller, rotor). */
+  bool CalculateSteadyState(void) override;
   double CalcFuelNeed(void);
   double GetPowerAvailable(void) const;
   /** A lag filter.
@@ -296,6 +302,7 @@ private:
   double InjWaterNorm;
   double InjN1increment;
   double InjN2increment;
+  bool SteadyState;        ///< true while Seek() jumps to its targets
 
   double Off(void);
   double Run();
@@ -121,5 +121,41 @@ class CheckTrim(JSBSimTestCase):
             if fdm['simulation/trim-completed'] == 1:
                 break
 
+    def test_levenberg_marquardt_solver(self):
+        # Check that both solvers find the same trim.
+        def trim(model, altitude, speed, solver, aero_partials=False):
+            fdm = self.create_fdm()
+            fdm.load_model(model)
+            fdm['ic/h-sl-ft'] = altitude
+            fdm['ic/vc-kts'] = speed
+            fdm['ic/gamma-deg'] = 0.0
+            fdm['propulsion/set-running'] = -1
+            fdm.run_ic()
+            fdm['simulation/trim-solver'] = solver
+            fdm['simulation/trim-aero-partials'] = aero_partials
+            fdm['simulation/do_simple_trim'] = 1
+            return fdm
+
+        for model, altitude, speed in (('c172x', 4000., 100.),
+                                       ('A320', 20000., 280.)):
+            ref = trim(model, altitude, speed, 0)
+            for aero_partials in (False, True):
+                fdm = trim(model, altitude, speed, 1, aero_partials)
+                self.assertAlmostEqual(fdm['aero/alpha-deg'],
+                                       ref['aero/alpha-deg'], delta=0.01)
+                self.assertAlmostEqual(fdm['fcs/throttle-cmd-norm'],
+                                       ref['fcs/throttle-cmd-norm'], delta=0.01)
+                self.assertAlmostEqual(fdm['accelerations/udot-ft_sec2'], 0.0,
+                                       delta=0.01)
+                self.assertAlmostEqual(fdm['accelerations/wdot-ft_sec2'], 0.0,
+                                       delta=0.01)
+
+        fdm = self.create_fdm()
+        fdm.load_model('c172x')
+        fdm.run_ic()
+        fdm['simulation/trim-solver'] = 2
+        with self.assertRaises(TrimFailureError):
+            fdm['simulation/do_simple_trim'] = 1
+
 
 RunTest(CheckTrim)
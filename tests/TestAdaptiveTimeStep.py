@@ -0,0 +1,127 @@
+# TestAdaptiveTimeStep.py
+#
+# Regression tests of the adaptive time step of the executive.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import math
+import pandas as pd
+from JSBSim_utils import JSBSimTestCase, CreateFDM, RunTest, FlightModel
+
+
+class TestAdaptiveTimeStep(JSBSimTestCase):
+    def orbit(self, dt):
+        fdm = CreateFDM(self.sandbox)
+        fdm.load_model('ball')
+        fdm.load_ic('reset00_v2', True)
+        fdm.set_dt(dt)
+        fdm['simulation/gravity-model'] = 1
+        fdm.run_ic()
+        return fdm
+
+    def test_orbit(self):
+        duration = 1800.0
+
+        fdm = self.orbit(0.05)
+        fdm['simulation/integrator/runge-kutta'] = 45
+        for _ in range(int(round(duration/0.05))):
+            fdm.run()
+        ref = [fdm['position/eci-{}-ft'.format(axis)] for axis in 'xyz']
+
+        fdm = self.orbit(0.01)
+        fdm['simulation/adaptive-dt/enabled'] = 1
+        fdm['simulation/adaptive-dt/max-sec'] = 60.0
+        fdm['simulation/adaptive-dt/tolerance'] = 1E-10
+        frames = 0
+        while fdm.get_sim_time() < duration - 1E-9:
+            # Shorten the last step to end exactly at the requested time
+            remaining = duration - fdm.get_sim_time()
+            if fdm['simulation/dt'] > remaining:
+                fdm.set_dt(remaining)
+            fdm.run()
+            frames += 1
+
+        self.assertAlmostEqual(fdm.get_sim_time(), duration, delta=1E-6)
+        pos = [fdm['position/eci-{}-ft'.format(axis)] for axis in 'xyz']
+        self.assertLess(math.dist(pos, ref), 1.0)
+        # The fixed step integration needs 36000 frames.
+        self.assertLess(frames, 200)
+
+    def test_disable(self):
+        fdm = self.orbit(0.01)
+        fdm['simulation/adaptive-dt/enabled'] = 1
+        fdm['simulation/adaptive-dt/max-sec'] = 10.0
+        for _ in range(20):
+            fdm.run()
+        self.assertGreater(fdm['simulation/dt'], 0.01)
+
+        # The nominal time step is restored when the adaptive mode is
+        # disabled.
+        fdm['simulation/adaptive-dt/enabled'] = 0
+        t = fdm.get_sim_time()
+        fdm.run()
+        self.assertAlmostEqual(fdm['simulation/dt'], 0.01)
+        self.assertAlmostEqual(fdm.get_sim_time(), t + 0.01)
+
+        # The adaptive mode starts again from the nominal time step.
+        fdm['simulation/adaptive-dt/enabled'] = 1
+        fdm.run()
+        self.assertGreater(fdm['simulation/dt'], 0.01)
+
+    def test_filter_time_constant(self):
+        tripod = FlightModel(self, 'tripod')
+        tripod.include_system_test_file('filter.xml')
+        fdm = tripod.start()
+        fdm['simulation/adaptive-dt/enabled'] = 1
+        fdm['simulation/adaptive-dt/max-sec'] = 0.1
+
+        steps = set()
+        while fdm.get_sim_time() < 2.0:
+            fdm.run()
+            steps.add(round(fdm['simulation/dt'], 6))
+
+        # The filter must be run with the time steps actually taken.
+        self.assertGreater(len(steps), 1)
+        t = fdm.get_sim_time()
+        self.assertAlmostEqual(fdm['test/lag-value'], 1.0-math.exp(-2.0*t),
+                               delta=1E-2)
+
+    def test_output_rate(self):
+        with open('adaptive_output.xml', 'w') as f:
+            f.write('<output name="adaptive.csv" type="CSV" rate="1">'
+                    '<simulation>ON</simulation></output>')
+
+        fdm = self.orbit(0.01)
+        fdm.set_output_directive('adaptive_output.xml')
+        fdm['simulation/adaptive-dt/enabled'] = 1
+        fdm['simulation/adaptive-dt/max-sec'] = 0.3
+        fdm.run_ic()
+        self.assertAlmostEqual(fdm['simulation/output/log_rate_hz'], 1.0)
+
+        while fdm.get_sim_time() < 20.0:
+            fdm.run()
+
+        del fdm
+        times = pd.read_csv('adaptive.csv')['Time'].values
+        self.assertEqual(len(times), 21)
+        # The output is written by the first frame that reaches each second.
+        for i, t in enumerate(times[1:], 1):
+            self.assertGreaterEqual(t, i - 1E-6)
+            self.assertLess(t, i + 0.3)
+
+
+RunTest(TestAdaptiveTimeStep)
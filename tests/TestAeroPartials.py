@@ -0,0 +1,155 @@
+# TestAeroPartials.py
+#
+# Check the analytical derivatives of the aerodynamic forces and moments
+# against finite differences.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import math
+import os
+import xml.etree.ElementTree as et
+
+import numpy as np
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+import jsbsim
+
+forces = ['forces/fbx-aero-lbs', 'forces/fby-aero-lbs', 'forces/fbz-aero-lbs']
+moments = ['moments/l-aero-lbsft', 'moments/m-aero-lbsft',
+           'moments/n-aero-lbsft']
+
+
+class TestAeroPartials(JSBSimTestCase):
+    def initialize(self, model, alpha):
+        fdm = self.create_fdm()
+        fdm.load_model(model)
+        fdm['ic/h-sl-ft'] = 3000.
+        fdm['ic/vt-kts'] = 100.
+        fdm['ic/alpha-deg'] = alpha
+        fdm['ic/beta-deg'] = 2.0
+        fdm.run_ic()
+        return fdm
+
+    def test_alpha(self):
+        alpha = 4.3
+        h = 1E-4
+        fdm = self.initialize('c172x', alpha)
+        fdm_plus = self.initialize('c172x', alpha+h)
+        fdm_minus = self.initialize('c172x', alpha-h)
+        dalpha = 2.0*h*math.pi/180.
+
+        def derivative(name):
+            return (fdm_plus[name]-fdm_minus[name])/dalpha
+
+        # The properties that are computed by the C++ code are seeded with
+        # their derivatives with respect to alpha.
+        seeds = {name: derivative(name) for name in ['aero/alphadot-rad_sec',
+                                                     'aero/h_b-mac-ft',
+                                                     'aero/qbar-area']}
+        seeds['aero/alpha-rad'] = 1.0
+        seeds['aero/alpha-deg'] = 180./math.pi
+        dF, dM = fdm.get_aerodynamics().get_partials(seeds)
+
+        for i, name in enumerate(forces):
+            self.assertAlmostEqual(dF[i, 0]/derivative(name), 1.0, delta=1E-6)
+        for i, name in enumerate(moments):
+            self.assertAlmostEqual(dM[i, 0]/derivative(name), 1.0, delta=1E-6)
+
+    def test_qbar(self):
+        # The aerodynamic forces and moments of the 737 are proportional to
+        # qbar.
+        fdm = self.initialize('737', 2.0)
+        qbar = fdm['aero/qbar-psf']
+        dF, dM = fdm.get_aerodynamics().get_partials({'aero/qbar-psf': 1.0})
+
+        for i, name in enumerate(forces):
+            self.assertAlmostEqual(dF[i, 0]*qbar/fdm[name], 1.0, delta=1E-9)
+        for i, name in enumerate(moments):
+            self.assertAlmostEqual(dM[i, 0]*qbar/fdm[name], 1.0, delta=1E-9)
+
+        # The aircraft is not modified
+        self.assertEqual(fdm['aero/qbar-psf'], qbar)
+
+        # No variable
+        dF, dM = fdm.get_aerodynamics().get_partials({})
+        np.testing.assert_array_equal(dF, np.zeros((3, 1)))
+        np.testing.assert_array_equal(dM, np.zeros((3, 1)))
+
+    def test_unknown_property(self):
+        fdm = self.initialize('c172x', 0.0)
+        with self.assertRaises(jsbsim.BaseError):
+            fdm.get_aerodynamics().get_partials({'aero/no-such-property': 1.0})
+
+    def test_linearize(self):
+        # The inputs of the A320 aerodynamics are linear in alpha so their
+        # first order expansion is exactly linear in alpha.
+        alpha = 4.3
+        fdm = self.initialize('A320', alpha)
+        aero = fdm.get_aerodynamics()
+        F0 = aero.get_forces()
+        self.assertTrue(aero.linearize())
+        self.assertTrue(aero.is_linearized())
+
+        def aero_forces(a):
+            fdm['ic/alpha-deg'] = a
+            fdm.run_ic()
+            return aero.get_forces()
+
+        Fp = aero_forces(alpha+1.0)
+        Fm = aero_forces(alpha-1.0)
+        np.testing.assert_allclose(Fp+Fm-2.0*F0, np.zeros((3, 1)),
+                                   atol=1E-9*np.max(np.abs(F0)))
+
+        # The slope is the derivative of the aerodynamics
+        h = 1E-4
+        fdm_plus = self.initialize('A320', alpha+h)
+        fdm_minus = self.initialize('A320', alpha-h)
+        for i, name in enumerate(forces):
+            derivative = (fdm_plus[name]-fdm_minus[name])/(2.0*h)
+            self.assertAlmostEqual((Fp[i, 0]-Fm[i, 0])/2.0/derivative, 1.0,
+                                   delta=1E-6)
+
+        # The actual aerodynamics are not linear.
+        aero.clear_linearization()
+        self.assertFalse(aero.is_linearized())
+        Fp = aero_forces(alpha+1.0)
+        Fm = aero_forces(alpha-1.0)
+        self.assertGreater(np.max(np.abs(Fp+Fm-2.0*F0)),
+                           1E-3*np.max(np.abs(F0)))
+
+    def test_linearize_fallback(self):
+        # The aerodynamics are left unchanged when a function cannot be
+        # differentiated.
+        tree = et.parse(self.sandbox.path_to_jsbsim_file('aircraft', 'A320',
+                                                         'A320.xml'))
+        drag = tree.getroot().find('aerodynamics/axis[@name="DRAG"]')
+        noise = et.SubElement(drag, 'function', name='aero/force/noise')
+        product = et.SubElement(noise, 'product')
+        et.SubElement(product, 'value').text = '0.0'
+        et.SubElement(product, 'urandom')
+        os.makedirs(self.sandbox('aircraft', 'A320'))
+        tree.write(self.sandbox('aircraft', 'A320', 'A320.xml'))
+
+        fdm = self.create_fdm()
+        fdm.set_aircraft_path('aircraft')
+        fdm.load_model('A320')
+        fdm.run_ic()
+        aero = fdm.get_aerodynamics()
+        self.assertFalse(aero.linearize())
+        self.assertFalse(aero.is_linearized())
+
+RunTest(TestAeroPartials)
@@ -0,0 +1,62 @@
+# TestEngineSteadyState.py
+#
+# Check that the engines are brought to their steady state by the trim.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+
+class TestEngineSteadyState(JSBSimTestCase):
+    def trim(self, model, speed):
+        fdm = self.create_fdm()
+        fdm.load_model(model)
+        fdm['ic/h-sl-ft'] = 3000.
+        fdm['ic/vc-kts'] = speed
+        fdm['ic/gamma-deg'] = 0.0
+        fdm.run_ic()
+        fdm['propulsion/set-running'] = -1
+        fdm['simulation/do_simple_trim'] = 1
+        return fdm
+
+    def test_turbine(self):
+        # The spools of the CFM56 engines are computed directly at their
+        # target speeds (see engine/CFM56.xml for the idle and max N1, N2).
+        fdm = self.trim('737', 250.)
+
+        for i in range(2):
+            engine = 'propulsion/engine[{}]/'.format(i)
+            throttle = fdm['fcs/throttle-pos-norm[{}]'.format(i)]
+            N1 = fdm[engine+'n1']
+            N2 = fdm[engine+'n2']
+            self.assertAlmostEqual(N1, 30.0+throttle*70.0, delta=1E-9)
+            self.assertAlmostEqual(N2, 60.0+throttle*40.0, delta=1E-9)
+
+            fdm.run()
+            self.assertEqual(fdm[engine+'n1'], N1)
+            self.assertEqual(fdm[engine+'n2'], N2)
+
+    def test_propeller(self):
+        # The propeller is time marched to the equilibrium of its torque.
+        fdm = self.trim('c172x', 100.)
+        RPM = fdm['propulsion/engine/propeller-rpm']
+        fdm.run()
+        self.assertAlmostEqual(fdm['propulsion/engine/propeller-rpm'], RPM,
+                               delta=1E-6)
+
+
+RunTest(TestEngineSteadyState)
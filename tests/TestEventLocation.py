@@ -0,0 +1,105 @@
+# TestEventLocation.py
+#
+# Regression tests of the location of the events within a frame.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+
+class TestEventLocation(JSBSimTestCase):
+    def drop(self, dt, locate):
+        # Drop the aircraft from a few feet and stop at the touch down.
+        fdm = self.create_fdm()
+        fdm.load_model('c172x')
+        fdm['ic/h-agl-ft'] = 5.0
+        fdm['ic/vc-kts'] = 0.0
+        fdm['ic/theta-deg'] = 0.0
+        fdm.set_dt(dt)
+        fdm.run_ic()
+        fdm['simulation/event-location/enabled'] = locate
+
+        while fdm.get_sim_time() < 1.0:
+            fdm.run()
+            if any(fdm['gear/unit[%d]/WOW' % i] for i in range(3)):
+                break
+
+        return fdm, fdm.get_sim_time(), fdm['velocities/v-down-fps']
+
+    def test_touch_down(self):
+        _, t_ref, vd_ref = self.drop(1/12000., False)
+        _, t_60Hz, vd_60Hz = self.drop(1/60., False)
+        fdm, t, vd = self.drop(1/60., True)
+
+        self.assertEqual(fdm['simulation/event-location/count'], 1)
+        self.assertAlmostEqual(t, t_ref, delta=2E-4)
+        self.assertAlmostEqual(vd, vd_ref, delta=1E-3)
+        self.assertGreater(abs(t_60Hz-t_ref), 10*abs(t-t_ref))
+
+        # The remainder of the time step is taken at the next frame, then the
+        # nominal time step is restored.
+        while fdm.get_sim_time() < 1.0:
+            fdm.run()
+
+        self.assertEqual(fdm.get_delta_t(), 1/60.)
+        frames = fdm.get_sim_time()*60.
+        self.assertAlmostEqual(frames, round(frames), delta=1E-6)
+
+    def climb(self, locate):
+        # The aircraft is released at 100 kts and pitches up. The event is
+        # triggered when it has climbed 2 ft.
+        script = """<?xml version="1.0"?>
+<runscript name="Located event">
+  <use aircraft="c172x" initialize="reset01"/>
+  <run start="0.0" end="2.0" dt="0.0166666666667">
+    <event name="Climbed" locate="true">
+      <condition> position/h-agl-ft ge 4002.0 </condition>
+      <set name="test/triggered" value="1"/>
+    </event>
+  </run>
+</runscript>"""
+        with open('located.xml', 'w') as f:
+            f.write(script)
+
+        fdm = self.create_fdm()
+        fdm.load_script('located.xml')
+        fdm['simulation/event-location/enabled'] = locate
+        fdm['test/triggered'] = 0
+        fdm.run_ic()
+
+        while fdm['position/h-agl-ft'] < 4002.0:
+            fdm.run()
+
+        return fdm
+
+    def test_script_condition(self):
+        fdm = self.climb(False)
+        h_60Hz = fdm['position/h-agl-ft']
+        fdm = self.climb(True)
+        h = fdm['position/h-agl-ft']
+
+        # The frame ends right after the condition has toggled and the event
+        # is triggered at the next frame.
+        self.assertAlmostEqual(h, 4002.0, delta=2E-3)
+        self.assertGreater(h_60Hz-4002.0, 10*(h-4002.0))
+        self.assertEqual(fdm['simulation/event-location/count'], 1)
+        self.assertEqual(fdm['test/triggered'], 0)
+        fdm.run()
+        self.assertEqual(fdm['test/triggered'], 1)
+
+
+RunTest(TestEventLocation)
@@ -360,6 +360,51 @@ class TestInitialConditions(JSBSimTestCase):
         fdm['ic/gamma-deg'] = 4
         self.assertAlmostEqual(fdm['ic/gamma-deg'], 4)
 
+    def testBatchUpdate(self):
+        fdm = self.create_fdm()
+        fdm.load_model('c172x')
+        fdm['ic/h-sl-ft'] = 3000.
+        fdm['ic/vc-kts'] = 100.
+        fdm['ic/gamma-deg'] = 2.
+        fdm.run_ic()
+        vt = fdm['velocities/vt-fps']
+        theta = fdm['attitude/theta-rad']
+
+        fdm['ic/h-sl-ft'] = 0.
+        fdm['ic/vc-kts'] = 0.
+        fdm['ic/gamma-deg'] = 0.
+
+        # The values are set in the reverse order and only applied when
+        # run_ic() commits the batch.
+        fdm.begin_ic_update()
+        fdm['ic/gamma-deg'] = 2.
+        fdm['ic/vc-kts'] = 100.
+        fdm['ic/h-sl-ft'] = 3000.
+        self.assertEqual(fdm['ic/h-sl-ft'], 0.)
+        fdm.run_ic()
+
+        self.assertAlmostEqual(fdm['ic/h-sl-ft'], 3000.)
+        self.assertAlmostEqual(fdm['velocities/vt-fps'], vt)
+        self.assertAlmostEqual(fdm['attitude/theta-rad'], theta)
+
+    def testTrimWithPendingBatch(self):
+        fdm = self.create_fdm()
+        fdm.load_model('c172x')
+        fdm['propulsion/set-running'] = -1
+        fdm.run_ic()
+
+        # The trim commits the pending batch instead of running inside it.
+        fdm.begin_ic_update()
+        fdm['ic/h-sl-ft'] = 3000.
+        fdm['ic/vc-kts'] = 100.
+        fdm['ic/gamma-deg'] = 0.
+        fdm['simulation/do_simple_trim'] = 1
+
+        self.assertAlmostEqual(fdm['ic/h-sl-ft'], 3000.)
+        self.assertAlmostEqual(fdm['ic/vc-kts'], 100.)
+        self.assertAlmostEqual(fdm['position/h-sl-ft'], 3000., delta=1.0)
+        self.assertAlmostEqual(fdm['velocities/vc-kts'], 100., delta=0.1)
+
     # Regression test for the bug reported in issue #553
     # Improper usage of the local frame rotation rate leads to FPEs.
     def testNorthPoleInitialization(self):
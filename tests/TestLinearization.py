@@ -1,11 +1,13 @@
 import xml.etree.ElementTree as et
 
+import numpy as np
+
 from JSBSim_utils import JSBSimTestCase, RunTest, CopyAircraftDef
 import jsbsim
 
 
 class TestLinearization(JSBSimTestCase):
-    def test_do_linearization(self):
+    def trimmed_fdm(self):
         script_path = self.sandbox.path_to_jsbsim_file('scripts',
                                                        '737_cruise.xml')
 
@@ -23,6 +25,10 @@ class TestLinearization(JSBSimTestCase):
         fdm['simulation/do_simple_trim'] = 1
         fdm.debug_lvl = 0 # Disable debug messages
 
+        return fdm
+
+    def test_do_linearization(self):
+        fdm = self.trimmed_fdm()
         linearization = jsbsim.FGLinearization(fdm)
 
         self.assertEqual(linearization.x0.shape, (12,))
@@ -48,5 +54,57 @@ class TestLinearization(JSBSimTestCase):
         self.assertEqual(linearization.y_units, ('ft/s', 'rad', 'rad', 'rad/s', 'rad', 'rad', 'rad/s',
                                                  'rad', 'rad/s', 'rad', 'rad', 'ft'))
 
+    def test_parallel_linearization(self):
+        fdm = self.trimmed_fdm()
+        serial = jsbsim.FGLinearization(fdm)
+
+        fdm = self.trimmed_fdm()
+        t = fdm.get_sim_time()
+        alpha = fdm['aero/alpha-rad']
+        two = jsbsim.FGLinearization(fdm, 2)
+
+        # The FDM is left unchanged by the clones, and so is the debug level.
+        # The aerodynamics are restored after the jacobians are computed.
+        self.assertEqual(fdm.debug_lvl, 0)
+        self.assertFalse(fdm.get_aerodynamics().is_linearized())
+        self.assertEqual(fdm.get_sim_time(), t)
+        self.assertEqual(fdm['aero/alpha-rad'], alpha)
+        np.testing.assert_array_equal(two.x0, serial.x0)
+        np.testing.assert_array_equal(two.u0, serial.u0)
+
+        # The elements are computed independently from each other so the
+        # results do not depend on the number of threads.
+        three = jsbsim.FGLinearization(fdm, 3)
+        for M2, M3 in zip(two.state_space, three.state_space):
+            np.testing.assert_array_equal(M2, M3)
+
+        # The serial computation starts each element from the state left by
+        # the previous one so the results differ slightly.
+        for M, Ms in zip(two.state_space, serial.state_space):
+            np.testing.assert_allclose(M, Ms, rtol=1E-2, atol=5E-2)
+
+        central = jsbsim.FGLinearization(fdm, 2, True)
+        self.assertEqual(central.system_matrix.shape, (12, 12))
+        np.testing.assert_allclose(central.input_matrix, two.input_matrix,
+                                   rtol=1E-2, atol=5E-2)
+
+    def test_aero_partials(self):
+        fdm = self.trimmed_fdm()
+        fd = jsbsim.FGLinearization(fdm)
+
+        # The analytic partials of the aerodynamics are only used on request
+        # and the aerodynamics are restored afterwards.
+        for threads in (1, 2):
+            fdm = self.trimmed_fdm()
+            analytic = jsbsim.FGLinearization(fdm, threads, aero_partials=True)
+            self.assertFalse(fdm.get_aerodynamics().is_linearized())
+            # The drag depends on abs(beta) which is not differentiable at the
+            # trim (beta = 0) so the derivatives with respect to beta differ.
+            beta = analytic.x_names.index('Beta')
+            for M, Mfd in zip(analytic.state_space, fd.state_space):
+                if M.shape[1] == len(analytic.x_names):
+                    M = np.delete(M, beta, axis=1)
+                    Mfd = np.delete(Mfd, beta, axis=1)
+                np.testing.assert_allclose(M, Mfd, rtol=1E-2, atol=5E-2)
 
 RunTest(TestLinearization)
@@ -297,6 +297,29 @@ class TestMiscellaneous(JSBSimTestCase):
             fdm_c172.run()
             self.assertEqual(fdm_S23["simulation/sim-time-sec"], 0.0)
 
+    def test_output_added_after_initialization(self):
+        # The 737 model defines no output so the output model is initially
+        # left out of the models that are run at each frame.
+        fdm = self.create_fdm()
+        fdm.load_model("737")
+        fdm.run_ic()
+        for _ in range(10):
+            fdm.run()
+
+        self.assertFalse(os.path.exists("output.csv"))
+
+        fdm.set_output_directive(self.sandbox.path_to_jsbsim_file("tests",
+                                                                  "output.xml"))
+        fdm.run_ic()
+        for _ in range(60):
+            fdm.run()
+
+        del fdm
+        with open("output.csv") as f:
+            lines = f.readlines()
+        # Header plus the records written at 20 Hz during half a second.
+        self.assertGreater(len(lines), 5)
+
     def test_get_set_attributes(self):
         pm = jsbsim.FGPropertyManager()
         root_node = pm.get_node("root", True)
@@ -18,10 +18,11 @@
 # this program; if not, see <http://www.gnu.org/licenses/>
 #
 
+import math
 import xml.etree.ElementTree as et
 
-from JSBSim_utils import JSBSimTestCase, RunTest, FlightModel
-from jsbsim import GeographicError
+from JSBSim_utils import JSBSimTestCase, RunTest, FlightModel, CreateFDM
+from jsbsim import BaseError, GeographicError
 
 
 class TestPlanet(JSBSimTestCase):
@@ -105,4 +106,83 @@ class TestPlanet(JSBSimTestCase):
         with self.assertRaises(GeographicError):
             self.fdm = tripod.start()
 
+    def write_gravity_field(self, J2, degree=2):
+        # WGS84 constants used by default by FGInertial
+        GM = 14.0764417572E15*0.3048**3
+        a = 20925646.32546*0.3048
+        with open(self.sandbox('J2.gfc'), 'w') as f:
+            f.write('product_type           gravity_field\n')
+            f.write('earth_gravity_constant {!r}\n'.format(GM))
+            f.write('radius                 {!r}\n'.format(a))
+            f.write('max_degree             {}\n'.format(degree))
+            f.write('norm                   fully_normalized\n')
+            f.write('end_of_head ================================\n')
+            f.write('gfc 0 0 1.0 0.0 0.0 0.0\n')
+            f.write('gfc 2 0 {!r} 0.0 0.0 0.0\n'.format(-J2/math.sqrt(5.0)))
+            # A non zero degree 3 term to check that the truncation is honored
+            f.write('gfc 3 0 1.0E-4 0.0 0.0 0.0\n')
+
+        planet = et.Element('planet', name='Earth')
+        et.SubElement(planet, 'gravity_field', file='J2.gfc',
+                      degree=str(degree))
+        planet_file = self.sandbox('planet_field.xml')
+        et.ElementTree(planet).write(planet_file)
+        return planet_file
+
+    def orbit(self, gravity_model, planet_file=None, duration=1800.0):
+        fdm = CreateFDM(self.sandbox)
+        if planet_file:
+            fdm.load_planet(planet_file, False)
+        fdm.load_model('ball')
+        fdm.load_ic('reset00_v2', True)
+        fdm.set_dt(0.05)
+        fdm['simulation/gravity-model'] = gravity_model
+        fdm.run_ic()
+        # Integrators used by the script ball_orbit.xml
+        fdm['simulation/integrator/rate/rotational'] = 3
+        fdm['simulation/integrator/rate/translational'] = 3
+        fdm['simulation/integrator/position/rotational'] = 1
+        fdm['simulation/integrator/position/translational'] = 4
+
+        for _ in range(int(round(duration/0.05))):
+            fdm.run()
+        return [fdm['position/eci-{}-ft'.format(axis)] for axis in 'xyz']
+
+    def test_gravity_field(self):
+        planet_file = self.write_gravity_field(1.08262982E-03)
+
+        fdm = CreateFDM(self.sandbox)
+        fdm.load_planet(planet_file, False)
+        self.assertEqual(fdm['simulation/gravity-model'], 2)
+
+        # A planet without a gravity field discards the field of the previous
+        # one.
+        moon_file = self.sandbox.path_to_jsbsim_file('tests/moon.xml')
+        fdm.load_planet(moon_file, False)
+        self.assertEqual(fdm['simulation/gravity-model'], 1)
+        fdm['simulation/gravity-model'] = 2
+        self.assertEqual(fdm['simulation/gravity-model'], 1)
+        del fdm
+
+        ref = self.orbit(1)
+        point_mass = self.orbit(0)
+        harmonics = self.orbit(2, planet_file)
+
+        # The C20 term of the expansion is the J2 model of FGInertial.
+        self.assertLess(math.dist(harmonics, ref), 1E-5)
+        self.assertGreater(math.dist(point_mass, ref), 1E3)
+
+    def test_gravity_field_errors(self):
+        fdm = CreateFDM(self.sandbox)
+        # The spherical harmonics model requires a gravity field.
+        fdm['simulation/gravity-model'] = 2
+        self.assertEqual(fdm['simulation/gravity-model'], 1)
+
+        planet = et.Element('planet', name='Earth')
+        et.SubElement(planet, 'gravity_field', file='missing.gfc')
+        planet_file = self.sandbox('planet_missing.xml')
+        et.ElementTree(planet).write(planet_file)
+        with self.assertRaises(BaseError):
+            fdm.load_planet(planet_file, False)
+
 RunTest(TestPlanet)
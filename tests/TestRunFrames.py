@@ -0,0 +1,111 @@
+# TestRunFrames.py
+#
+# Check that several frames can be run in a row without returning to Python.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import threading
+import xml.etree.ElementTree as et
+
+import numpy as np
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+import jsbsim
+
+properties = ('simulation/sim-time-sec', 'position/h-sl-ft',
+              'velocities/v-down-fps')
+
+
+class TestRunFrames(JSBSimTestCase):
+    def load_ball(self):
+        fdm = self.create_fdm()
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts', 'ball.xml'))
+        fdm.run_ic()
+        return fdm
+
+    def test_same_as_run(self):
+        fdm = self.load_ball()
+        ref = np.empty((100, len(properties)))
+        for i in range(100):
+            fdm.run()
+            ref[i] = [fdm[name] for name in properties]
+
+        fdm = self.load_ball()
+        out = np.empty((100, len(properties)))
+        self.assertEqual(fdm.run_frames(100, properties=properties, out=out),
+                         100)
+        np.testing.assert_array_equal(out, ref)
+
+    def test_stop_condition(self):
+        fdm = self.load_ball()
+        h0 = fdm['position/h-sl-ft']
+        condition = 'position/h-sl-ft lt %f' % (h0 - 100.0)
+        frames = fdm.run_frames(100000, condition)
+
+        self.assertLess(frames, 100000)
+        self.assertLess(fdm['position/h-sl-ft'], h0 - 100.0)
+        # The condition was false at the end of the previous frame.
+        dt = fdm.get_delta_t()
+        v = fdm['velocities/v-down-fps']
+        self.assertGreater(fdm['position/h-sl-ft'] + v*dt, h0 - 100.0 - 1.0)
+
+        with self.assertRaises(jsbsim.BaseError):
+            fdm.run_frames(10, 'position/h-sl-ft lt')
+
+    def test_script_end(self):
+        tree = et.parse(self.sandbox.path_to_jsbsim_file('scripts', 'ball.xml'))
+        tree.getroot().find('run').attrib['end'] = '1.0'
+        tree.write('ball_1s.xml')
+
+        fdm = self.create_fdm()
+        fdm.load_script('ball_1s.xml')
+        fdm.run_ic()
+        frames = fdm.run_frames(1000)
+        self.assertEqual(frames, 101)
+        self.assertFalse(fdm.run())
+
+    def test_bad_arguments(self):
+        fdm = self.load_ball()
+        with self.assertRaises(ValueError):
+            fdm.run_frames(10, properties=properties)
+        with self.assertRaises(ValueError):
+            fdm.run_frames(10, properties=properties, out=np.empty((5, 3)))
+        with self.assertRaises(jsbsim.BaseError):
+            fdm.run_frames(10, properties=('no/such/property',),
+                           out=np.empty((10, 1)))
+        self.assertEqual(fdm.get_sim_time(), 0.0)
+
+    def test_threads(self):
+        # Each thread runs its own instance while the GIL is released.
+        fdms = [self.load_ball() for _ in range(4)]
+        outs = [np.empty((200, len(properties))) for _ in fdms]
+
+        def run(fdm, out):
+            fdm.run_frames(200, properties=properties, out=out)
+
+        threads = [threading.Thread(target=run, args=args)
+                   for args in zip(fdms, outs)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+
+        for out in outs[1:]:
+            np.testing.assert_array_equal(out, outs[0])
+
+
+RunTest(TestRunFrames)
@@ -0,0 +1,112 @@
+# TestRungeKutta.py
+#
+# Regression tests of the whole state Runge-Kutta integrators of FGPropagate.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import math
+from JSBSim_utils import JSBSimTestCase, CreateFDM, RunTest, ExecuteUntil
+
+
+class TestRungeKutta(JSBSimTestCase):
+    def orbit(self, dt, runge_kutta, duration=300.0):
+        return self.orbit_segments(dt, [(runge_kutta, duration)])
+
+    def orbit_segments(self, dt, segments):
+        fdm = CreateFDM(self.sandbox)
+        fdm.load_model('ball')
+        fdm.load_ic('reset00_v2', True)
+        fdm.set_dt(dt)
+        fdm['simulation/gravity-model'] = 1
+        fdm.run_ic()
+        # Integrators used by the script ball_orbit.xml
+        fdm['simulation/integrator/rate/rotational'] = 3
+        fdm['simulation/integrator/rate/translational'] = 3
+        fdm['simulation/integrator/position/rotational'] = 1
+        fdm['simulation/integrator/position/translational'] = 4
+
+        duration = 0.0
+        for runge_kutta, length in segments:
+            fdm['simulation/integrator/runge-kutta'] = runge_kutta
+            for _ in range(int(round(length/dt))):
+                fdm.run()
+            duration += length
+
+        self.assertAlmostEqual(fdm.get_sim_time(), duration, delta=1E-6)
+        return [fdm['position/eci-{}-ft'.format(axis)] for axis in 'xyz']
+
+    def distance(self, p1, p2):
+        return math.sqrt(sum((a-b)**2 for a, b in zip(p1, p2)))
+
+    def test_orbit_accuracy(self):
+        ref = self.orbit(0.05, 45)
+
+        err_ab = self.orbit(0.02, 0)
+        err_rk4 = self.orbit(1.0, 4)
+        err_rkf45 = self.orbit(1.0, 45)
+
+        # Runge-Kutta schemes with a time step 50 times larger are still more
+        # accurate than the multistep integrators.
+        self.assertLess(self.distance(err_rk4, ref),
+                        0.01*self.distance(err_ab, ref))
+        self.assertLess(self.distance(err_rkf45, ref),
+                        0.01*self.distance(err_ab, ref))
+
+    def test_switch_back_to_multistep(self):
+        ref = self.orbit(0.05, 45)
+        err_ab = self.distance(self.orbit(0.02, 0), ref)
+
+        # The past value histories of the multistep integrators are primed
+        # again when switching back from Runge-Kutta. Otherwise the
+        # derivatives of 100 seconds ago would shift the orbit by 30 ft.
+        mixed = self.orbit_segments(0.02, [(0, 100.0), (4, 100.0),
+                                           (0, 100.0)])
+        self.assertLess(self.distance(mixed, ref), 10.0*err_ab)
+
+    def test_ground_contact(self):
+        results = []
+        for runge_kutta in (0, 4, 45):
+            fdm = self.create_fdm()
+            self.load_script('f16_runway_test')
+            fdm.run_ic()
+            fdm['simulation/integrator/runge-kutta'] = runge_kutta
+            ExecuteUntil(fdm, 10.0)
+            results.append((fdm['position/h-agl-ft'],
+                            fdm['velocities/vc-kts'],
+                            fdm['attitude/theta-deg']))
+            self.assertEqual(fdm['simulation/integrator/runge-kutta'],
+                             runge_kutta)
+
+        for rk in results[1:]:
+            self.assertAlmostEqual(rk[0], results[0][0], delta=1E-3)
+            self.assertAlmostEqual(rk[1], results[0][1], delta=1E-3)
+            self.assertAlmostEqual(rk[2], results[0][2], delta=1E-2)
+
+    def test_unknown_scheme(self):
+        fdm = CreateFDM(self.sandbox)
+        fdm.load_model('ball')
+        fdm['simulation/integrator/runge-kutta'] = 45
+        # Unknown schemes are rejected and the scheme in use is kept.
+        for runge_kutta in (1, 5, 44, -4):
+            fdm['simulation/integrator/runge-kutta'] = runge_kutta
+            self.assertEqual(fdm['simulation/integrator/runge-kutta'], 45)
+
+        fdm['simulation/integrator/runge-kutta'] = 0
+        self.assertEqual(fdm['simulation/integrator/runge-kutta'], 0)
+
+
+RunTest(TestRungeKutta)
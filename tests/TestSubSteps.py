@@ -0,0 +1,88 @@
+# TestSubSteps.py
+#
+# Regression tests of the sub-stepped integration of the equations of motion.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+
+class TestSubSteps(JSBSimTestCase):
+    def drop(self, dt, substeps, duration=5.0):
+        # Drop the aircraft from a few feet and let it settle on its gear.
+        fdm = self.create_fdm()
+        fdm.load_model('c172x')
+        fdm['ic/h-agl-ft'] = 5.0
+        fdm['ic/vc-kts'] = 0.0
+        fdm['ic/theta-deg'] = 0.0
+        fdm.set_dt(dt)
+        fdm.run_ic()
+        fdm['simulation/integrator/substeps'] = substeps
+
+        while fdm.get_sim_time() < duration:
+            fdm.run()
+
+        return fdm['position/h-agl-ft'], fdm['attitude/theta-deg']
+
+    def test_ground_contact(self):
+        h_ref, theta_ref = self.drop(1/1200., 1)
+        h, theta = self.drop(1/60., 20)
+
+        self.assertAlmostEqual(h, h_ref, delta=1E-3)
+        self.assertAlmostEqual(theta, theta_ref, delta=2E-2)
+
+    def fly(self, substeps, duration=10.0):
+        fdm = self.create_fdm()
+        fdm.load_model('c172x')
+        fdm['ic/h-sl-ft'] = 3000.
+        fdm['ic/vc-kts'] = 100.
+        fdm['ic/gamma-deg'] = 0.0
+        fdm.set_dt(1/60.)
+        fdm.run_ic()
+        fdm['propulsion/set-running'] = -1
+        fdm['simulation/do_simple_trim'] = 1
+        fdm['simulation/integrator/substeps'] = substeps
+
+        while fdm.get_sim_time() < duration:
+            fdm.run()
+
+        return fdm
+
+    def test_in_flight(self):
+        # The sub-steps must cover the frame and nothing more: the aircraft
+        # flies the same path as with a single step per frame.
+        ref = self.fly(1)
+        fdm = self.fly(4)
+
+        self.assertEqual(fdm.get_sim_time(), ref.get_sim_time())
+        for name in ['position/distance-from-start-mag-mt',
+                     'position/h-sl-ft', 'velocities/u-fps',
+                     'velocities/w-fps', 'attitude/theta-deg']:
+            self.assertAlmostEqual(fdm[name], ref[name], delta=1E-4,
+                                   msg=name)
+
+    def test_property(self):
+        fdm = self.create_fdm()
+        fdm.load_model('c172x')
+        self.assertEqual(fdm['simulation/integrator/substeps'], 1)
+        fdm['simulation/integrator/substeps'] = 0
+        self.assertEqual(fdm['simulation/integrator/substeps'], 1)
+        fdm['simulation/integrator/substeps'] = 4
+        self.assertEqual(fdm['simulation/integrator/substeps'], 4)
+
+
+RunTest(TestSubSteps)
@@ -0,0 +1,99 @@
+# TestTrajectoryLinearization.py
+#
+# Check the linearization of an aircraft along its trajectory.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import numpy as np
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+import jsbsim
+
+
+class TestTrajectoryLinearization(JSBSimTestCase):
+    def trimmed_fdm(self):
+        fdm = self.create_fdm()
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         '737_cruise.xml'))
+        fdm.run_ic()
+        fdm['propulsion/engine[0]/set-running'] = 1
+        fdm['propulsion/engine[1]/set-running'] = 1
+        fdm.run()
+        fdm['simulation/do_simple_trim'] = 1
+        return fdm
+
+    def fly(self, duration, threads=None, filename=None):
+        fdm = self.trimmed_fdm()
+        t0 = fdm.get_sim_time()
+        ltv = None
+        if threads is not None:
+            ltv = jsbsim.FGTrajectoryLinearization(fdm, 0.5,
+                                                   self.sandbox(filename),
+                                                   threads)
+            ltv.update()
+
+        while fdm.get_sim_time() < t0 + duration - 1E-9:
+            fdm.run()
+            if ltv:
+                ltv.update()
+
+        if ltv:
+            ltv.finish()
+            self.assertEqual(ltv.requested, ltv.written)
+        return fdm
+
+    def test_ltv_model(self):
+        ref = self.fly(2.0)
+        fdm = self.fly(2.0, 2, 'one.ltv')
+
+        # The FDM is not modified by the linearizations.
+        for prop in ('position/h-sl-ft', 'velocities/u-fps',
+                     'velocities/w-fps', 'attitude/theta-rad'):
+            self.assertEqual(fdm[prop], ref[prop])
+
+        model = jsbsim.load_ltv_model(self.sandbox('one.ltv'))
+        self.assertEqual(model['t'].shape, (5,))
+        np.testing.assert_allclose(np.diff(model['t']), 0.5, atol=1E-3)
+        self.assertEqual(model['x0'].shape, (5, 12))
+        self.assertEqual(model['u0'].shape, (5, 4))
+        self.assertEqual(model['A'].shape, (5, 12, 12))
+        self.assertEqual(model['B'].shape, (5, 12, 4))
+        self.assertEqual(model['C'].shape, (5, 12, 12))
+        self.assertEqual(model['D'].shape, (5, 12, 4))
+
+        # The first model is the linearization of the trimmed FDM.
+        lin = jsbsim.FGLinearization(self.trimmed_fdm())
+        self.assertEqual(model['x_names'], lin.x_names)
+        self.assertEqual(model['u_units'], lin.u_units)
+        np.testing.assert_allclose(model['x0'][0], lin.x0, atol=1E-12)
+        for M, name in zip(lin.state_space, ('A', 'B', 'C', 'D')):
+            np.testing.assert_allclose(model[name][0], M, rtol=1E-6,
+                                       atol=1E-6)
+
+        # The models do not depend on the number of threads.
+        self.fly(2.0, 1, 'two.ltv')
+        other = jsbsim.load_ltv_model(self.sandbox('two.ltv'))
+        for name in ('t', 'x0', 'u0', 'y0', 'A', 'B', 'C', 'D'):
+            np.testing.assert_array_equal(other[name], model[name])
+
+    def test_invalid_interval(self):
+        fdm = self.trimmed_fdm()
+        with self.assertRaises(jsbsim.BaseError):
+            jsbsim.FGTrajectoryLinearization(fdm, 0.0, self.sandbox('x.ltv'))
+
+
+RunTest(TestTrajectoryLinearization)
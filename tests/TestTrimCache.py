@@ -0,0 +1,86 @@
+# TestTrimCache.py
+#
+# Check that the trims are warm started from the cache of the trim solutions.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+
+class TestTrimCache(JSBSimTestCase):
+    def trim(self, fdm, speed):
+        fdm['ic/h-sl-ft'] = 4000.
+        fdm['ic/vc-kts'] = speed
+        fdm['ic/gamma-deg'] = 0.0
+        fdm['propulsion/set-running'] = -1
+        fdm.run_ic()
+        fdm['simulation/do_simple_trim'] = 1
+        return fdm['aero/alpha-deg'], fdm['fcs/throttle-cmd-norm']
+
+    def create_c172(self, cache_file=""):
+        fdm = self.create_fdm()
+        fdm.load_model('c172x')
+        fdm.enable_trim_cache(cache_file)
+        return fdm
+
+    def test_warm_start(self):
+        fdm = self.create_c172()
+        alpha, throttle = self.trim(fdm, 100.)
+        self.assertEqual(fdm['simulation/trim-cache/entries'], 1)
+        self.assertEqual(fdm['simulation/trim-cache/lookups'], 1)
+        self.assertEqual(fdm['simulation/trim-cache/hits'], 0)
+        self.assertEqual(fdm['simulation/trim-cache/warm-starts'], 0)
+
+        # The same flight condition is a hit and the trim is cheaper.
+        fdm.reset_to_initial_conditions(0)
+        alpha2, throttle2 = self.trim(fdm, 100.)
+        self.assertEqual(fdm['simulation/trim-cache/entries'], 1)
+        self.assertEqual(fdm['simulation/trim-cache/hits'], 1)
+        self.assertAlmostEqual(fdm['simulation/trim-cache/hit-rate'], 0.5)
+        self.assertGreater(fdm['simulation/trim-cache/saved-runs'], 0)
+        self.assertAlmostEqual(alpha2, alpha, delta=0.01)
+        self.assertAlmostEqual(throttle2, throttle, delta=0.01)
+
+        # A nearby flight condition is warm started from the nearest solution
+        # and is then stored as a new solution.
+        fdm.reset_to_initial_conditions(0)
+        self.trim(fdm, 105.)
+        self.assertEqual(fdm['simulation/trim-cache/entries'], 2)
+        self.assertEqual(fdm['simulation/trim-cache/hits'], 1)
+        self.assertEqual(fdm['simulation/trim-cache/warm-starts'], 2)
+        self.assertAlmostEqual(fdm['accelerations/udot-ft_sec2'], 0.0,
+                               delta=0.01)
+        self.assertAlmostEqual(fdm['accelerations/wdot-ft_sec2'], 0.0,
+                               delta=0.01)
+
+    def test_cache_file(self):
+        cache_file = self.sandbox('trim_cache.csv')
+        fdm = self.create_c172(cache_file)
+        alpha, throttle = self.trim(fdm, 100.)
+        self.assertTrue(self.sandbox.exists('trim_cache.csv'))
+
+        # The solution is read from the file by another instance.
+        fdm = self.create_c172(cache_file)
+        self.assertEqual(fdm['simulation/trim-cache/entries'], 1)
+        alpha2, throttle2 = self.trim(fdm, 100.)
+        self.assertEqual(fdm['simulation/trim-cache/hits'], 1)
+        self.assertGreater(fdm['simulation/trim-cache/saved-runs'], 0)
+        self.assertAlmostEqual(alpha2, alpha, delta=0.01)
+        self.assertAlmostEqual(throttle2, throttle, delta=0.01)
+
+
+RunTest(TestTrimCache)
@@ -0,0 +1,154 @@
+# TestTrimSweep.py
+#
+# Check the trim of an aircraft over a grid of flight conditions.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import os
+
+import numpy as np
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+import jsbsim
+
+
+class TestTrimSweep(JSBSimTestCase):
+    def setUp(self):
+        JSBSimTestCase.setUp(self)
+        self.fdm = self.create_fdm()
+        self.fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                              '737_cruise.xml'))
+        self.fdm.run_ic()
+        self.fdm['propulsion/engine[0]/set-running'] = 1
+        self.fdm['propulsion/engine[1]/set-running'] = 1
+        self.fdm.run()
+
+    def sweep(self, threads, speeds=(250., 280., 310.)):
+        sweep = jsbsim.FGTrimSweep(self.fdm, 0)  # Longitudinal trim
+        sweep.add_axis('ic/h-sl-ft', [20000., 30000.])
+        sweep.add_axis('ic/vc-kts', speeds)
+        sweep.set_threads(threads)
+        return sweep
+
+    def test_grid(self):
+        t = self.fdm.get_sim_time()
+        alpha = self.fdm['aero/alpha-rad']
+
+        sweep = self.sweep(1)
+        self.assertEqual(sweep.run(), 6)
+        table = sweep.table
+        columns = sweep.columns
+        self.assertEqual(table.shape, (6, len(columns)))
+        self.assertEqual(columns[:2], ('ic/h-sl-ft', 'ic/vc-kts'))
+        self.assertEqual(columns[-3:], ('converged', 'iterations',
+                                        'warm-start'))
+
+        # The last axis varies the fastest and each point starts from the
+        # point whose last non zero index is decremented.
+        np.testing.assert_array_equal(table[:, 0], [20000.]*3 + [30000.]*3)
+        np.testing.assert_array_equal(table[:, 1], [250., 280., 310.]*2)
+        np.testing.assert_array_equal(table[:, -1], [-1, 0, 1, 0, 3, 4])
+
+        # The throttle must be increased to fly faster.
+        throttle = table[:, columns.index('fcs/throttle-cmd-norm[0]')]
+        self.assertTrue(np.all(np.diff(throttle[:3]) > 0.0))
+        self.assertTrue(np.all(np.diff(throttle[3:]) > 0.0))
+        alpha_deg = table[:, columns.index('aero/alpha-deg')]
+        theta_deg = table[:, columns.index('attitude/theta-deg')]
+        np.testing.assert_allclose(alpha_deg, theta_deg, atol=1E-6)
+
+        # The FDM is left unchanged.
+        self.assertEqual(self.fdm.get_sim_time(), t)
+        self.assertEqual(self.fdm['aero/alpha-rad'], alpha)
+
+        # The results do not depend on the number of threads.
+        sweep = self.sweep(3)
+        self.assertEqual(sweep.run(), 6)
+        np.testing.assert_array_equal(sweep.table, table)
+
+    def test_cache(self):
+        cache = self.sandbox('cache')
+        os.mkdir(cache)
+
+        sweep = self.sweep(2)
+        sweep.set_cache_directory(cache)
+        sweep.run()
+        self.assertFalse(sweep.from_cache)
+        self.assertTrue(os.path.exists(sweep.cache_file))
+        self.assertTrue(os.path.basename(sweep.cache_file).startswith('737-'))
+        table = sweep.table
+
+        sweep = self.sweep(2)
+        sweep.set_cache_directory(cache)
+        self.assertEqual(sweep.run(), 6)
+        self.assertTrue(sweep.from_cache)
+        np.testing.assert_array_equal(sweep.table, table)
+
+        # Another grid is not read from the cache.
+        sweep = self.sweep(2, (250., 280.))
+        sweep.set_cache_directory(cache)
+        sweep.run()
+        self.assertFalse(sweep.from_cache)
+        self.assertEqual(len(os.listdir(cache)), 2)
+
+        # Nor are other initial conditions.
+        self.fdm['ic/gamma-deg'] = 1.0
+        sweep = self.sweep(2)
+        sweep.set_cache_directory(cache)
+        sweep.run()
+        self.assertFalse(sweep.from_cache)
+
+        # Nor is another fuel load whereas the same one is.
+        self.fdm['propulsion/tank[0]/contents-lbs'] -= 1000.0
+        sweep = self.sweep(2)
+        sweep.set_cache_directory(cache)
+        sweep.run()
+        self.assertFalse(sweep.from_cache)
+
+        sweep = self.sweep(2)
+        sweep.set_cache_directory(cache)
+        sweep.run()
+        self.assertTrue(sweep.from_cache)
+
+    def test_write(self):
+        sweep = self.sweep(1, (280.,))
+        sweep.add_output('velocities/vt-fps')
+        sweep.run()
+        sweep.write('sweep.csv')
+
+        with open('sweep.csv') as f:
+            lines = f.read().splitlines()
+
+        self.assertEqual(lines[0], 'ic/h-sl-ft,ic/vc-kts,velocities/vt-fps,'
+                         'converged,iterations,warm-start')
+        self.assertEqual(len(lines), 3)
+        np.testing.assert_array_equal(np.array(lines[1].split(','), dtype=float),
+                                      sweep.table[0])
+
+    def test_errors(self):
+        sweep = jsbsim.FGTrimSweep(self.fdm, 0)
+        with self.assertRaises(jsbsim.BaseError):
+            sweep.add_axis('ic/no-such-property', [1.0])
+        with self.assertRaises(jsbsim.BaseError):
+            sweep.add_axis('ic/h-sl-ft', [])
+        with self.assertRaises(jsbsim.BaseError):
+            sweep.add_output('no/such/property')
+        with self.assertRaises(jsbsim.BaseError):
+            sweep.run()
+
+
+RunTest(TestTrimSweep)
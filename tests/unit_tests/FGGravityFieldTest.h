@@ -0,0 +1,295 @@
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+#include <math/FGGravityField.h>
+#include <simgear/misc/sg_path.hxx>
+
+using namespace JSBSim;
+
+const double epsilon = 1E-8;
+
+// EGM2008 values (SI units)
+const double GM_SI = 3.986004415E+14;
+const double R_SI = 6378136.3;
+
+
+class FGGravityFieldTest : public CxxTest::TestSuite
+{
+public:
+  struct Coefficients {
+    unsigned int degree;
+    std::vector<double> C, S;
+  };
+
+  static std::string Header(const std::string& norm = "fully_normalized") {
+    std::ostringstream s;
+    s.precision(17);
+    s << "product_type           gravity_field\n"
+      << "modelname              test\n"
+      << "earth_gravity_constant " << GM_SI << "\n"
+      << "radius                 " << R_SI << "\n"
+      << "norm                   " << norm << "\n"
+      << "end_of_head ===================================\n";
+    return s.str();
+  }
+
+  // Random coefficients with the amplitude decreasing as 1/n^2 (Kaula rule)
+  static Coefficients RandomField(unsigned int degree, std::string& content) {
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    Coefficients field;
+    field.degree = degree;
+    field.C.assign((degree+1)*(degree+2)/2, 0.0);
+    field.S.assign((degree+1)*(degree+2)/2, 0.0);
+    field.C[0] = 1.0;
+
+    std::ostringstream s;
+    s.precision(17);
+    s << Header() << "gfc 0 0 1.0 0.0\n";
+    for (unsigned int n=2; n<=degree; n++) {
+      for (unsigned int m=0; m<=n; m++) {
+        unsigned int idx = n*(n+1)/2+m;
+        field.C[idx] = 1E-5*dist(gen)/(n*n);
+        if (m > 0) field.S[idx] = 1E-5*dist(gen)/(n*n);
+        s << "gfc " << n << " " << m << " " << field.C[idx] << " "
+          << field.S[idx] << " 0.0 0.0\n";
+      }
+    }
+    content = s.str();
+    return field;
+  }
+
+  // Potential of the terms of degree 1 and higher, computed in spherical
+  // coordinates with the fully normalized associated Legendre functions.
+  static double Potential(const Coefficients& field, const FGColumnVector3& pos) {
+    const double GM = GM_SI/(0.3048*0.3048*0.3048);
+    const double R = R_SI/0.3048;
+    double r = pos.Magnitude();
+    double t = pos(3)/r;
+    double u = sqrt(1.0-t*t);
+    double lon = atan2(pos(2), pos(1));
+    unsigned int N = field.degree;
+    std::vector<double> P((N+1)*(N+2)/2, 0.0);
+    auto idx = [](unsigned int n, unsigned int m) { return n*(n+1)/2+m; };
+
+    P[0] = 1.0;
+    for (unsigned int m=0; m<=N; m++) {
+      if (m > 0)
+        P[idx(m,m)] = (m == 1 ? sqrt(3.0) : sqrt((2.0*m+1.0)/(2.0*m)))*u*P[idx(m-1,m-1)];
+      for (unsigned int n=m+1; n<=N; n++) {
+        double a = sqrt((2.0*n+1.0)*(2.0*n-1.0)/((n-m)*(n+m)));
+        P[idx(n,m)] = a*t*P[idx(n-1,m)];
+        if (n > m+1) {
+          double b = sqrt((2.0*n+1.0)*(n+m-1.0)*(n-m-1.0)/((2.0*n-3.0)*(n+m)*(n-m)));
+          P[idx(n,m)] -= b*P[idx(n-2,m)];
+        }
+      }
+    }
+
+    double U = 0.0;
+    for (unsigned int n=1; n<=N; n++) {
+      double sum = 0.0;
+      for (unsigned int m=0; m<=n; m++)
+        sum += P[idx(n,m)]*(field.C[idx(n,m)]*cos(m*lon) + field.S[idx(n,m)]*sin(m*lon));
+      U += pow(R/r, n)*sum;
+    }
+    return GM*U/r;
+  }
+
+  void testLoad() {
+    std::istringstream s(Header() +
+                         "gfc 0 0 1.0 0.0\n"
+                         "gfct 2 0 -0.48416531D-03 0.0 0.0 0.0 20000101\n"
+                         "gfc 2 0 -0.484165143790815D-03 0.0 0.0 0.0\n"
+                         "gfc 2 2 0.243938357328313E-05 -0.140027370385934E-05 0.0 0.0\n"
+                         "gfc 3 0 0.957161207093473E-06 0.0 0.0 0.0\n");
+    FGGravityField field;
+
+    field.Load(s, 100);
+    TS_ASSERT_EQUALS(field.GetDegree(), 3);
+    TS_ASSERT_DELTA(field.GetGM()/14.0764417572E15, 1.0, 1E-8);
+    TS_ASSERT_DELTA(field.GetRadius(), R_SI/0.3048, 1E-6);
+    TS_ASSERT_EQUALS(field.GetCacheDistance(), 0.0);
+
+    std::istringstream s2(s.str());
+    field.Load(s2, 2);
+    TS_ASSERT_EQUALS(field.GetDegree(), 2);
+  }
+
+  void testLoadErrors() {
+    FGGravityField field;
+
+    std::istringstream no_end("radius 6378136.3\nearth_gravity_constant 3.986E14\n"
+                              "gfc 0 0 1.0 0.0\n");
+    TS_ASSERT_THROWS(field.Load(no_end, 10), BaseException&);
+
+    std::istringstream no_GM("radius 6378136.3\nend_of_head\ngfc 0 0 1.0 0.0\n");
+    TS_ASSERT_THROWS(field.Load(no_GM, 10), BaseException&);
+
+    std::istringstream no_coeffs(Header());
+    TS_ASSERT_THROWS(field.Load(no_coeffs, 10), BaseException&);
+
+    std::istringstream bad_order(Header() + "gfc 2 3 1.0 0.0\n");
+    TS_ASSERT_THROWS(field.Load(bad_order, 10), BaseException&);
+
+    std::istringstream bad_number(Header() + "gfc 2 0 1.0x 0.0\n");
+    TS_ASSERT_THROWS(field.Load(bad_number, 10), BaseException&);
+
+    std::istringstream truncated(Header() + "gfc 2 0\n");
+    TS_ASSERT_THROWS(field.Load(truncated, 10), BaseException&);
+
+    TS_ASSERT_THROWS(field.Load(SGPath("does_not_exist.gfc"), 10), BaseException&);
+  }
+
+  void testPointMass() {
+    std::istringstream s(Header() + "gfc 0 0 1.0 0.0\n");
+    FGGravityField field;
+    field.Load(s, 10);
+    double GM = field.GetGM();
+
+    FGColumnVector3 pos(1.2E7, -1.5E7, 8.0E6);
+    double r = pos.Magnitude();
+    FGColumnVector3 g = field.GetGravitation(pos);
+    FGColumnVector3 ref = -GM/(r*r*r)*pos;
+
+    for (int i=1; i<=3; i++)
+      TS_ASSERT_DELTA(g(i), ref(i), epsilon);
+  }
+
+  void testMissingCentralTerm() {
+    // A file that only lists the perturbations keeps the point mass term.
+    const std::string J2 = "gfc 2 0 -0.484165143790815D-03 0.0 0.0 0.0\n";
+    std::istringstream s(Header() + J2);
+    std::istringstream s_ref(Header() + "gfc 0 0 1.0 0.0\n" + J2);
+    FGGravityField field, ref;
+    field.Load(s, 10);
+    ref.Load(s_ref, 10);
+
+    FGColumnVector3 pos(1.2E7, -1.5E7, 8.0E6);
+    FGColumnVector3 g = field.GetGravitation(pos);
+    FGColumnVector3 g_ref = ref.GetGravitation(pos);
+
+    for (int i=1; i<=3; i++)
+      TS_ASSERT_EQUALS(g(i), g_ref(i));
+  }
+
+  void testJ2() {
+    // The J2 term alone must match the formula used by FGInertial.
+    const double J2 = 1.08262982E-03;
+    std::ostringstream content;
+    content.precision(17);
+    content << Header() << "gfc 0 0 1.0 0.0\n"
+            << "gfc 2 0 " << -J2/sqrt(5.0) << " 0.0\n";
+
+    for (const std::string& norm: {"fully_normalized", "unnormalized"}) {
+      std::string data = content.str();
+      if (norm == "unnormalized") {
+        std::ostringstream s;
+        s.precision(17);
+        s << Header(norm) << "gfc 0 0 1.0 0.0\n" << "gfc 2 0 " << -J2 << " 0.0\n";
+        data = s.str();
+      }
+      std::istringstream s(data);
+      FGGravityField field;
+      field.Load(s, 10);
+      double GM = field.GetGM();
+      double a = field.GetRadius();
+
+      for (double lat: {-90.0, -45.0, 0.0, 30.0, 89.0, 90.0}) {
+        double r = a + 1.0E6;
+        double phi = lat*M_PI/180.0, lon = 0.7;
+        FGColumnVector3 pos(r*cos(phi)*cos(lon), r*cos(phi)*sin(lon), r*sin(phi));
+        double sinLat = sin(phi);
+        double adivr = a/r;
+        double preCommon = 1.5*J2*adivr*adivr;
+        double xy = 1.0 - 5.0*(sinLat*sinLat);
+        double z = 3.0 - 5.0*(sinLat*sinLat);
+        double GMOverr2 = GM/(r*r);
+        FGColumnVector3 ref(-GMOverr2*(1.0+preCommon*xy)*pos(1)/r,
+                            -GMOverr2*(1.0+preCommon*xy)*pos(2)/r,
+                            -GMOverr2*(1.0+preCommon*z)*pos(3)/r);
+        FGColumnVector3 g = field.GetGravitation(pos);
+
+        for (int i=1; i<=3; i++)
+          TS_ASSERT_DELTA(g(i), ref(i), epsilon);
+      }
+    }
+  }
+
+  void testHighDegree() {
+    // Compare the gravitation with the gradient of the potential obtained by
+    // finite differences.
+    std::string content;
+    Coefficients ref = RandomField(100, content);
+    std::istringstream s(content);
+    FGGravityField field;
+    field.Load(s, 100);
+    TS_ASSERT_EQUALS(field.GetDegree(), 100);
+    double GM = field.GetGM();
+    double R = field.GetRadius();
+
+    const double h = 10.0;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    for (int k=0; k<10; k++) {
+      FGColumnVector3 pos(dist(gen), dist(gen), dist(gen));
+      pos *= (R + 1.0E5*(k+1))/pos.Magnitude();
+      double r = pos.Magnitude();
+      FGColumnVector3 g = field.GetGravitation(pos) + GM/(r*r*r)*pos;
+
+      for (int i=1; i<=3; i++) {
+        FGColumnVector3 dp;
+        dp(i) = h;
+        double grad = (Potential(ref, pos+dp) - Potential(ref, pos-dp))/(2.0*h);
+        TS_ASSERT_DELTA(g(i), grad, 1E-10);
+      }
+    }
+
+    // The expansion is free of singularities at the poles.
+    FGColumnVector3 pole(0.0, 0.0, R);
+    FGColumnVector3 g = field.GetGravitation(pole);
+    for (int i=1; i<=3; i++)
+      TS_ASSERT(std::isfinite(g(i)));
+  }
+
+  void testCache() {
+    std::string content;
+    RandomField(20, content);
+    std::istringstream s(content);
+    FGGravityField field;
+    field.Load(s, 20);
+    double GM = field.GetGM();
+
+    FGColumnVector3 pos(2.1E7, 1.0E5, 3.0E5);
+    FGColumnVector3 moved = pos + FGColumnVector3(5.0, 0.0, 0.0);
+    FGColumnVector3 g0 = field.GetGravitation(pos);
+    FGColumnVector3 exact = field.GetGravitation(moved);
+
+    field.SetCacheDistance(100.0);
+    TS_ASSERT_EQUALS(field.GetCacheDistance(), 100.0);
+    FGColumnVector3 g1 = field.GetGravitation(pos);
+    for (int i=1; i<=3; i++)
+      TS_ASSERT_EQUALS(g1(i), g0(i));
+
+    // The perturbation is reused but the point mass term is exact.
+    double r = moved.Magnitude(), r0 = pos.Magnitude();
+    FGColumnVector3 cached = field.GetGravitation(moved);
+    FGColumnVector3 expected = g0 + GM/(r0*r0*r0)*pos - GM/(r*r*r)*moved;
+    for (int i=1; i<=3; i++) {
+      TS_ASSERT_DELTA(cached(i), expected(i), 1E-12);
+      TS_ASSERT_DELTA(cached(i), exact(i), 1E-6);
+    }
+
+    // The expansion is evaluated again beyond the cache distance.
+    FGColumnVector3 far = pos + FGColumnVector3(0.0, 200.0, 0.0);
+    FGColumnVector3 g2 = field.GetGravitation(far);
+    field.SetCacheDistance(0.0);
+    FGColumnVector3 g3 = field.GetGravitation(far);
+    for (int i=1; i<=3; i++)
+      TS_ASSERT_EQUALS(g2(i), g3(i));
+  }
+};
@@ -377,4 +377,192 @@ public:
     TS_ASSERT_DELTA(ic.GetWindEFpsIC(), 3.5, epsilon);
     TS_ASSERT_DELTA(ic.GetWindDFpsIC(), 3.0, epsilon);
   }
+
+  void testBatchUpdate() {
+    FGFDMExec fdmex;
+    FGInitialCondition ic_seq(&fdmex), ic(&fdmex);
+
+    // Reference: the values are set one after the other in the order used by
+    // CommitUpdate().
+    ic_seq.SetLatitudeDegIC(45.0);
+    ic_seq.SetAltitudeASLFtIC(3000.0);
+    ic_seq.SetPsiDegIC(30.0);
+    ic_seq.SetVcalibratedKtsIC(120.0);
+    ic_seq.SetFlightPathAngleDegIC(3.0);
+    ic_seq.SetAlphaDegIC(2.0);
+
+    // The same values are set in a batch and in a different order.
+    ic.BeginUpdate();
+    TS_ASSERT(ic.IsUpdating());
+    ic.SetAlphaDegIC(2.0);
+    ic.SetMachIC(0.5); // Overridden by the calibrated airspeed below
+    ic.SetVcalibratedKtsIC(120.0);
+    ic.SetClimbRateFpsIC(10.0); // Overridden by the flight path angle below
+    ic.SetFlightPathAngleDegIC(3.0);
+    ic.SetPsiDegIC(30.0);
+    ic.SetLatitudeDegIC(45.0);
+    ic.SetAltitudeAGLFtIC(1000.0); // Overridden by the altitude ASL below
+    ic.SetAltitudeASLFtIC(3000.0);
+
+    // The initial conditions are left unchanged until the batch is committed.
+    TS_ASSERT_EQUALS(ic.GetAltitudeASLFtIC(), 0.0);
+    TS_ASSERT_EQUALS(ic.GetLatitudeDegIC(), 0.0);
+    TS_ASSERT_EQUALS(ic.GetPsiDegIC(), 0.0);
+    TS_ASSERT_EQUALS(ic.GetVcalibratedKtsIC(), 0.0);
+    TS_ASSERT_EQUALS(ic.GetAlphaDegIC(), 0.0);
+
+    ic.CommitUpdate();
+    TS_ASSERT(!ic.IsUpdating());
+    // The position is solved once so the results may differ from the
+    // sequential ones by the rounding of the position radius.
+    TS_ASSERT_DELTA(ic.GetAltitudeASLFtIC(), ic_seq.GetAltitudeASLFtIC(), 1E-8);
+    TS_ASSERT_DELTA(ic.GetLatitudeDegIC(), ic_seq.GetLatitudeDegIC(), 1E-8);
+    TS_ASSERT_DELTA(ic.GetPhiDegIC(), ic_seq.GetPhiDegIC(), 1E-8);
+    TS_ASSERT_DELTA(ic.GetThetaDegIC(), ic_seq.GetThetaDegIC(), 1E-8);
+    TS_ASSERT_DELTA(ic.GetPsiDegIC(), ic_seq.GetPsiDegIC(), 1E-8);
+    TS_ASSERT_DELTA(ic.GetVcalibratedKtsIC(), ic_seq.GetVcalibratedKtsIC(),
+                    1E-8);
+    TS_ASSERT_DELTA(ic.GetVtrueFpsIC(), ic_seq.GetVtrueFpsIC(), 1E-8);
+    TS_ASSERT_DELTA(ic.GetFlightPathAngleDegIC(), ic_seq.GetFlightPathAngleDegIC(),
+                    1E-8);
+    TS_ASSERT_DELTA(ic.GetAlphaDegIC(), ic_seq.GetAlphaDegIC(), 1E-8);
+    TS_ASSERT_DELTA(ic.GetBetaDegIC(), ic_seq.GetBetaDegIC(), 1E-8);
+    TS_ASSERT_DELTA(ic.GetVcalibratedKtsIC(), 120.0, 1E-8);
+    TS_ASSERT_DELTA(ic.GetFlightPathAngleDegIC(), 3.0, 1E-8);
+
+    // Committing without a pending batch is a no-op and the setters apply
+    // their value immediately once the batch is committed.
+    double altitude = ic.GetAltitudeASLFtIC();
+    ic.CommitUpdate();
+    TS_ASSERT_EQUALS(ic.GetAltitudeASLFtIC(), altitude);
+    ic.SetAltitudeASLFtIC(5000.0);
+    TS_ASSERT_DELTA(ic.GetAltitudeASLFtIC(), 5000.0, 1E-8);
+  }
+
+  void testBatchUpdateVelocities() {
+    FGFDMExec fdmex;
+    FGInitialCondition ic(&fdmex);
+
+    // The last group of velocity components set is the only one applied.
+    ic.BeginUpdate();
+    ic.SetVNorthFpsIC(50.0);
+    ic.SetUBodyFpsIC(100.0);
+    ic.SetWBodyFpsIC(10.0);
+    ic.CommitUpdate();
+    TS_ASSERT_DELTA(ic.GetUBodyFpsIC(), 100.0, epsilon);
+    TS_ASSERT_DELTA(ic.GetVBodyFpsIC(), 0.0, epsilon);
+    TS_ASSERT_DELTA(ic.GetWBodyFpsIC(), 10.0, epsilon);
+
+    ic.BeginUpdate();
+    ic.SetUBodyFpsIC(20.0);
+    ic.SetVgroundFpsIC(80.0);
+    ic.CommitUpdate();
+    TS_ASSERT_DELTA(ic.GetVgroundFpsIC(), 80.0, epsilon);
+    TS_ASSERT_DELTA(ic.GetVDownFpsIC(), 0.0, epsilon);
+
+    // The airspeed gives the magnitude of the velocity set by the components
+    // whatever the order in which they are set.
+    ic.BeginUpdate();
+    ic.SetVtrueFpsIC(200.0);
+    ic.SetUBodyFpsIC(30.0);
+    ic.SetWBodyFpsIC(40.0);
+    ic.CommitUpdate();
+    TS_ASSERT_DELTA(ic.GetVtrueFpsIC(), 200.0, epsilon);
+    TS_ASSERT_DELTA(ic.GetUBodyFpsIC(), 120.0, 1E-8);
+    TS_ASSERT_DELTA(ic.GetVBodyFpsIC(), 0.0, epsilon);
+    TS_ASSERT_DELTA(ic.GetWBodyFpsIC(), 160.0, 1E-8);
+  }
+
+  void testBatchUpdateWind() {
+    FGFDMExec fdmex;
+    FGInitialCondition ic_seq(&fdmex), ic(&fdmex);
+
+    ic_seq.SetVtrueFpsIC(150.0);
+    ic_seq.SetPsiDegIC(45.0);
+    ic.SetVtrueFpsIC(150.0);
+    ic.SetPsiDegIC(45.0);
+
+    // The wind values are applied in the order in which they are set.
+    ic_seq.SetWindMagKtsIC(10.0);
+    ic_seq.SetWindDirDegIC(30.0);
+    ic_seq.SetCrossWindKtsIC(5.0);
+    ic_seq.SetWindDownKtsIC(2.0);
+    ic_seq.SetWindMagKtsIC(12.0);
+
+    ic.BeginUpdate();
+    ic.SetWindNEDFpsIC(1.0, 2.0, 3.0); // Discarded by the values below
+    ic.SetWindMagKtsIC(10.0);
+    ic.SetWindDirDegIC(30.0);
+    ic.SetCrossWindKtsIC(5.0);
+    ic.SetWindDownKtsIC(2.0);
+    ic.SetWindMagKtsIC(12.0);
+    ic.CommitUpdate();
+
+    FGColumnVector3 wind = ic.GetWindNEDFpsIC();
+    FGColumnVector3 wind_seq = ic_seq.GetWindNEDFpsIC();
+    for (int i=1; i <= 3; i++)
+      TS_ASSERT_DELTA(wind(i), wind_seq(i), 1E-8);
+    TS_ASSERT_DELTA(ic.GetWindMagFpsIC(), 12.0*ktstofps, 1E-8);
+    TS_ASSERT_DELTA(ic.GetVtrueFpsIC(), ic_seq.GetVtrueFpsIC(), 1E-8);
+    TS_ASSERT_DELTA(ic.GetAlphaDegIC(), ic_seq.GetAlphaDegIC(), 1E-8);
+    TS_ASSERT_DELTA(ic.GetBetaDegIC(), ic_seq.GetBetaDegIC(), 1E-8);
+
+    // The NED wind discards the wind values set before it.
+    ic.BeginUpdate();
+    ic.SetHeadWindKtsIC(20.0);
+    ic.SetWindNEDFpsIC(1.0, 2.0, 3.0);
+    ic.SetWindDownKtsIC(0.0);
+    ic.CommitUpdate();
+    TS_ASSERT_VECTOR_EQUALS(ic.GetWindNEDFpsIC(), FGColumnVector3(1.0, 2.0, 0.0));
+  }
+
+  void testBatchUpdatePosition() {
+    FGFDMExec fdmex;
+    FGInitialCondition ic_seq(&fdmex), ic(&fdmex);
+
+    ic_seq.SetMachIC(0.5);
+    ic.SetMachIC(0.5);
+
+    ic_seq.SetTerrainElevationFtIC(500.0);
+    ic_seq.SetAltitudeAGLFtIC(2000.0);
+    ic_seq.SetLongitudeDegIC(10.0);
+    ic_seq.SetGeodLatitudeDegIC(60.0);
+
+    // The position is solved once and the Mach number is kept.
+    ic.BeginUpdate();
+    ic.SetGeodLatitudeDegIC(60.0);
+    ic.SetAltitudeAGLFtIC(2000.0);
+    ic.SetLongitudeDegIC(10.0);
+    ic.SetTerrainElevationFtIC(500.0);
+    ic.CommitUpdate();
+    TS_ASSERT_DELTA(ic.GetLongitudeDegIC(), 10.0, epsilon);
+    TS_ASSERT_DELTA(ic.GetGeodLatitudeDegIC(), 60.0, epsilon);
+    TS_ASSERT_DELTA(ic.GetAltitudeAGLFtIC(), 2000.0, 1E-8);
+    TS_ASSERT_DELTA(ic.GetAltitudeASLFtIC(), ic_seq.GetAltitudeASLFtIC(), 1E-8);
+    // The sequential setters keep the true airspeed once the altitude has been
+    // set so the Mach number drifts when the position is modified afterwards.
+    TS_ASSERT_DELTA(ic.GetMachIC(), 0.5, epsilon);
+    TS_ASSERT_DELTA(ic_seq.GetMachIC(), 0.5, 1E-6);
+  }
+
+  void testCopyPendingBatch() {
+    FGFDMExec fdmex;
+    FGInitialCondition ic(&fdmex), copy(&fdmex);
+
+    ic.BeginUpdate();
+    ic.SetAltitudeASLFtIC(1000.0);
+    ic.SetWindMagKtsIC(10.0);
+
+    // The pending batch is copied and applied when the copy commits it.
+    copy.CopyFrom(ic);
+    TS_ASSERT(copy.IsUpdating());
+    TS_ASSERT_EQUALS(copy.GetAltitudeASLFtIC(), 0.0);
+    copy.CommitUpdate();
+    TS_ASSERT_DELTA(copy.GetAltitudeASLFtIC(), 1000.0, 1E-8);
+    TS_ASSERT_DELTA(copy.GetWindMagFpsIC(), 10.0*ktstofps, 1E-8);
+
+    // The original batch is left pending.
+    TS_ASSERT(ic.IsUpdating());
+    TS_ASSERT_EQUALS(ic.GetAltitudeASLFtIC(), 0.0);
+  }
 };
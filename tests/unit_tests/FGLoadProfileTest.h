@@ -0,0 +1,65 @@
+#include <sstream>
+
+#include <cxxtest/TestSuite.h>
+#include <input_output/FGLoadProfile.h>
+
+using namespace JSBSim;
+
+class FGLoadProfileTest : public CxxTest::TestSuite
+{
+public:
+  void testDisabled() {
+    FGLoadProfile profile;
+    std::ostringstream report;
+
+    TS_ASSERT(!profile.IsEnabled());
+    {
+      FGLoadProfile::Scope scope(&profile, "phase");
+    }
+    profile.WriteChromeTrace(report);
+    TS_ASSERT_EQUALS(report.str().find("phase"), std::string::npos);
+  }
+
+  void testNesting() {
+    FGLoadProfile profile;
+    profile.Enable(true);
+    {
+      FGLoadProfile::Scope outer(&profile, "outer");
+      {
+        FGLoadProfile::Scope inner(&profile, "axis ", "LIFT");
+      }
+    }
+
+    std::ostringstream report;
+    profile.PrintReport(report);
+    std::string text = report.str();
+    size_t outer = text.find("%  outer");
+    size_t inner = text.find("%    axis LIFT");
+    TS_ASSERT_DIFFERS(outer, std::string::npos);
+    TS_ASSERT_DIFFERS(inner, std::string::npos);
+    TS_ASSERT_LESS_THAN(outer, inner);
+    TS_ASSERT_DIFFERS(text.find("total"), std::string::npos);
+
+    profile.Clear();
+    std::ostringstream cleared;
+    profile.PrintReport(cleared);
+    TS_ASSERT_EQUALS(cleared.str().find("outer"), std::string::npos);
+  }
+
+  void testChromeTrace() {
+    FGLoadProfile profile;
+    profile.Enable(true);
+    profile.Begin("read \"c172x\\c172x.xml\"");
+    profile.End();
+    // An unbalanced End() must be ignored.
+    profile.End();
+
+    std::ostringstream trace;
+    profile.WriteChromeTrace(trace);
+    std::string json = trace.str();
+    TS_ASSERT_EQUALS(json.find("{\"traceEvents\":["), 0);
+    TS_ASSERT_DIFFERS(json.find("\"name\":\"read \\\"c172x\\\\c172x.xml\\\"\""),
+                      std::string::npos);
+    TS_ASSERT_DIFFERS(json.find("\"ph\":\"X\""), std::string::npos);
+  }
+};
@@ -2,6 +2,7 @@
 #include <cxxtest/TestSuite.h>
 #include <math/FGLocation.h>
 #include <math/FGQuaternion.h>
+#include <GeographicLib/Geodesic.hpp>
 #include "TestAssertions.h"
 
 const double epsilon = 100. * std::numeric_limits<double>::epsilon();
@@ -524,6 +525,81 @@ public:
     }
   }
 
+  void testGeodeticPrecision() {
+    const double a = 20925646.32546; // WGS84 semimajor axis length in feet
+    const double b = 20855486.5951;  // WGS84 semiminor axis length in feet
+    const GeographicLib::Geodesic geod(a, 1.0 - b/a);
+    JSBSim::FGLocation l;
+
+    l.SetEllipse(a, b);
+
+    // From below the Dead Sea to beyond the geostationary orbit.
+    for (double h: {-3E4, 0.0, 1E3, 1E5, 1E6, 1E7, 1.4E8}) {
+      for (int ilat=-180; ilat <= 180; ilat++) {
+        double glat = ilat*M_PI/360.0;
+        double lon = 0.3;
+        l.SetPositionGeodetic(lon, glat, h);
+
+        double dlat = l.GetGeodLatitudeRad() - glat;
+        TS_ASSERT_DELTA(0.0, dlat, 1E-11);
+        TS_ASSERT_DELTA(h, l.GetGeodAltitude(), 1E-6);
+        TS_ASSERT_DELTA(lon, l.GetLongitude(), epsilon);
+
+        // Horizontal error measured along the ellipsoid.
+        GeographicLib::Math::real distance;
+        geod.Inverse(glat*180.0/M_PI, lon*180.0/M_PI,
+                     l.GetGeodLatitudeDeg(), l.GetLongitudeDeg(), distance);
+        TS_ASSERT_DELTA(0.0, distance, 1E-3);
+      }
+    }
+  }
+
+  void testPartialCache() {
+    const double a = 20925646.32546; // WGS84 semimajor axis length in feet
+    const double b = 20855486.5951;  // WGS84 semiminor axis length in feet
+    JSBSim::FGLocation l;
+
+    l.SetEllipse(a, b);
+    l.SetPositionGeodetic(-2.1, 0.7, 1234.5);
+
+    // Values read before the transformation matrices are computed must be
+    // identical to the cached ones.
+    double radius = l.GetRadius();
+    double lon = l.GetLongitude();
+    double lat = l.GetLatitude();
+    double sinLon = l.GetSinLongitude();
+    double cosLon = l.GetCosLongitude();
+    double glat = l.GetGeodLatitudeRad();
+    double alt = l.GetGeodAltitude();
+
+    // A copy made before the matrices are computed must compute them.
+    JSBSim::FGLocation l2(l);
+    JSBSim::FGLocation l3;
+    l3 = l;
+
+    JSBSim::FGMatrix33 Tec2l = l.GetTec2l();
+    TS_ASSERT_EQUALS(radius, l.GetRadius());
+    TS_ASSERT_EQUALS(lon, l.GetLongitude());
+    TS_ASSERT_EQUALS(lat, l.GetLatitude());
+    TS_ASSERT_EQUALS(sinLon, l.GetSinLongitude());
+    TS_ASSERT_EQUALS(cosLon, l.GetCosLongitude());
+    TS_ASSERT_EQUALS(glat, l.GetGeodLatitudeRad());
+    TS_ASSERT_EQUALS(alt, l.GetGeodAltitude());
+    TS_ASSERT_MATRIX_EQUALS(Tec2l, l2.GetTec2l());
+    TS_ASSERT_MATRIX_EQUALS(Tec2l, l3.GetTec2l());
+    TS_ASSERT_EQUALS(glat, l2.GetGeodLatitudeRad());
+    TS_ASSERT_EQUALS(alt, l3.GetGeodAltitude());
+
+    // Moving the location invalidates all the cached values.
+    l(3) += 1000.0;
+    TS_ASSERT_DIFFERS(radius, l.GetRadius());
+    TS_ASSERT_DIFFERS(lat, l.GetLatitude());
+    TS_ASSERT_DIFFERS(glat, l.GetGeodLatitudeRad());
+    TS_ASSERT_DIFFERS(alt, l.GetGeodAltitude());
+    TS_ASSERT_EQUALS(lon, l.GetLongitude());
+    TS_ASSERT_DIFFERS(Tec2l(1,1), l.GetTec2l()(1,1));
+  }
+
   void testPoles() {
     JSBSim::FGColumnVector3 v(0.0, 0.0, 1.0); // North pole
     JSBSim::FGLocation l(v);
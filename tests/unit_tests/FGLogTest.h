@@ -338,6 +338,23 @@ void testMinLevel() {
   TS_ASSERT_EQUALS(buffer.str(), "INFO");
 }
 
+void testMinLevelFormat() {
+  auto logger = std::make_shared<JSBSim::FGLogConsole>();
+  logger->SetMinLevel(JSBSim::LogLevel::ERROR);
+  std::ostringstream buffer;
+  auto cout_buffer = std::cout.rdbuf();
+  std::cout.rdbuf(buffer.rdbuf());
+  JSBSim::Element el("element");
+  el.SetFileName("name.xml");
+  el.SetLineNumber(42);
+  {
+    JSBSim::FGXMLLogging log(logger, &el, JSBSim::LogLevel::INFO);
+    log << JSBSim::LogFormat::BOLD << "INFO" << JSBSim::LogFormat::RESET;
+  }
+  std::cout.rdbuf(cout_buffer);
+  TS_ASSERT_EQUALS(buffer.str(), "");
+}
+
 void testRedFormat() {
   auto logger = std::make_shared<JSBSim::FGLogConsole>();
   std::ostringstream buffer;
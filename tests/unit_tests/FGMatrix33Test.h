@@ -248,6 +248,36 @@ public:
     TS_ASSERT_EQUALS(m_res(3,3), 18.0);
   }
 
+  void testProducts() {
+    const JSBSim::FGMatrix33 m(1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0);
+    const JSBSim::FGMatrix33 m2(-2.0, 1.0, 0.5, 3.0, -1.0, 2.0, 0.0, 4.0, -3.0);
+    const JSBSim::FGColumnVector3 v0(1.0, -2.0, 3.0);
+
+    JSBSim::FGColumnVector3 v = m * v0;
+    TS_ASSERT_EQUALS(v, JSBSim::FGColumnVector3(6.0, 12.0, 18.0));
+    v = m.TransposedMultiply(v0);
+    TS_ASSERT_EQUALS(v, JSBSim::FGColumnVector3(14.0, 16.0, 18.0));
+    TS_ASSERT_EQUALS(v, m.Transposed() * v0);
+
+    JSBSim::FGMatrix33 m_res = m * m2;
+    TS_ASSERT_EQUALS(m_res(1,1), 4.0);
+    TS_ASSERT_EQUALS(m_res(1,2), 11.0);
+    TS_ASSERT_EQUALS(m_res(1,3), -4.5);
+    TS_ASSERT_EQUALS(m_res(2,1), 7.0);
+    TS_ASSERT_EQUALS(m_res(2,2), 23.0);
+    TS_ASSERT_EQUALS(m_res(2,3), -6.0);
+    TS_ASSERT_EQUALS(m_res(3,1), 10.0);
+    TS_ASSERT_EQUALS(m_res(3,2), 35.0);
+    TS_ASSERT_EQUALS(m_res(3,3), -7.5);
+    // The product is associative with the matrix vector multiplication
+    TS_ASSERT_EQUALS(m_res * v0, m * (m2 * v0));
+    JSBSim::FGMatrix33 m_prod = m;
+    m_prod *= m2;
+    for (unsigned int i=1; i<=3; i++)
+      for (unsigned int j=1; j<=3; j++)
+        TS_ASSERT_EQUALS(m_prod(i,j), m_res(i,j));
+  }
+
   void testInversion() {
     JSBSim::FGMatrix33 m(1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0);
     JSBSim::FGMatrix33 m_res;
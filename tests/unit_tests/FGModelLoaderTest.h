@@ -0,0 +1,102 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <cxxtest/TestSuite.h>
+#include <FGFDMExec.h>
+#include <input_output/FGModelLoader.h>
+
+using namespace JSBSim;
+
+const std::string aircraft_xml = R"(<?xml version="1.0"?>
+<fdm_config name="prefetch" version="2.0" release="BETA">
+  <metrics>
+    <wingarea unit="FT2"> 1 </wingarea>
+    <wingspan unit="FT"> 1 </wingspan>
+    <chord unit="FT"> 1 </chord>
+  </metrics>
+  <mass_balance>
+    <ixx unit="SLUG*FT2"> 10 </ixx>
+    <iyy unit="SLUG*FT2"> 10 </iyy>
+    <izz unit="SLUG*FT2"> 10 </izz>
+    <emptywt unit="LBS"> 1000 </emptywt>
+    <location name="CG" unit="IN">
+      <x> 0 </x> <y> 0 </y> <z> 0 </z>
+    </location>
+  </mass_balance>
+  <ground_reactions/>
+  <propulsion>
+    <engine file="test_engine">
+      <thruster file="test_thruster">
+        <location unit="IN">
+          <x> 0 </x> <y> 0 </y> <z> 0 </z>
+        </location>
+      </thruster>
+    </engine>
+  </propulsion>
+</fdm_config>
+)";
+
+const std::string engine_xml = R"(<?xml version="1.0"?>
+<electric_engine name="test">
+  <power unit="WATTS"> 1000.0 </power>
+</electric_engine>
+)";
+
+const std::string thruster_xml = R"(<?xml version="1.0"?>
+<direct name="test"/>
+)";
+
+class FGModelLoaderTest : public CxxTest::TestSuite
+{
+public:
+  static void WriteFile(const SGPath& path, const std::string& content) {
+    std::filesystem::create_directories(path.dirPath().utf8Str());
+    std::ofstream file(path.utf8Str());
+    file << content;
+  }
+
+  void testPrefetchFiles() {
+    SGPath root = SGPath::fromUtf8("prefetch_files");
+    WriteFile(root/"a.xml", engine_xml);
+    WriteFile(root/"b.xml", thruster_xml);
+
+    auto documents = PrefetchFiles({root/"a.xml", root/"b.xml", root/"a.xml",
+                                    root/"missing.xml"});
+    TS_ASSERT_EQUALS(documents.size(), 2);
+    TS_ASSERT_EQUALS(documents[(root/"a.xml").utf8Str()]->GetName(),
+                     "electric_engine");
+    TS_ASSERT_EQUALS(documents[(root/"b.xml").utf8Str()]->GetName(), "direct");
+  }
+
+  void testEngineFiles() {
+    SGPath root = SGPath::fromUtf8(std::filesystem::absolute("prefetch_model")
+                                   .string());
+    WriteFile(root/"aircraft"/"prefetch"/"prefetch.xml", aircraft_xml);
+    WriteFile(root/"engine"/"test_engine.xml", engine_xml);
+    WriteFile(root/"engine"/"test_thruster.xml", thruster_xml);
+    // A file with the same name in the aircraft folder is not an engine file.
+    WriteFile(root/"aircraft"/"prefetch"/"test_engine.xml", "<system/>");
+
+    FGFDMExec fdmex;
+    fdmex.SetRootDir(root);
+    fdmex.SetAircraftPath(SGPath("aircraft"));
+    fdmex.SetEnginePath(SGPath("engine"));
+    fdmex.SetSystemsPath(SGPath("systems"));
+    fdmex.GetLoadProfile()->Enable(true);
+    TS_ASSERT(fdmex.LoadModel("prefetch"));
+
+    const std::vector<SGPath>& files = fdmex.GetModelFiles();
+    TS_ASSERT_EQUALS(files.size(), 2);
+    TS_ASSERT_EQUALS(files[0], root/"engine"/"test_engine.xml");
+    TS_ASSERT_EQUALS(files[1], root/"engine"/"test_thruster.xml");
+
+    // The engine and the thruster have been prefetched under the names used
+    // by the loader so they are not read again.
+    std::ostringstream trace;
+    fdmex.GetLoadProfile()->WriteChromeTrace(trace);
+    TS_ASSERT_DIFFERS(trace.str().find("prefetch.xml"), std::string::npos);
+    TS_ASSERT_EQUALS(trace.str().find("test_engine.xml"), std::string::npos);
+    TS_ASSERT_EQUALS(trace.str().find("test_thruster.xml"), std::string::npos);
+  }
+};
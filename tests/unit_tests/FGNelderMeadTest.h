@@ -0,0 +1,138 @@
+#include <cstdlib>
+#include <stdexcept>
+
+#include <cxxtest/TestSuite.h>
+#include <math/FGNelderMead.h>
+
+using namespace JSBSim;
+
+// Rosenbrock function, its minimum is at (1, 1).
+class Rosenbrock : public FGNelderMead::Function
+{
+public:
+  double eval(const std::vector<double>& v) override {
+    evaluations++;
+    double a = 1.0 - v[0];
+    double b = v[1] - v[0]*v[0];
+    return a*a + 100.0*b*b;
+  }
+  unsigned int evaluations = 0;
+};
+
+// Evaluates the batches in the reverse order as a parallel implementation
+// could do.
+class ReversedBatch : public Rosenbrock
+{
+public:
+  void evalBatch(const std::vector<std::vector<double>>& vertices,
+                 std::vector<double>& costs) override {
+    batches++;
+    batchSize = vertices.size();
+    for (size_t i=vertices.size(); i > 0; i--)
+      costs[i-1] = eval(vertices[i-1]);
+  }
+  unsigned int batches = 0;
+  size_t batchSize = 0;
+};
+
+class Recorder : public FGNelderMead::Callback
+{
+public:
+  using FGNelderMead::Callback::eval;
+  void eval(const std::vector<double>& v) override { points.push_back(v); }
+  std::vector<std::vector<double>> points;
+};
+
+// Records the costs given to the callback.
+class CostRecorder : public Recorder
+{
+public:
+  using Recorder::eval;
+  void eval(const std::vector<double>& v, double cost) override {
+    Recorder::eval(v);
+    costs.push_back(cost);
+  }
+  std::vector<double> costs;
+};
+
+class FGNelderMeadTest : public CxxTest::TestSuite
+{
+public:
+  const std::vector<double> guess {-1.0, 2.0};
+  const std::vector<double> lower {-5.0, -5.0};
+  const std::vector<double> upper {5.0, 5.0};
+  const std::vector<double> step {0.5, 0.5};
+
+  int Solve(FGNelderMead::Function* f, Recorder* recorder,
+            double* cost=nullptr, unsigned int seed=1) {
+    FGNelderMead solver(f, guess, lower, upper, step, 2000, 1E-10, 1E-8, 2.0,
+                        0.1, false, false, false, recorder, seed);
+    try {
+      while (solver.status() == 1) solver.update();
+    } catch (const std::runtime_error&) {}
+    if (cost) *cost = solver.getSolutionCost();
+    return solver.status();
+  }
+
+  void testSolution() {
+    Rosenbrock f;
+    Recorder recorder;
+    TS_ASSERT_EQUALS(Solve(&f, &recorder), 0);
+    const std::vector<double>& x = recorder.points.back();
+    TS_ASSERT_DELTA(x[0], 1.0, 1E-4);
+    TS_ASSERT_DELTA(x[1], 1.0, 1E-4);
+  }
+
+  void testBatchEvaluation() {
+    Rosenbrock serial;
+    ReversedBatch batch;
+    Recorder serialPoints, batchPoints;
+
+    Solve(&serial, &serialPoints);
+    Solve(&batch, &batchPoints);
+
+    // The vertices of the simplex are evaluated as a batch at each update.
+    TS_ASSERT_EQUALS(batch.batches, batchPoints.points.size());
+    TS_ASSERT_EQUALS(batch.batchSize, guess.size()+1);
+    TS_ASSERT_EQUALS(batch.evaluations, serial.evaluations);
+
+    // The order of the evaluations does not modify the accepted points.
+    TS_ASSERT_EQUALS(batchPoints.points.size(), serialPoints.points.size());
+    for (size_t i=0; i < serialPoints.points.size(); i++) {
+      TS_ASSERT_EQUALS(batchPoints.points[i][0], serialPoints.points[i][0]);
+      TS_ASSERT_EQUALS(batchPoints.points[i][1], serialPoints.points[i][1]);
+    }
+  }
+
+  void testCallbackCost() {
+    Rosenbrock f, check;
+    CostRecorder recorder;
+    double cost;
+    TS_ASSERT_EQUALS(Solve(&f, &recorder, &cost), 0);
+
+    // The callback is given the cost of the best vertex without evaluating it
+    // again.
+    TS_ASSERT_EQUALS(recorder.costs.size(), recorder.points.size());
+    for (size_t i=0; i < recorder.points.size(); i++)
+      TS_ASSERT_EQUALS(recorder.costs[i], check.eval(recorder.points[i]));
+    TS_ASSERT_EQUALS(cost, recorder.costs.back());
+    TS_ASSERT_LESS_THAN(cost, 1E-8);
+  }
+
+  void testSeed() {
+    Rosenbrock f;
+    Recorder first, second, other;
+
+    Solve(&f, &first, nullptr, 1);
+    Solve(&f, &second, nullptr, 1);
+    Solve(&f, &other, nullptr, 2);
+
+    // The random factors only depend on the seed.
+    TS_ASSERT_EQUALS(first.points.size(), second.points.size());
+    for (size_t i=0; i < first.points.size(); i++) {
+      TS_ASSERT_EQUALS(first.points[i][0], second.points[i][0]);
+      TS_ASSERT_EQUALS(first.points[i][1], second.points[i][1]);
+    }
+    TS_ASSERT(first.points != other.points);
+  }
+};
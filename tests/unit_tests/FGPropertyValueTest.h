@@ -1,5 +1,6 @@
 #include <cxxtest/TestSuite.h>
 #include <math/FGPropertyValue.h>
+#include <math/FGRealValue.h>
 
 using namespace JSBSim;
 
@@ -139,4 +140,29 @@ public:
     node->setDoubleValue(1.234);
     TS_ASSERT_EQUALS(property.GetValue(), -1.234);
   }
+
+  void testGetDerivative() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    FGPropertyValue property("-x", pm, nullptr);
+    auto x = pm->GetNode("x", true);
+    auto y = pm->GetNode("y", true);
+    FGPropertyValue y_value(y);
+    FGRealValue constant(2.0);
+    FGDerivativeSeeds seeds;
+
+    // The properties that are not seeded are held constant.
+    TS_ASSERT_EQUALS(property.GetDerivative(seeds), 0.0);
+    seeds.SetSeed(x, 1.5);
+    TS_ASSERT_EQUALS(property.GetDerivative(seeds), -1.5);
+
+    // The derivative of a property computed by a function is the derivative of
+    // the function.
+    seeds.AddFunction(y, &property);
+    TS_ASSERT_EQUALS(y_value.GetDerivative(seeds), -1.5);
+    seeds.AddFunction(y, &constant);
+    TS_ASSERT_EQUALS(y_value.GetDerivative(seeds), 0.0);
+    // A seed overrides the function.
+    seeds.SetSeed(y, 3.0);
+    TS_ASSERT_EQUALS(y_value.GetDerivative(seeds), 3.0);
+  }
 };
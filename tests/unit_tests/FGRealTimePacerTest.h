@@ -0,0 +1,201 @@
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+#include <cxxtest/TestSuite.h>
+#include <input_output/FGRealTimePacer.h>
+#include <input_output/FGPropertyManager.h>
+
+using namespace JSBSim;
+
+static double WallTime(void)
+{
+  using namespace std::chrono;
+  return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+class FGRealTimePacerTest : public CxxTest::TestSuite
+{
+public:
+  void testDefaults() {
+    FGRealTimePacer pacer;
+    TS_ASSERT_EQUALS(pacer.GetTimeAcceleration(), 1.0);
+    TS_ASSERT_EQUALS(pacer.GetSpinThreshold(), 1E-3);
+    TS_ASSERT_EQUALS(pacer.GetFrames(), 0);
+    TS_ASSERT_EQUALS(pacer.GetElapsedTime(), 0.0);
+
+    pacer.SetTimeAcceleration(-1.0);
+    TS_ASSERT_EQUALS(pacer.GetTimeAcceleration(), 0.0);
+    pacer.SetSpinThreshold(-1.0);
+    TS_ASSERT_EQUALS(pacer.GetSpinThreshold(), 0.0);
+  }
+
+  void testAsFastAsPossible() {
+    FGRealTimePacer pacer;
+    pacer.SetTimeAcceleration(0.0);
+    pacer.Start(0.0);
+
+    double start = WallTime();
+    for (int i=1; i<=100; i++)
+      pacer.Pace(i*1.0);
+
+    TS_ASSERT_LESS_THAN(WallTime() - start, 1.0);
+    TS_ASSERT_EQUALS(pacer.GetFrames(), 100);
+    TS_ASSERT_EQUALS(pacer.GetOverruns(), 0);
+    TS_ASSERT_EQUALS(pacer.GetMaxJitter(), 0.0);
+  }
+
+  void testPacing() {
+    const double dt = 0.005;
+    FGRealTimePacer pacer;
+    pacer.Start(0.0);
+
+    double start = WallTime();
+    for (int i=1; i<=20; i++)
+      pacer.Pace(i*dt);
+
+    TS_ASSERT_LESS_THAN_EQUALS(20*dt, WallTime() - start);
+    TS_ASSERT_LESS_THAN_EQUALS(20*dt, pacer.GetElapsedTime());
+    TS_ASSERT_EQUALS(pacer.GetFrames(), 20);
+    TS_ASSERT_LESS_THAN_EQUALS(0.0, pacer.GetMeanJitter());
+    TS_ASSERT_LESS_THAN_EQUALS(pacer.GetMeanJitter(), pacer.GetMaxJitter());
+  }
+
+  void testAcceleration() {
+    const double dt = 0.01;
+    FGRealTimePacer pacer;
+    pacer.SetTimeAcceleration(10.0);
+    pacer.SetSpinThreshold(0.0);
+    pacer.Start(0.0);
+
+    double start = WallTime();
+    for (int i=1; i<=20; i++)
+      pacer.Pace(i*dt);
+
+    double elapsed = WallTime() - start;
+    TS_ASSERT_LESS_THAN_EQUALS(20*dt/10.0, elapsed);
+    TS_ASSERT_LESS_THAN(elapsed, 20*dt);
+  }
+
+  void testOverrun() {
+    const double dt = 0.01;
+    FGRealTimePacer pacer;
+    pacer.Start(0.0);
+    pacer.Pace(dt);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    pacer.Pace(2*dt);
+
+    TS_ASSERT_LESS_THAN_EQUALS(1, pacer.GetOverruns());
+    TS_ASSERT_LESS_THAN_EQUALS(0.05, pacer.GetWorstFrame());
+    TS_ASSERT_EQUALS(pacer.GetWorstFrameTime(), 2*dt);
+    TS_ASSERT_LESS_THAN_EQUALS(0.04, pacer.GetMaxLateness());
+
+    // The next frames are run without waiting until the simulation has caught
+    // up with the wall clock.
+    double start = WallTime();
+    pacer.Pace(3*dt);
+    TS_ASSERT_LESS_THAN(WallTime() - start, dt);
+  }
+
+  void testReset() {
+    FGRealTimePacer pacer;
+    pacer.Start(10.0);
+    pacer.Pace(10.001);
+    TS_ASSERT_EQUALS(pacer.GetFrames(), 1);
+
+    // The simulation time went backward: the deadlines are computed again.
+    double start = WallTime();
+    pacer.Pace(0.0);
+    TS_ASSERT_LESS_THAN(WallTime() - start, 0.5);
+    TS_ASSERT_EQUALS(pacer.GetFrames(), 1);
+
+    pacer.Restart();
+    pacer.Pace(5.0);
+    TS_ASSERT_EQUALS(pacer.GetFrames(), 1);
+    pacer.Pace(5.05);
+    TS_ASSERT_EQUALS(pacer.GetFrames(), 2);
+    TS_ASSERT_EQUALS(pacer.GetOverruns(), 0);
+  }
+
+  void testPause() {
+    FGRealTimePacer pacer;
+    pacer.Start(0.0);
+    pacer.Pause();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    double elapsed = pacer.GetElapsedTime();
+    TS_ASSERT_LESS_THAN(elapsed, 0.1);
+    pacer.Resume();
+
+    // The pause does not count as an overrun. The frames are long enough for
+    // a loaded machine not to overrun them.
+    pacer.Pace(0.15);
+    TS_ASSERT_EQUALS(pacer.GetOverruns(), 0);
+    TS_ASSERT_LESS_THAN(pacer.GetWorstFrame(), 0.1);
+  }
+
+  void testHold() {
+    const double dt = 0.001;
+    FGRealTimePacer pacer;
+    pacer.Start(0.0);
+    pacer.Pace(dt);
+
+    // The frames run on hold do not advance the simulation time: they are
+    // neither counted nor paced.
+    double start = WallTime();
+    while (WallTime() - start < 0.2)
+      pacer.Pace(dt);
+    TS_ASSERT_EQUALS(pacer.GetFrames(), 1);
+    TS_ASSERT_EQUALS(pacer.GetOverruns(), 0);
+    TS_ASSERT_EQUALS(pacer.GetMaxLateness(), 0.0);
+
+    // The hold does not count as an overrun either. The frame is long enough
+    // for a loaded machine not to overrun it.
+    pacer.Pace(dt + 0.15);
+    TS_ASSERT_EQUALS(pacer.GetFrames(), 2);
+    TS_ASSERT_EQUALS(pacer.GetOverruns(), 0);
+    TS_ASSERT_LESS_THAN(pacer.GetWorstFrame(), 0.1);
+  }
+
+  void testProperties() {
+    FGPropertyManager pm;
+    FGRealTimePacer pacer;
+    pacer.Bind(&pm);
+
+    auto acceleration = pm.GetNode("simulation/realtime/acceleration");
+    TS_ASSERT_EQUALS(acceleration->getDoubleValue(), 1.0);
+    acceleration->setDoubleValue(2.0);
+    TS_ASSERT_EQUALS(pacer.GetTimeAcceleration(), 2.0);
+
+    pm.GetNode("simulation/realtime/spin-threshold-sec")->setDoubleValue(0.0);
+    TS_ASSERT_EQUALS(pacer.GetSpinThreshold(), 0.0);
+
+    pacer.SetTimeAcceleration(0.0);
+    pacer.Start(0.0);
+    pacer.Pace(1.0);
+    pacer.Pace(2.0);
+    TS_ASSERT_EQUALS(pm.GetNode("simulation/realtime/frames")->getIntValue(), 2);
+    TS_ASSERT_EQUALS(pm.GetNode("simulation/realtime/overruns")->getIntValue(), 0);
+    TS_ASSERT(pm.HasNode("simulation/realtime/jitter-max-sec"));
+    TS_ASSERT(pm.HasNode("simulation/realtime/worst-frame-time-sec"));
+
+    // The statistics are read only.
+    auto frames = pm.GetNode("simulation/realtime/frames");
+    frames->setIntValue(10);
+    TS_ASSERT_EQUALS(pacer.GetFrames(), 2);
+  }
+
+  void testReport() {
+    FGRealTimePacer pacer;
+    pacer.SetTimeAcceleration(0.0);
+    pacer.Start(0.0);
+    pacer.Pace(1.0);
+
+    std::ostringstream report;
+    pacer.PrintReport(report);
+    std::string text = report.str();
+    TS_ASSERT_DIFFERS(text.find("as fast as possible"), std::string::npos);
+    TS_ASSERT_DIFFERS(text.find("frames:             1"), std::string::npos);
+    TS_ASSERT_DIFFERS(text.find("overruns:           0"), std::string::npos);
+  }
+};
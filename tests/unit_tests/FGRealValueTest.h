@@ -13,5 +13,6 @@ public:
     TS_ASSERT_EQUALS(x.GetValue(), 1.0);
     TS_ASSERT_EQUALS(x.GetName(), "constant value 1.000000");
     TS_ASSERT(x.IsConstant());
+    TS_ASSERT_EQUALS(x.GetDerivative(FGDerivativeSeeds()), 0.0);
   }
 };
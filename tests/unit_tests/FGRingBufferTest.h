@@ -0,0 +1,71 @@
+#include <cxxtest/TestSuite.h>
+#include <math/FGColumnVector3.h>
+#include <math/FGRingBuffer.h>
+
+using namespace JSBSim;
+
+
+class FGRingBufferTest : public CxxTest::TestSuite
+{
+public:
+  void testConstructor() {
+    FGRingBuffer<double, 3> x(1.0);
+
+    TS_ASSERT_EQUALS(x.size(), 3);
+    for (unsigned int i=0; i<x.size(); ++i)
+      TS_ASSERT_EQUALS(x[i], 1.0);
+
+    FGRingBuffer<FGColumnVector3, 2> v;
+
+    for (unsigned int i=0; i<v.size(); ++i)
+      TS_ASSERT_EQUALS(v[i], FGColumnVector3(0.0, 0.0, 0.0));
+  }
+
+  void testPush() {
+    FGRingBuffer<double, 3> x(0.0);
+
+    x.Push(1.0);
+    TS_ASSERT_EQUALS(x[0], 1.0);
+    TS_ASSERT_EQUALS(x[1], 0.0);
+    TS_ASSERT_EQUALS(x[2], 0.0);
+
+    // Wrap around the storage several times
+    for (unsigned int i=2; i<=10; ++i) {
+      x.Push(i);
+      TS_ASSERT_EQUALS(x[0], i);
+      TS_ASSERT_EQUALS(x[1], i-1.0);
+      TS_ASSERT_EQUALS(x[2], i == 2 ? 0.0 : i-2.0);
+    }
+  }
+
+  void testFill() {
+    FGRingBuffer<double, 4> x(0.0);
+
+    x.Push(1.0);
+    x.Push(2.0);
+    x.Fill(-1.0);
+    for (unsigned int i=0; i<x.size(); ++i)
+      TS_ASSERT_EQUALS(x[i], -1.0);
+
+    x.Push(3.0);
+    TS_ASSERT_EQUALS(x[0], 3.0);
+    TS_ASSERT_EQUALS(x[1], -1.0);
+    TS_ASSERT_EQUALS(x[3], -1.0);
+  }
+
+  void testCopy() {
+    FGRingBuffer<double, 3> x(0.0);
+    x.Push(1.0);
+    x.Push(2.0);
+
+    FGRingBuffer<double, 3> y = x;
+    x.Push(3.0);
+
+    // The copy is independent from the original
+    TS_ASSERT_EQUALS(y[0], 2.0);
+    TS_ASSERT_EQUALS(y[1], 1.0);
+    TS_ASSERT_EQUALS(y[2], 0.0);
+    TS_ASSERT_EQUALS(x[0], 3.0);
+    TS_ASSERT_EQUALS(x[2], 1.0);
+  }
+};
@@ -3,6 +3,7 @@
 
 #include <cxxtest/TestSuite.h>
 #include <math/FGTable.h>
+#include <input_output/string_utilities.h>
 #include "TestUtilities.h"
 
 const double epsilon = 100. * std::numeric_limits<double>::epsilon();
@@ -46,6 +47,21 @@ public:
     TS_ASSERT_EQUALS(t2.GetElement(2,1), 1.5);
   }
 
+  void testPopulateFromStream() {
+    FGTable t(2);
+    std::istringstream data("1.0 -1.0\n  2.0\t1.5\n");
+    t << data;
+    TS_ASSERT_EQUALS(t.GetNumRows(), 2);
+    TS_ASSERT_EQUALS(t(1,0), 1.0);
+    TS_ASSERT_EQUALS(t(1,1), -1.0);
+    TS_ASSERT_EQUALS(t(2,0), 2.0);
+    TS_ASSERT_EQUALS(t(2,1), 1.5);
+
+    FGTable t_bad(2);
+    std::istringstream bad_data("1.0 -1.0\n2.0.1 1.5\n");
+    TS_ASSERT_THROWS(t_bad << bad_data, InvalidNumber&);
+  }
+
   void testCopyConstructor() {
     FGTable t(2);
     t << 1.0 << -1.0
@@ -121,6 +137,37 @@ public:
     TS_ASSERT_EQUALS(t.GetValue(),  1.5);
   }
 
+  void testGetDerivative() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto node = pm->GetNode("x", true);
+    FGTable t(2);
+    t << 1.0 << -1.0
+      << 2.0 << 1.5;
+    t.SetRowIndexProperty(node);
+
+    TS_ASSERT_EQUALS(t.GetSlope(0.3), 0.0);  // Saturated value
+    TS_ASSERT_EQUALS(t.GetSlope(1.0), 0.0);  // Saturated value
+    TS_ASSERT_EQUALS(t.GetSlope(1.5), 2.5);  // Interpolation
+    TS_ASSERT_EQUALS(t.GetSlope(2.0), 0.0);  // Saturated value
+
+    // The slope at an inner breakpoint is the mean of the slopes on each side
+    FGTable v(3);
+    v << -1.0 << 2.0
+      <<  0.0 << 0.0
+      <<  2.0 << 1.0;
+    TS_ASSERT_EQUALS(v.GetSlope(-0.5), -2.0);
+    TS_ASSERT_EQUALS(v.GetSlope(0.0), -0.75);
+    TS_ASSERT_EQUALS(v.GetSlope(1.0), 0.5);
+
+    FGDerivativeSeeds seeds;
+    node->setDoubleValue(1.5);
+    TS_ASSERT_EQUALS(t.GetDerivative(seeds), 0.0); // x is held constant
+    seeds.SetSeed(node, 2.0);
+    TS_ASSERT_EQUALS(t.GetDerivative(seeds), 5.0);
+    node->setDoubleValue(2.47);
+    TS_ASSERT_EQUALS(t.GetDerivative(seeds), 0.0);
+  }
+
   void testMinValue() {
     FGTable t1(1);
     t1 << 0.0 << 1.0;
@@ -384,6 +431,23 @@ public:
 
     TS_ASSERT_THROWS(FGTable t_3x1(pm, el_table), BaseException&);
   }
+
+  void testInvalidNumber() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    // FGTable expects <table> to be the child of another XML element, hence the
+    // <dummy> element.
+    Element_ptr elm = readFromXML("<dummy>"
+                                  "  <table name=\"test2\" type=\"internal\">"
+                                  "    <tableData>"
+                                  "      1.0  1.0\n"
+                                  "      2.0.1  0.5\n"
+                                  "    </tableData>"
+                                  "  </table>"
+                                  "</dummy>");
+    Element *el_table = elm->FindElement("table");
+
+    TS_ASSERT_THROWS(FGTable t_2x1(pm, el_table), InvalidNumber&);
+  }
 };
 
 
@@ -687,6 +751,54 @@ public:
     TS_ASSERT_EQUALS(t_2x2.GetValue(), 0.5);
   }
 
+  void testGetDerivative() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto row = pm->GetNode("x", true);
+    auto column = pm->GetNode("y", true);
+    FGTable t_2x2(2,2);
+    double dRow, dCol;
+
+    t_2x2 << 0.0 << 1.0
+          << 2.0 << 3.0 << -2.0
+          << 4.0 << -1.0 << 0.5;
+    t_2x2.SetColumnIndexProperty(column);
+    t_2x2.SetRowIndexProperty(row);
+
+    t_2x2.GetGradient(3.0, 0.5, dRow, dCol);
+    TS_ASSERT_EQUALS(dRow, -0.375);
+    TS_ASSERT_EQUALS(dCol, -1.75);
+    t_2x2.GetGradient(5.0, 0.5, dRow, dCol); // Saturated row
+    TS_ASSERT_EQUALS(dRow, 0.0);
+    TS_ASSERT_EQUALS(dCol, 1.5);
+    t_2x2.GetGradient(3.0, 2.0, dRow, dCol); // Saturated column
+    TS_ASSERT_EQUALS(dRow, 1.25);
+    TS_ASSERT_EQUALS(dCol, 0.0);
+
+    // At an inner breakpoint, the derivatives are the mean of the slopes on
+    // each side.
+    FGTable t_3x3(3,3);
+    t_3x3 << -1.0 << 0.0 << 1.0
+          << 0.0 << 1.0 << 0.0 << 2.0
+          << 1.0 << 0.0 << 0.0 << 0.0
+          << 3.0 << 4.0 << 2.0 << 0.0;
+    t_3x3.GetGradient(1.0, 0.0, dRow, dCol);
+    TS_ASSERT_EQUALS(dRow, 0.5*(0.0+1.0));
+    TS_ASSERT_EQUALS(dCol, 0.0);
+    t_3x3.GetGradient(2.0, 0.0, dRow, dCol);
+    TS_ASSERT_EQUALS(dRow, 1.0);
+    TS_ASSERT_EQUALS(dCol, -1.0);
+    t_3x3.GetGradient(0.5, 0.0, dRow, dCol);
+    TS_ASSERT_EQUALS(dRow, 0.0);
+    TS_ASSERT_EQUALS(dCol, 0.5*(-0.5+1.0));
+
+    FGDerivativeSeeds seeds;
+    seeds.SetSeed(row, 1.0);
+    seeds.SetSeed(column, -2.0);
+    row->setDoubleValue(3.0);
+    column->setDoubleValue(0.5);
+    TS_ASSERT_EQUALS(t_2x2.GetDerivative(seeds), -0.375+3.5);
+  }
+
   void testLoadInternalFromXML() {
     auto pm = std::make_shared<FGPropertyManager>();
     // FGTable expects <table> to be the child of another XML element, hence the
@@ -1404,6 +1516,47 @@ public:
     // `ref` was destroyed.
     TS_ASSERT_EQUALS(output->getDoubleValue(), 0.3125);
   }
+
+  void testGetGradient() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    Element_ptr elm = readFromXML("<dummy>"
+                                  "  <table>"
+                                  "    <independentVar lookup=\"row\">x</independentVar>"
+                                  "    <independentVar lookup=\"column\">y</independentVar>"
+                                  "    <independentVar lookup=\"table\">z</independentVar>"
+                                  "    <tableData breakPoint=\"-1.0\">"
+                                  "            0.0  1.0\n"
+                                  "      0.0   0.0  1.0\n"
+                                  "      1.0   0.0  1.0\n"
+                                  "    </tableData>"
+                                  "    <tableData breakPoint=\"0.0\">"
+                                  "            0.0  1.0\n"
+                                  "      0.0   2.0  3.0\n"
+                                  "      1.0   2.0  3.0\n"
+                                  "    </tableData>"
+                                  "    <tableData breakPoint=\"2.0\">"
+                                  "            0.0  1.0\n"
+                                  "      0.0   3.0  4.0\n"
+                                  "      1.0   3.0  4.0\n"
+                                  "    </tableData>"
+                                  "  </table>"
+                                  "</dummy>");
+    FGTable t_2x2x3(pm, elm->FindElement("table"));
+    double dRow, dCol, dTable;
+
+    t_2x2x3.GetGradient(0.5, 0.5, -0.5, dRow, dCol, dTable);
+    TS_ASSERT_EQUALS(dRow, 0.0);
+    TS_ASSERT_EQUALS(dCol, 1.0);
+    TS_ASSERT_EQUALS(dTable, 2.0);
+    t_2x2x3.GetGradient(0.5, 0.5, 1.0, dRow, dCol, dTable);
+    TS_ASSERT_EQUALS(dTable, 0.5);
+    // The slope at an inner breakpoint is the mean of the slopes on each side
+    t_2x2x3.GetGradient(0.5, 0.5, 0.0, dRow, dCol, dTable);
+    TS_ASSERT_EQUALS(dCol, 1.0);
+    TS_ASSERT_EQUALS(dTable, 0.5*(2.0+0.5));
+    t_2x2x3.GetGradient(0.5, 0.5, 2.0, dRow, dCol, dTable); // Saturated table
+    TS_ASSERT_EQUALS(dTable, 0.0);
+  }
 };
 
 
@@ -0,0 +1,85 @@
+#include <sstream>
+
+#include <cxxtest/TestSuite.h>
+#include <input_output/FGXMLElement.h>
+#include "TestUtilities.h"
+
+using namespace JSBSim;
+
+
+class FGXMLElementTest : public CxxTest::TestSuite
+{
+public:
+  void testAttributes() {
+    Element_ptr el = readFromXML("<table name=\"lift\" type=\"internal\">"
+                                 "  <independentVar lookup=\"row\"/>"
+                                 "  <location x=\" 1.5 \"/>"
+                                 "</table>");
+
+    TS_ASSERT_EQUALS(el->GetName(), "table");
+    TS_ASSERT(el->HasAttribute("name"));
+    TS_ASSERT(el->HasAttribute("type"));
+    TS_ASSERT(!el->HasAttribute("lookup"));
+    TS_ASSERT_EQUALS(el->GetAttributeValue("name"), "lift");
+    TS_ASSERT_EQUALS(el->GetAttributeValue("type"), "internal");
+    TS_ASSERT_EQUALS(el->GetAttributeValue("unknown"), "");
+
+    Element* var = el->FindElement("independentVar");
+    TS_ASSERT_EQUALS(var->GetAttributeValue("lookup"), "row");
+    TS_ASSERT_EQUALS(var->GetParent(), el.ptr());
+
+    Element* location = el->FindElement("location");
+    TS_ASSERT_EQUALS(location->GetAttributeValueAsNumber("x"), 1.5);
+  }
+
+  void testDataLines() {
+    Element_ptr el = readFromXML("<tableData>\n"
+                                 "      0.0   1.0\n"
+                                 "\n"
+                                 "  \t  2.0   3.0  \n"
+                                 "</tableData>");
+
+    // The lines are trimmed and the empty lines are skipped.
+    TS_ASSERT_EQUALS(el->GetNumDataLines(), 2);
+    TS_ASSERT_EQUALS(el->GetDataLine(0), "0.0   1.0");
+    TS_ASSERT_EQUALS(el->GetDataLine(1), "2.0   3.0");
+    TS_ASSERT_EQUALS(el->GetDataLine(2), "");
+    // The lines are returned by reference.
+    TS_ASSERT_EQUALS(&el->GetDataLine(1), &el->GetDataLine(1));
+
+    Element_ptr number = readFromXML("<value>  -2.5  </value>");
+    TS_ASSERT_EQUALS(number->GetNumDataLines(), 1);
+    TS_ASSERT_EQUALS(number->GetDataAsNumber(), -2.5);
+
+    Element_ptr empty = readFromXML("<value/>");
+    TS_ASSERT_EQUALS(empty->GetNumDataLines(), 0);
+    TS_ASSERT_EQUALS(empty->GetDataLine(), "");
+  }
+
+  void testReadFrom() {
+    std::istringstream data("<?xml version=\"1.0\"?>\n"
+                            "<system>\n"
+                            "  <channel>\n"
+                            "    <switch/>\n"
+                            "  </channel>\n"
+                            "</system>\n");
+    FGXMLParse parser;
+    readXML(data, parser, "aircraft/test.xml");
+    Element_ptr el = parser.GetDocument();
+
+    Element* channel = el->FindElement("channel");
+    Element* sw = channel->FindElement("switch");
+    TS_ASSERT_EQUALS(el->GetLineNumber(), 2);
+    TS_ASSERT_EQUALS(channel->GetLineNumber(), 3);
+    TS_ASSERT_EQUALS(sw->GetLineNumber(), 4);
+    TS_ASSERT_EQUALS(sw->GetFileName(), "aircraft/test.xml");
+    TS_ASSERT_EQUALS(sw->ReadFrom(), "\nIn file aircraft/test.xml: line 4\n");
+
+    // The elements of a document share the same file name.
+    TS_ASSERT_EQUALS(&el->GetFileName(), &sw->GetFileName());
+
+    Element orphan("orphan");
+    TS_ASSERT_EQUALS(orphan.GetFileName(), "");
+    TS_ASSERT_EQUALS(orphan.GetLineNumber(), -1);
+  }
+};
@@ -158,6 +158,29 @@ public:
     TS_ASSERT_THROWS(atof_locale_c(" "), InvalidNumber&);
   }
 
+  void testAtofLocaleCList() {
+    std::vector<double> values;
+    TS_ASSERT_EQUALS(atof_locale_c("", values), 0);
+    TS_ASSERT_EQUALS(atof_locale_c(" \t ", values), 0);
+    TS_ASSERT(values.empty());
+    TS_ASSERT_EQUALS(atof_locale_c(" 1.0\t-2 +.5e1  3.14E-2 ", values), 4);
+    TS_ASSERT_EQUALS(values.size(), 4);
+    TS_ASSERT_EQUALS(values[0], 1.0);
+    TS_ASSERT_EQUALS(values[1], -2.0);
+    TS_ASSERT_EQUALS(values[2], 5.0);
+    TS_ASSERT_EQUALS(values[3], 0.0314);
+    // Numbers are appended to the existing values
+    TS_ASSERT_EQUALS(atof_locale_c("1E-999 7", values), 2);
+    TS_ASSERT_EQUALS(values.size(), 6);
+    TS_ASSERT_EQUALS(values[4], 0.0);
+    TS_ASSERT_EQUALS(values[5], 7.0);
+    // Test invalid numbers
+    TS_ASSERT_THROWS(atof_locale_c("1.0 1.0.0", values), InvalidNumber&);
+    TS_ASSERT_THROWS(atof_locale_c("1.0 1E+999", values), InvalidNumber&);
+    TS_ASSERT_THROWS(atof_locale_c("1.0 - 2.0", values), InvalidNumber&);
+    TS_ASSERT_THROWS(atof_locale_c("1.0,2.0", values), InvalidNumber&);
+  }
+
 private:
   std::string empty;
 };
@@ -199,6 +199,16 @@ export interface FGLinearization {
 export interface FGFDMExec extends FGJSBBase {
   // Core simulation methods
   run(): boolean;
+  /**
+   * Run up to n frames without returning to JavaScript. The execution stops
+   * early when the simulation is terminated, when the script ends or when the
+   * stop condition (such as "position/h-agl-ft lt 10") is true. The values of
+   * the properties are stored frame after frame in the buffer which must hold
+   * at least n * properties.length elements.
+   * @returns the number of frames that have been run
+   */
+  runFrames(n: number, stopCondition: string, properties: string[] | null,
+            buffer: Float64Array | null): number;
   runIC(): boolean;
   loadModel(model: string, addModelToPath?: boolean): boolean;
   loadScript(script: string, deltaT?: number, initfile?: string): boolean;
@@ -279,6 +289,9 @@ export interface JSBSimConfig {
   dataFiles?: Array<{ path: string; data: ArrayBuffer | Uint8Array }>;
 }
 
+// Largest number of frames that FGFDMExec.runFrames() accepts (unsigned int).
+const MAX_FRAMES = 0xFFFFFFFF;
+
 /**
  * High-level wrapper class for easier JSBSim usage
  */
@@ -401,6 +414,18 @@ export class JSBSim {
     const endTime = startTime + duration;
     const deltaT = this.fdm.getDeltaT();
 
+    if (!realTime && deltaT > 0) {
+      // The frames are all run in a single call to the WebAssembly module. The
+      // stop condition ends the run at the same frame as the loop below so the
+      // number of frames is not bounded: the time step may be shortened by
+      // the adaptive step or by the event location.
+      if (this.fdm.getSimTime() < endTime) {
+        this.fdm.runFrames(MAX_FRAMES, `simulation/sim-time-sec ge ${endTime}`,
+                           null, null);
+      }
+      return;
+    }
+
     while (this.fdm.getSimTime() < endTime) {
       if (!this.fdm.run()) {
         break;
@@ -410,6 +410,25 @@ public:
         return fdm_->Run();
     }
 
+    unsigned int runFrames(unsigned int n, const std::string& stop_condition,
+                           val properties, val buffer) {
+        std::vector<std::string> names;
+        if (!properties.isNull() && !properties.isUndefined())
+            names = vecFromJSArray<std::string>(properties);
+
+        if (names.empty() || buffer.isNull() || buffer.isUndefined())
+            return fdm_->RunFrames(n, stop_condition);
+
+        // The values are recorded in a C++ buffer then copied in one go to
+        // the Float64Array supplied by the caller.
+        std::vector<double> values(n*names.size());
+        unsigned int frames = fdm_->RunFrames(n, stop_condition, names,
+                                              values.data());
+        buffer.call<void>("set", val(typed_memory_view(frames*names.size(),
+                                                       values.data())));
+        return frames;
+    }
+
     bool runIC() {
         return fdm_->RunIC();
     }
@@ -718,6 +737,7 @@ EMSCRIPTEN_BINDINGS(jsbsim) {
         .constructor<>()
         .constructor<const std::string&>()
         .function("run", &JSBSimFDMExec::run)
+        .function("runFrames", &JSBSimFDMExec::runFrames)
         .function("runIC", &JSBSimFDMExec::runIC)
         .function("loadModel", &JSBSimFDMExec::loadModel)
         .function("loadScript", &JSBSimFDMExec::loadScript)
@@ -103,6 +103,55 @@ describe('JSBSim', () => {
       expect(() => jsbsim.reset()).toThrow(BaseError);
     });
   });
+
+  describe('Run', () => {
+    // Stand-in for the WebAssembly FDM that accumulates the simulation time
+    // frame after frame and evaluates the stop condition of runFrames().
+    const fakeFDM = (deltaT: number) => {
+      const fdm = {
+        simTime: 0.0,
+        frames: 0,
+        getDeltaT: () => deltaT,
+        getSimTime: () => fdm.simTime,
+        run: () => {
+          fdm.simTime += deltaT;
+          fdm.frames++;
+          return true;
+        },
+        runFrames: (n: number, stopCondition: string) => {
+          const endTime = parseFloat(stopCondition.split(' ge ')[1]);
+          let frames = 0;
+          while (frames < n) {
+            fdm.run();
+            frames++;
+            if (fdm.simTime >= endTime) break;
+          }
+          return frames;
+        }
+      };
+      return fdm;
+    };
+
+    test.each([
+      [1.0 / 120.0, 0.0],
+      [1.0 / 120.0, 0.1],
+      [1.0 / 120.0, 0.25],
+      [0.01, 0.03],
+      [0.001, 0.0105]
+    ])('should run as many frames as in real time (dt=%f, duration=%f)',
+       async (deltaT: number, duration: number) => {
+      const batch = fakeFDM(deltaT);
+      (jsbsim as any).fdm = batch;
+      await jsbsim.run(duration);
+
+      const paced = fakeFDM(deltaT);
+      (jsbsim as any).fdm = paced;
+      await jsbsim.run(duration, true);
+
+      expect(batch.frames).toBe(paced.frames);
+      expect(batch.simTime).toBe(paced.simTime);
+    });
+  });
 });
 
 describe('Error Classes', () => {
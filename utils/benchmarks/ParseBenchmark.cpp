@@ -0,0 +1,132 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       ParseBenchmark.cpp
+ Date started: 10/17/26
+ Purpose:      Times the parsing of numbers and the loading of aircraft models
+
+ ------------- Copyright (C) 2026 The JSBSim team -----------------------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+Measures the time taken by atof_locale_c() to convert a number and by FGTable to
+read a line of table data from a stream, then the time taken to load every aircraft of a JSBSim
+root directory. Each measurement is the best of 3 runs.
+
+Usage: ParseBenchmark [root directory]
+
+The root directory defaults to the current directory. Build the target at two
+commits to compare them.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+#include "FGFDMExec.h"
+#include "input_output/FGLog.h"
+#include "input_output/string_utilities.h"
+#include "math/FGTable.h"
+
+using namespace std;
+using namespace JSBSim;
+
+namespace fs = std::filesystem;
+
+class NullLogger : public FGLogger
+{
+public:
+  void Message(const string&) override {}
+};
+
+template <typename F>
+double BestOf3(F f)
+{
+  double best = numeric_limits<double>::max();
+  for (int i=0; i<3; ++i) {
+    auto start = chrono::steady_clock::now();
+    f();
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    best = min(best, elapsed.count());
+  }
+  return best;
+}
+
+int main(int argc, char* argv[])
+{
+  const fs::path root = argc > 1 ? argv[1] : ".";
+  const vector<string> numbers {"0.0", "-1.5", "123.456", "1.0e-3", "+2E+05",
+                                "-0.000125", "42", "3.14159265358979"};
+  const string line = "  -10.0  0.0213  0.0341  0.0452  0.0618  0.0795";
+  const int n = 1000000;
+  double sum = 0.0;
+
+  double t = BestOf3([&]() {
+    for (int i=0; i<n; ++i)
+      sum += atof_locale_c(numbers[i % numbers.size()]);
+  });
+  cout << "atof_locale_c(number): " << t / n * 1E9 << " ns per number" << endl;
+
+  FGTable table(1);
+  t = BestOf3([&]() {
+    for (int i=0; i<n/10; ++i) {
+      istringstream data(line);
+      table << data;
+    }
+  });
+  cout << "FGTable << istream: " << t / (n/10) * 1E9 << " ns per table line"
+       << endl;
+
+  vector<string> models;
+  for (auto& entry: fs::directory_iterator(root / "aircraft")) {
+    string name = entry.path().filename().string();
+    if (fs::is_regular_file(entry.path() / (name + ".xml")))
+      models.push_back(name);
+  }
+  sort(models.begin(), models.end());
+
+  auto logger = make_shared<NullLogger>();
+  t = BestOf3([&]() {
+    for (auto& model: models) {
+      FGFDMExec fdm;
+      // The constructor resets the debug level.
+      FGJSBBase::debug_lvl = 0;
+      fdm.SetLogger(logger);
+      fdm.SetRootDir(SGPath(root.string()));
+      fdm.SetAircraftPath(SGPath("aircraft"));
+      fdm.SetEnginePath(SGPath("engine"));
+      fdm.SetSystemsPath(SGPath("systems"));
+      try {
+        fdm.LoadModel(model);
+      } catch (BaseException&) {
+      }
+    }
+  });
+  cout << models.size() << " aircraft loaded in " << t << " s" << endl;
+
+  // Prevent the conversions from being optimized away.
+  return sum + table.GetNumRows() == 0.0 ? 1 : 0;
+}